@@ -0,0 +1,57 @@
+/////////////////////////////////////////////////////////////////////////////////
+// BlockDevice.h
+//
+// Defines the abstract base class of the block devices (external SPI FLASH,
+// or a file on the host) that the chord table can be read from.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined BLOCKDEVICE_H
+#define BLOCKDEVICE_H
+
+#include <stdint.h>                 // For uintxx_t.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// BlockDevice base class.  A block device reads fixed size blocks of data.
+// Block n holds the bytes at addresses n * BLOCK_SIZE .. (n + 1) * BLOCK_SIZE - 1.
+/////////////////////////////////////////////////////////////////////////////////
+class BlockDevice
+{
+public:
+    BlockDevice() { }
+    virtual ~BlockDevice() { }
+
+    // Read the specified block into pBuf.  Returns true if successful.
+    virtual bool Read(uint32_t block, uint8_t *pBuf) = 0;
+
+    // Bytes per block.  This is also the size of a PageCache page.
+    static const uint8_t BLOCK_SIZE = 32;
+
+protected:
+    
+private:
+    
+};
+
+
+
+#endif // BLOCKDEVICE_H
@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////////
+// CandidateFilter.cpp
+//
+// Implements the CandidateFilter class, which counts the chords that fit the
+// pattern being entered in the reverse chord finder.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "CandidateFilter.h"
+#include "ChordStore.h"             // For ChordStore class.
+
+
+void CandidateFilter::RequireString(uint8_t string, uint8_t rows, bool on)
+{
+    uint8_t bit = 1 << string;
+    m_Strings      |= bit;
+    m_Rows[string]  = rows;
+    if (on)
+    {
+        m_Invert &= ~bit;
+    }
+    else
+    {
+        m_Invert |= bit;
+    }
+}
+
+
+// This method reads each byte of the lists once, in voicing order, and stops
+// reading a byte's lists as soon as no voicing in it is left.  The whole
+// count is a few thousand reads of the chord store, well inside the time
+// between two IR keys.
+unsigned CandidateFilter::Count(unsigned from, unsigned &rFirst) const
+{
+    unsigned numVoicings = ChordStore::GetNumVoicings();
+    unsigned numBytes    = (numVoicings + 7) / 8;
+    unsigned count       = 0;
+
+    rFirst = numVoicings;
+    for (unsigned index = 0; index < numBytes; index++)
+    {
+        uint8_t bits = GetByte(index);
+
+        // The last byte may have bits past the last voicing.
+        if ((index == numBytes - 1) && ((numVoicings % 8) != 0))
+        {
+            bits &= (1 << (numVoicings % 8)) - 1;
+        }
+        if (bits == 0)
+        {
+            continue;
+        }
+        count += CountBits(bits);
+
+        // Take the first voicing, until one at or after from turns up.
+        for (uint8_t bit = 0; (bit < 8) && ((rFirst == numVoicings) || (rFirst < from)); bit++)
+        {
+            unsigned voicing = index * 8 + bit;
+            if (((bits & (1 << bit)) != 0) &&
+                ((rFirst == numVoicings) || (voicing >= from)))
+            {
+                rFirst = voicing;
+            }
+        }
+    }
+    return count;
+}
+
+
+// Return one byte of the set of voicings that fit, the voicings from
+// index * 8 to index * 8 + 7.
+uint8_t CandidateFilter::GetByte(unsigned index) const
+{
+    uint8_t bits = 0xff;
+
+    for (uint8_t string = 0; (string < Instrument::NUM_STRINGS) && (bits != 0); string++)
+    {
+        if ((m_Strings & (1 << string)) == 0)
+        {
+            continue;
+        }
+        uint8_t on = 0;
+        for (uint8_t row = 0; row <= UNPLAYED_ROW; row++)
+        {
+            if ((m_Rows[string] & (1 << row)) != 0)
+            {
+                on |= ChordStore::ReadPostingByte(GetList(row, string), index);
+            }
+        }
+        bits &= ((m_Invert & (1 << string)) != 0) ? ~on : on;
+    }
+
+    // The fret lists follow the unplayed lists, one per bit of the fret.
+    if (m_Fret != 0)
+    {
+        for (uint8_t bit = 0; (bit < CHORD_FRET_BITS) && (bits != 0); bit++)
+        {
+            uint8_t on = ChordStore::ReadPostingByte(GetList(UNPLAYED_ROW + 1, bit), index);
+            bits &= ((m_Fret & (1 << bit)) != 0) ? on : ~on;
+        }
+    }
+    return bits;
+}
+
+
+uint8_t CandidateFilter::CountBits(uint8_t bits)
+{
+    uint8_t count = 0;
+    for ( ; bits != 0; bits &= bits - 1)
+    {
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,89 @@
+/////////////////////////////////////////////////////////////////////////////////
+// CandidateFilter.h
+//
+// Defines the CandidateFilter class, which counts the chords that fit the
+// pattern being entered in the reverse chord finder.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CANDIDATEFILTER_H
+#define CANDIDATEFILTER_H
+
+#include <stdint.h>                 // For uintxx_t.
+#include "InstrumentProfile.h"      // For Instrument.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// CandidateFilter class.  The chord table's posting lists are a bit set of
+// voicings for each string on each fret of a pattern, each string unplayed,
+// and each bit of the starting fret (see ChordPostings[] in ChordTable.h).
+// The filter holds one condition per string and one on the starting fret,
+// and ANDs the lists they name a byte at a time, straight from the chord
+// store, so it needs no RAM for the voicings however many there are.
+/////////////////////////////////////////////////////////////////////////////////
+class CandidateFilter
+{
+public:
+    static const uint8_t NUM_ROWS     = Instrument::NUM_FRETS - 1;
+                                        // Frets a pattern may span.
+    static const uint8_t UNPLAYED_ROW = NUM_ROWS;
+
+    CandidateFilter() : m_Strings(0), m_Invert(0), m_Fret(0) { }
+
+    // Remove every condition, so every voicing fits.
+    void Clear() { m_Strings = 0; m_Invert = 0; m_Fret = 0; }
+
+    // Keep only the voicings that hold a string on one of a set of rows, or
+    // with on false, on none of them.
+    // rows - Bit n for row n, and bit UNPLAYED_ROW for the string unplayed.
+    void RequireString(uint8_t string, uint8_t rows, bool on);
+
+    // Keep only the voicings that start on a fret (counted from the capo).
+    void RequireFret(uint8_t fret) { m_Fret = fret; }
+
+    // Return the number of voicings that fit, and the first of them at or
+    // after a voicing index, or failing that the first of all.
+    unsigned Count(unsigned from, unsigned &rFirst) const;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    CandidateFilter(const CandidateFilter &);
+    CandidateFilter &operator=(const CandidateFilter &);
+
+    uint8_t GetByte(unsigned index) const;
+
+    static uint8_t GetList(uint8_t row, uint8_t string)
+    {
+        return row * Instrument::NUM_STRINGS + string;
+    }
+    static uint8_t CountBits(uint8_t bits);
+
+    uint8_t m_Strings;                  // Strings with a condition.
+    uint8_t m_Invert;                   // Strings that must be on none of
+                                        // their rows.
+    uint8_t m_Rows[Instrument::NUM_STRINGS];
+    uint8_t m_Fret;                     // 0 for any.
+};
+
+
+#endif // CANDIDATEFILTER_H
@@ -6,7 +6,7 @@
 // chords, and are stored in FLASH in order to save RAM.  The methods of the
 // class manage access to the chord data saved in FLASH.
 //
-// This file contains a reduced number of chords.
+// The chord library (reduced or full) is selected in ChordTableConfig.h.
 //
 // History:
 // - jmcorbett 23-Dec-2015 Original creation.
@@ -29,420 +29,189 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #include "ChordChartData.h"
+#include "ChordStore.h"         // For reading the chord table.
+#include "ChordSynthesizer.h"   // For alternate tunings.
 
 
 
 ///////////////////////////////////////////////////////////////////////////////
-// The data for the following chord table was taken from 
-// "CompleteGuitarChordPoster_WayneChase_FreeEdition.pdf" found at
-// www.HowMusicReallyWorks.com.
-// 
-// This version of the chord data normalizes all chords by making the first
-// displayed fret always contain fingering positions.  For example, the first
-// variant of C9 is displayed as starting at fret 2, rather than starting at
-// fret 1 with fret 1 empty.  This might help in the future with reverse 
-// chord lookup.
-///////////////////////////////////////////////////////////////////////////////
-
-///////////////////////////////////////////////////////////////////////////////
-static const uint8_t Keys[sizeof(Key) * NUM_KEYS] PROGMEM =
+// The chord table itself (ChordShapes[], ChordShapeIds[] and ChordFrets[], or
+// ChordStream[] and ChordStreamKeyframes[] with CHORD_DELTA_STREAM) and
+// the offset of each key and type within it (ChordVoicingOffsets[]) are
+// generated into ChordTable.cpp by the ChordTableCompiler host tool from
+// ChordTable.txt.  Make sure the generated header matches the table layout
+// used here.
 ///////////////////////////////////////////////////////////////////////////////
+static_assert((MAX_CHORD_VARIATIONS > 0) &&
+              (MAX_CHORD_VARIATIONS * NUM_CHORD_TYPES * NUM_KEYS >= NUM_CHORD_VOICINGS),
+              "ChordTable.h is out of date.  Re-run ChordTableCompiler.");
+static_assert(TOTAL_CHORDS_PER_KEY == NUM_CHORD_TYPES,
+              "ChordTable.h is out of date.  Re-run ChordTableCompiler.");
+
+// The chord table must be for the instrument this build is for (see
+// InstrumentProfile.h), and its shapes must hold every string.
+static_assert(CHORD_TABLE_STRINGS == NUM_CHORD_STRINGS,
+              "ChordTable.txt is for another instrument.");
+static_assert(PackedShape::PACKED_BITS_PER_STRING * NUM_CHORD_STRINGS <= CHORD_SHAPE_SIZE * 8,
+              "The packed shapes are too small for the instrument's strings.");
+
+// Make sure the selected chord library fits in FLASH with room for the program.
+// ChordTableCompiler reports the size of each library.
+#if defined(FLASHEND) && !CHORD_EXTERNAL_STORE
+static_assert(CHORD_TABLE_BYTES <= FLASHEND + 1UL - PROGRAM_FLASH_RESERVE,
+              "The chord table doesn't fit in FLASH.  Set FULL_CHORD_LIBRARY to 0.");
+#endif
+
+
+// This method returns the starting fret of the voicing.  The starting frets
+// are stored two voicings per byte.
+uint8_t ChordView::GetFret() const
 {
-///////////////////////////////////////////////////////////////////////////////
-// C
-///////////////////////////////////////////////////////////////////////////////
-
-    // C Major
-    1, 0x00, 0x02, 0x08, 0x30, 0x00, 0x00,     3, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
-
-    // C Minor
-    1, 0x30, 0x0a, 0x00, 0x01, 0x00, 0x00,     3, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,
-    
-    // C Sixth
-    1, 0x00, 0x02, 0x0c, 0x01, 0x00, 0x00,     5, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,
-    
-    // C Minor Sixth
-    1, 0x20, 0x0a, 0x00, 0x01, 0x00, 0x00,     4, 0x30, 0x02, 0x0d, 0x00, 0x00, 0x00,
-    
-    // C Seventh
-    1, 0x00, 0x02, 0x08, 0x34, 0x00, 0x00,     3, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,
-    
-    // C Major Seventh
-    2, 0x00, 0x08, 0x30, 0x00, 0x00, 0x00,     3, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
-    
-    // C Minor Seventh
-    1, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,     3, 0x00, 0x35, 0x02, 0x08, 0x00, 0x00,
-    
-    // C Ninth
-    2, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,     5, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,
-    
-    
-
-///////////////////////////////////////////////////////////////////////////////
-// C# 
-///////////////////////////////////////////////////////////////////////////////
-
-    // C Sharp Major
-    1, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,     4, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
-
-    // C Sharp Minor
-    1, 0x30, 0x04, 0x0a, 0x00, 0x00, 0x00,     4, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,
-    
-    // C Sharp Sixth
-    1, 0x00, 0x34, 0x02, 0x08, 0x01, 0x00,     6, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,
-    
-    // C Sharp Minor Sixth
-    1, 0x20, 0x14, 0x0a, 0x00, 0x00, 0x00,     2, 0x20, 0x0a, 0x04, 0x11, 0x00, 0x00,
-    
-    // C Sharp Seventh
-    2, 0x30, 0x02, 0x08, 0x05, 0x00, 0x00,     4, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,
-    
-    // C Sharp Major Seventh
-    1, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,     4, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
-    
-    // C Sharp Minor Seventh
-    1, 0x20, 0x04, 0x08, 0x00, 0x10, 0x00,     2, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,
-    
-    // C Sharp Ninth
-    3, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,     6, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// D 
-///////////////////////////////////////////////////////////////////////////////
-
-    // D Major
-    2, 0x00, 0x25, 0x02, 0x00, 0x00, 0x00,     5, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
-
-    // D Minor
-    1, 0x00, 0x21, 0x04, 0x02, 0x00, 0x00,     5, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,
-    
-    // D Sixth
-    2, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00,     2, 0x00, 0x34, 0x02, 0x08, 0x01, 0x00,
-    
-    // D Minor Sixth
-    1, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00,     3, 0x20, 0x0a, 0x04, 0x11, 0x00, 0x00,
-    
-    // D Seventh
-    1, 0x00, 0x02, 0x25, 0x00, 0x00, 0x00,     3, 0x30, 0x02, 0x08, 0x05, 0x00, 0x00,
-    
-    // D Major Seventh
-    2, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00,     5, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
-    
-    // D Minor Seventh
-    1, 0x20, 0x03, 0x04, 0x00, 0x00, 0x00,     3, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,
-    
-    // D Ninth
-    1, 0x00, 0x02, 0x24, 0x00, 0x00, 0x00,     4, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// Eb 
-///////////////////////////////////////////////////////////////////////////////
-
-    // E Flat Major
-    3, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,     6, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
-
-    // E Flat Minor
-    1, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,     2, 0x30, 0x01, 0x04, 0x0a, 0x00, 0x00,
-    
-    // E Flat Sixth
-    1, 0x20, 0x1a, 0x00, 0x05, 0x00, 0x00,     3, 0x00, 0x34, 0x02, 0x08, 0x01, 0x00,
-    
-    // E Flat Minor Sixth
-    1, 0x20, 0x1a, 0x01, 0x04, 0x00, 0x00,     4, 0x20, 0x0a, 0x04, 0x11, 0x00, 0x00,
-    
-    // E Flat Seventh
-    1, 0x20, 0x18, 0x02, 0x05, 0x00, 0x00,     4, 0x30, 0x02, 0x08, 0x05, 0x00, 0x00,
-    
-    // E Flat Major Seventh
-    3, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,     6, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
-    
-    // E Flat Minor Seventh
-    1, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,     4, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,
-    
-    // E Flat Ninth
-    1, 0x20, 0x19, 0x02, 0x00, 0x00, 0x00,     1, 0x00, 0x19, 0x02, 0x24, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// E 
-///////////////////////////////////////////////////////////////////////////////
-    
-    // E Major
-    1, 0x00, 0x04, 0x18, 0x00, 0x00, 0x00,     4, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,
-
-    // E Minor
-    2, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,     2, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
-    
-    // E Sixth
-    1, 0x00, 0x04, 0x1a, 0x00, 0x00, 0x00,     2, 0x00, 0x1a, 0x00, 0x05, 0x00, 0x00,
-    
-    // E Minor Sixth
-    2, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00,     2, 0x20, 0x1a, 0x01, 0x04, 0x00, 0x00,
-    
-    // E Seventh
-    1, 0x00, 0x04, 0x18, 0x02, 0x00, 0x00,     2, 0x00, 0x18, 0x02, 0x05, 0x00, 0x00,
-    
-    // E Major Seventh
-    1, 0x00, 0x0c, 0x10, 0x00, 0x00, 0x00,     4, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,
-    
-    // E Minor Seventh
-    2, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,     2, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
-    
-    // E Ninth
-    1, 0x00, 0x04, 0x11, 0x00, 0x00, 0x00,     2, 0x00, 0x19, 0x02, 0x24, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// F 
-///////////////////////////////////////////////////////////////////////////////
-
-    // F Major
-    1, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,     5, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,
-
-    // F Minor
-    1, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     3, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
-    
-    // F Sixth
-    1, 0x00, 0x23, 0x04, 0x00, 0x00, 0x00,     3, 0x20, 0x1a, 0x00, 0x05, 0x00, 0x00,
-    
-    // F Minor Sixth
-    1, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00,     1, 0x00, 0x25, 0x00, 0x1a, 0x00, 0x00,
-    
-    // F Seventh
-    1, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,     3, 0x20, 0x18, 0x02, 0x05, 0x00, 0x00,
-    
-    // F Major Seventh
-    1, 0x00, 0x22, 0x04, 0x18, 0x00, 0x00,     5, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,
-    
-    // F Minor Seventh
-    1, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,     3, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
-    
-    // F Ninth
-    1, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00,     1, 0x00, 0x2a, 0x04, 0x11, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// F# 
-///////////////////////////////////////////////////////////////////////////////
-
-    // F Sharp Major
-    2, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,     6, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,
-
-    // F Sharp Minor
-    2, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     4, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
-    
-    // F Sharp Sixth
-    1, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,     4, 0x20, 0x1a, 0x00, 0x05, 0x00, 0x00,
-    
-    // F Sharp Minor Sixth
-    1, 0x00, 0x08, 0x27, 0x00, 0x00, 0x00,     2, 0x00, 0x25, 0x00, 0x1a, 0x00, 0x00,
-    
-    // F Sharp Seventh
-    2, 0x00, 0x22, 0x04, 0x18, 0x00, 0x00,     2, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
-    
-    // F Sharp Major Seventh
-    1, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,     2, 0x00, 0x23, 0x0c, 0x10, 0x00, 0x00,
-    
-    // F Sharp Minor Seventh
-    2, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,     4, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
-    
-    // F Sharp Ninth
-    1, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,     2, 0x00, 0x2a, 0x04, 0x11, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// G 
-///////////////////////////////////////////////////////////////////////////////
-    
-    // G Major
-    2, 0x00, 0x10, 0x21, 0x00, 0x00, 0x00,     3, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,
-
-    // G Minor
-    3, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     5, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
-    
-    // G Sixth
-    2, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00,     3, 0x00, 0x22, 0x04, 0x18, 0x00, 0x00,
-    
-    // G Minor Sixth
-    1, 0x20, 0x10, 0x08, 0x02, 0x00, 0x00,     2, 0x30, 0x08, 0x07, 0x00, 0x00, 0x00,
-    
-    // G Seventh
-    1, 0x00, 0x01, 0x10, 0x20, 0x00, 0x00,     3, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
-    
-    // G Major Seventh
-    2, 0x00, 0x11, 0x20, 0x00, 0x00, 0x00,     2, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,
-    
-    // G Minor Seventh
-    3, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,     5, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
-    
-    // G Ninth
-    1, 0x00, 0x01, 0x14, 0x20, 0x00, 0x00,     2, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// Ab 
-///////////////////////////////////////////////////////////////////////////////
-   
-    // A Flat Major
-    1, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,     4, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,
-
-    // A Flat Minor
-    4, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     6, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
-    
-    // A Flat Sixth
-    1, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,     3, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
-    
-    // A Flat Minor Sixth
-    1, 0x00, 0x2d, 0x10, 0x00, 0x00, 0x00,     3, 0x30, 0x08, 0x07, 0x00, 0x00, 0x00,
-    
-    // A Flat Seventh
-    1, 0x30, 0x0e, 0x01, 0x00, 0x00, 0x00,     4, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
-    
-    // A Flat Major Seventh
-    1, 0x20, 0x0e, 0x00, 0x11, 0x00, 0x00,     3, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,
-    
-    // A Flat Minor Seventh
-    1, 0x30, 0x0c, 0x01, 0x00, 0x00, 0x00,     4, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,
-    
-    // A Flat Ninth
-    1, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,     3, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// A 
-///////////////////////////////////////////////////////////////////////////////
-
-    // A Major
-    2, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,     2, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,
-
-    // A Minor
-    1, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00,     5, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,
-    
-    // A Sixth
-    2, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,     4, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
-    
-    // A Minor Sixth
-    1, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00,     4, 0x20, 0x08, 0x07, 0x00, 0x00, 0x00,
-    
-    // A Seventh
-    2, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,     5, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
-    
-    // A Major Seventh
-    1, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00,     4, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,
-    
-    // A Minor Seventh
-    1, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00,     5, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,
-    
-    // A Ninth
-    2, 0x00, 0x0a, 0x01, 0x04, 0x00, 0x00,     4, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// Bb 
-///////////////////////////////////////////////////////////////////////////////
-    
-    // B Flat Major
-    1, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,     3, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,
-
-    // B Flat Minor
-    1, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,     6, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,
-    
-    // B Flat Sixth
-    3, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,     5, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
-    
-    // B Flat Minor Sixth
-    2, 0x30, 0x02, 0x0d, 0x00, 0x00, 0x00,     5, 0x30, 0x08, 0x07, 0x00, 0x00, 0x00,
-    
-    // B Flat Seventh
-    1, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,     3, 0x30, 0x0e, 0x01, 0x00, 0x00, 0x00,
-    
-    // B Flat Major Seventh
-    1, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,     3, 0x20, 0x0e, 0x00, 0x11, 0x00, 0x00,
-    
-    // B Flat Minor Seventh
-    1, 0x00, 0x35, 0x02, 0x08, 0x00, 0x00,     6, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,
-    
-    // B Flat Ninth
-    1, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00,     3, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,
-    
-///////////////////////////////////////////////////////////////////////////////
-// B 
-///////////////////////////////////////////////////////////////////////////////
+#if !CHORD_DELTA_STREAM
+    if (m_pVoicing == NULL)
+    {
+        uint8_t frets = ChordStore::ReadFrets(m_Index / 2);
+        return (m_Index & 1) ? (frets >> 4) : (frets & 0x0f);
+    }
+#endif
+    return m_pVoicing->m_Fret;
+}
 
-    // B Major
-    2, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,     4, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,
 
-    // B Minor
-    2, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,     7, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,
-    
-    // B Sixth
-    1, 0x30, 0x0c, 0x01, 0x00, 0x00, 0x00,     4, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,
-    
-    // B Minor Sixth
-    1, 0x00, 0x04, 0x31, 0x00, 0x00, 0x00,     3, 0x30, 0x02, 0x0d, 0x00, 0x00, 0x00,
-    
-    // B Seventh
-    1, 0x00, 0x08, 0x35, 0x00, 0x00, 0x00,     2, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,
-    
-    // B Major Seventh
-    2, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,     4, 0x20, 0x0e, 0x00, 0x11, 0x00, 0x00,
-    
-    // B Minor Seventh
-    2, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00,     2, 0x00, 0x35, 0x02, 0x08, 0x00, 0x00,
+// This method returns the bit pattern of the strings whose packed value (see
+// PackedShape) matches the specified value, high E in bit 0.
+// value - PackedShape::PACKED_UNPLAYED, or a fret offset from the starting fret.
+uint8_t ChordView::GetStrings(uint8_t value) const
+{
+    // Read the voicing's packed shape from RAM or the chord store.  The delta
+    // stream can't be read at random, so its views always point at RAM.
+    uint32_t bits;
+#if !CHORD_DELTA_STREAM
+    if (m_pVoicing == NULL)
+    {
+        unsigned shape = ChordStore::ReadShapeId(m_Index) * PackedShape::PACKED_SIZE;
+        bits = (uint32_t)ChordStore::ReadShapeByte(shape)            |
+               ((uint32_t)ChordStore::ReadShapeByte(shape + 1) << 8) |
+               ((uint32_t)ChordStore::ReadShapeByte(shape + 2) << 16);
+    }
+    else
+#endif
+    {
+        bits = (uint32_t)m_pVoicing->m_Shape[0]         |
+               ((uint32_t)m_pVoicing->m_Shape[1] << 8)  |
+               ((uint32_t)m_pVoicing->m_Shape[2] << 16);
+    }
+    uint8_t strings = 0;
     
-    // B Ninth
-    1, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,     4, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00    
-};
+    // Collect the strings with the requested value, starting with high E.
+    for (uint8_t string = 0; string < NUM_CHORD_STRINGS; string++)
+    {
+        if ((bits & PackedShape::PACKED_STRING_MASK) == value)
+        {
+            strings |= (1 << string);
+        }
+        bits >>= PackedShape::PACKED_BITS_PER_STRING;
+    }
+    return strings;
+}
 
 
-// This method fills our Chord structure with the specified chord data from
-// FLASH memory.  It also updates the current position data.
+// This method points our chord view at the specified chord in FLASH memory.
+// It also updates the current position data.  GetChord() has
+// already limited the arguments to valid values.
 // key       - zero based index into the key array (starting with C).
 // type      - zero based index into the type array.
 // variation - zero based variation number of the specified chord.
-void ChordChartData::GetChord(unsigned key, unsigned type, unsigned variation)
+void ChordChartData::LoadChord(unsigned key, unsigned type, unsigned variation)
 {
-    // Limit the key value to valid values.
-    if (key >= NUM_KEYS)
-    {
-        key = NUM_KEYS - 1;
-    }
+    // Save the new current position data.
+    m_CurrentKey       = key;
+    m_CurrentType      = type;
+    m_CurrentVariation = variation;
     
-    // Index to the start of the specified key.
-    unsigned index = key * sizeof(Key);
-
-    // Index to the chord type within the specified key.
-    if (type < NUM_COMMON_CHORDS)
+    // Point our view at the voicing.  Nothing is read from FLASH until the
+    // chord's data is asked for, except from the delta stream, whose cursor
+    // decodes the voicing into RAM.  The chord table is for standard tuning, so
+    // other tunings get a synthesized copy.  With a capo, the shape is the one
+    // of the key the capo raises to this key.
+    unsigned shapeKey = GetShapeKey(key);
+    if (m_Tuning == TuningStandard)
     {
-        // It's a common chord.  Index to it.
-        index += type * sizeof(CommonChord);
-        // Limit the variation value to valid values.
-        if (variation >= NUM_COMMON_CHORD_VARIATIONS)
-        {
-            variation = NUM_COMMON_CHORD_VARIATIONS - 1;
-        }
-        // Index to the specified variation.
-        index += variation * sizeof(Chord);
+#if CHORD_DELTA_STREAM
+        m_Cursor.Seek(GetVoicingIndex(shapeKey, type, variation), m_Voicing);
+        m_View = ChordView(&m_Voicing);
+#else
+        m_View = ChordView(GetVoicingIndex(shapeKey, type, variation));
+#endif
     }
     else
     {
-        // It's a supplamental chord.  Limit the type to valid values.
-        if (type >= TOTAL_CHORDS_PER_KEY)
+        m_Voicing = *ChordSynthesizer::Instance()->GetVoicing(m_Tuning, shapeKey, type,
+                                                              variation);
+        m_View = ChordView(&m_Voicing);
+    }
+}
+
+
+// This method fetches the chord at a voicing index.  The voicing offsets are
+// sorted, so the key and type are found with a binary search.
+// voicing - Index of the voicing, less than NUM_CHORD_VOICINGS.
+void ChordChartData::GetChordAt(unsigned voicing)
+{
+    // Find the last key and type that starts at or before the voicing.
+    unsigned low  = 0;
+    unsigned high = NUM_KEYS * NUM_CHORD_TYPES;
+    while (high - low > 1)
+    {
+        unsigned middle = (low + high) / 2;
+        if (ChordStore::ReadVoicingOffset(middle) <= voicing)
         {
-            type = TOTAL_CHORDS_PER_KEY - 1;
+            low = middle;
         }
-        // Index to the start of the specified type.
-        index += (NUM_COMMON_CHORDS * sizeof(CommonChord)) +
-            (type - NUM_COMMON_CHORDS) * sizeof(SuppChord);
-        // Limit the variation to valid values.
-        if (variation >= NUM_SUPP_CHORD_VARIATIONS)
+        else
         {
-            variation = NUM_SUPP_CHORD_VARIATIONS - 1;
+            high = middle;
         }
-        // Index to the specified variation.
-        index += variation * sizeof(Chord);
     }
-  
-    // Save the new current position data.
-    m_CurrentKey       = key;
-    m_CurrentType      = type;
-    m_CurrentVariation = variation;
-    
-    // Copy the specified chord's data from FLASH to our buffer.
-    memcpy_P(&m_Chord, &Keys[index], sizeof(Chord));
+
+    // Name the chord by the key it sounds in with the capo on.
+    unsigned key = low / NUM_CHORD_TYPES + m_Capo;
+    LoadChord((key < NUM_KEYS) ? key : key - NUM_KEYS, low % NUM_CHORD_TYPES,
+              voicing - ChordStore::ReadVoicingOffset(low));
+}
+
+
+// This method returns the number of variations of a key and type in the
+// current tuning.
+// key  - zero based index into the key array, as named with the capo on.
+// type - zero based index into the type array.
+unsigned ChordChartData::GetNumKeyVariations(unsigned key, unsigned type) const
+{
+    if (m_Tuning == TuningStandard)
+    {
+        return GetNumVariations(GetShapeKey(key), type);
+    }
+    return ChordSynthesizer::Instance()->GetNumVariations(m_Tuning, GetShapeKey(key), type);
+}
+
+
+// This method selects the tuning and reloads the current chord.  The tuning
+// may have fewer variations, so the variation is limited again.
+// tuning - TuningType of the new tuning.
+void ChordChartData::SetTuning(unsigned tuning)
+{
+    m_Tuning = (tuning < NUM_TUNINGS) ? tuning : (unsigned)TuningStandard;
+    GetChord(m_CurrentKey, m_CurrentType, m_CurrentVariation);
+}
+
+
+// This method sets the capo's fret and reloads the current chord.  The shape
+// may have fewer variations, so the variation is limited again.
+// capo - Fret of the capo, 0 for none.
+void ChordChartData::SetCapo(unsigned capo)
+{
+    m_Capo = (capo <= MAX_CAPO) ? capo : 0;
+    GetChord(m_CurrentKey, m_CurrentType, m_CurrentVariation);
 }
 
 
@@ -451,47 +220,26 @@ void ChordChartData::GetChord(unsigned key, unsigned type, unsigned variation)
 // attempt was made to go beyond the last chord.
 bool ChordChartData::NextChord()
 {
-    // Increment the current variation index.
-    m_CurrentVariation++;
-
-    // Is the current type a common chord?
-    if (m_CurrentType < NUM_COMMON_CHORDS)
+    // Increment the current variation index, and see if it needs to wrap to
+    // the next type.
+    if (++m_CurrentVariation >= GetNumKeyVariations(m_CurrentKey, m_CurrentType))
     {
-        // Yes, it's a common chord.  See if the variation needs to wrap.
-        if (m_CurrentVariation >= NUM_COMMON_CHORD_VARIATIONS)
+        // Variation wrapped. Increment the type, and reset the variation to
+        // zero.
+        m_CurrentVariation = 0;
+        // Do we need to wrap the type?
+        if (++m_CurrentType >= TOTAL_CHORDS_PER_KEY)
         {
-            // Variation wrapped. Increment the type, and reset the
-            // variation to zero.
-            m_CurrentVariation = 0;
-            m_CurrentType++;
-            if ((NUM_SUPP_CHORD_VARIATIONS == 0) && (m_CurrentType >= NUM_COMMON_CHORDS))
+            // Yes, reset the type, and bump the key.
+            m_CurrentType = 0;
+            m_CurrentKey++;
+            // If we've gone beyond the last chord, just return false.
+            if (m_CurrentKey >= NUM_KEYS)
             {
                 return false;
             }
         }
     }
-    else // Must be supp chord.
-    {
-        // Do we need to wrap the incremented variation? 
-        if (m_CurrentVariation >= NUM_SUPP_CHORD_VARIATIONS)
-        {
-            // Yes, wrap the variation and increment the type.
-            m_CurrentVariation = 0;
-            m_CurrentType++;
-            // Do we need to wrap the type?
-            if (m_CurrentType >= TOTAL_CHORDS_PER_KEY)
-            {
-                // Yes, reset the type, and bump the key.
-                m_CurrentType = 0;
-                m_CurrentKey++;
-                // If we've gone beyond the last chord, just return false.
-                if (m_CurrentKey >= NUM_KEYS)
-                {
-                    return false;
-                }
-            }
-        }
-    }
     
     //We've adjusted all the indices.  Now copy the chord from FLASH to the
     // user's buffer and return success.
@@ -522,14 +270,7 @@ bool ChordChartData::PreviousChord()
             m_CurrentType = TOTAL_CHORDS_PER_KEY - 1;
         }
         // Don't forget to update the variation.  Wrap it based on the new type.
-        if (m_CurrentType < NUM_COMMON_CHORDS)
-        {
-            m_CurrentVariation = NUM_COMMON_CHORD_VARIATIONS - 1;
-        }
-        else
-        {
-            m_CurrentVariation = NUM_SUPP_CHORD_VARIATIONS - 1;
-        }
+        m_CurrentVariation = GetNumKeyVariations(m_CurrentKey, m_CurrentType) - 1;
     }
 
     //We've adjusted all the indices.  Now copy the chord from FLASH to the
@@ -679,44 +420,21 @@ void ChordChartData::PreviousType(bool wrap)
 //        already at the last variation.
 void ChordChartData::NextVariation(bool wrap)
 {
-    // Bump the variation.
-    m_CurrentVariation++;
-    
-    // We handle common and supplemental chords differently.
-    if (m_CurrentType < NUM_COMMON_CHORDS)
+    // Bump the variation and see if it needs to wrap.
+    unsigned numVariations = GetNumKeyVariations(m_CurrentKey, m_CurrentType);
+    if (++m_CurrentVariation >= numVariations)
     {
-        // It's a common chord, check if we need to wrap.
-        if (m_CurrentVariation >= NUM_COMMON_CHORD_VARIATIONS)
+        // We've gone beyond the last variation.
+        if (wrap)
         {
-            // We've gone beyond the last variation.
-            if (wrap)
-            {
-                // It's OK to wrap, so do so.
-                m_CurrentVariation = 0;
-            }
-            else
-            {
-                // It's not OK to wrap so set variation to the last possible value.
-                m_CurrentVariation = NUM_COMMON_CHORD_VARIATIONS - 1;
-            }
+            // It's OK to wrap, so do so.
+            m_CurrentVariation = 0;
         }
-    }
-    else  // It's a supplemental chord.
-    {
-        // See if we need to wrap.
-        if (m_CurrentVariation >= NUM_SUPP_CHORD_VARIATIONS)
+        else
         {
-            // It's OK to wrap, so do so.
-            if (wrap)
-            {
-                m_CurrentVariation = 0;
-            }
-            else
-            {
-                // It's not OK to wrap so set variation to the last possible value.
-                m_CurrentVariation = NUM_SUPP_CHORD_VARIATIONS - 1;
-            }
-        }        
+            // It's not OK to wrap so set variation to the last possible value.
+            m_CurrentVariation = numVariations - 1;
+        }
     }
 
     // We've adjusted the variation.  Now copy the chord from FLASH to our
@@ -742,15 +460,10 @@ void ChordChartData::PreviousVariation(bool wrap)
             // It's not OK to wrap, so set the variation to 0.
             m_CurrentVariation = 0;
         }
-        else if (m_CurrentType < NUM_COMMON_CHORDS)
-        {
-            // It's OK to wrap, and this is a common chord, so wrap.
-            m_CurrentVariation = NUM_COMMON_CHORD_VARIATIONS - 1;
-        }
         else
         {
-            // It's OK to wrap, and this is a supplemental chord, so wrap.
-            m_CurrentVariation = NUM_SUPP_CHORD_VARIATIONS - 1;
+            // It's OK to wrap, so wrap to the last variation of this type.
+            m_CurrentVariation = GetNumKeyVariations(m_CurrentKey, m_CurrentType) - 1;
         }
     }
 
@@ -2,7 +2,8 @@
 // ChordChartData.h
 //
 // Defines several classes and constants used to describe and save chord 
-// information.  This file contains a reduced number of chords.
+// information.  The chord library (reduced or full) is selected in
+// ChordTableConfig.h.
 //
 // History:
 // - jmcorbett 23-Dec-2015 Original creation.
@@ -28,14 +29,14 @@
 #define CHORDCHARTDATA_H
 
 #include <avr/pgmspace.h>       // For uintXX_t.
+#include "ChordTable.h"         // For the generated chord table counts.
+#include "ChordStore.h"         // For reading the chord table.
+#include "ChordStream.h"        // For ChordStreamCursor.
+#include "InstrumentProfile.h"  // For Instrument.
 
 
-const unsigned NUM_CHORD_FRETS             = 5;
-const unsigned NUM_COMMON_CHORDS           = 8;
-const unsigned NUM_COMMON_CHORD_VARIATIONS = 2;
-const unsigned NUM_SUPP_CHORDS             = 0; 
-const unsigned NUM_SUPP_CHORD_VARIATIONS   = 0;
-const unsigned NUM_KEYS                    = 12;
+const unsigned NUM_CHORD_FRETS             = Instrument::NUM_FRETS;
+const unsigned NUM_CHORD_STRINGS           = Instrument::NUM_STRINGS;
 const unsigned TOTAL_CHORDS_PER_KEY        = NUM_COMMON_CHORDS + NUM_SUPP_CHORDS;
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -60,41 +61,77 @@ private:
 };
 
 /////////////////////////////////////////////////////////////////////////////////
-// CommonChord class.  Defines all the variations for a common chord instance.
+// PackedShape class.  Defines the compact form of a chord shape as it is stored
+// in FLASH.  A shape is a chord without its starting fret, so the same shape
+// moved up the neck is stored only once.  Each string is stored as a 3 bit
+// value (PACKED_OPEN, a fret offset of 1..NUM_CHORD_FRETS from the starting
+// fret, or PACKED_UNPLAYED), with the first string (high E) in the least
+// significant bits.
 /////////////////////////////////////////////////////////////////////////////////
-class CommonChord
+class PackedShape
 {
 public:
-    Chord m_Variation[NUM_COMMON_CHORD_VARIATIONS];
+    // Packed string values.  Values 1..NUM_CHORD_FRETS are fret offsets.
+    static const uint8_t PACKED_OPEN            = 0;
+    static const uint8_t PACKED_UNPLAYED        = 7;
+    static const uint8_t PACKED_BITS_PER_STRING = 3;
+    static const uint8_t PACKED_STRING_MASK     = (1 << PACKED_BITS_PER_STRING) - 1;
+    static const uint8_t PACKED_SIZE            = CHORD_SHAPE_SIZE;
+
 protected:
     
 private:
 };
 
+// Build the 3 initializer bytes of a PackedShape.  The strings are listed in
+// the same order as guitar tablature (low E first), so the open C Major shape
+// reads as PACK_SHAPE(X, 3, 2, 0, 1, 0).
+#define PACK_SHAPE(s5, s4, s3, s2, s1, s0)                                        \
+    PACK_SHAPE_BYTES(((uint32_t)(s0))       | ((uint32_t)(s1) << 3)  |            \
+                     ((uint32_t)(s2) << 6)  | ((uint32_t)(s3) << 9)  |            \
+                     ((uint32_t)(s4) << 12) | ((uint32_t)(s5) << 15))
+#define PACK_SHAPE_BYTES(bits)                                                    \
+    (uint8_t)(bits), (uint8_t)((bits) >> 8), (uint8_t)((bits) >> 16)
+
+// Build one ChordFrets byte from the starting frets of two voicings.  The
+// first (even) voicing is stored in the low nibble.
+#define PACK_FRETS(even, odd)   (uint8_t)((even) | ((odd) << 4))
+
 /////////////////////////////////////////////////////////////////////////////////
-// SuppChord class.  Defines all the variations for a supplemental chord instance.
+// PackedVoicing structure.  A voicing built in RAM rather than read from the
+// chord table: a packed shape and its starting fret.
 /////////////////////////////////////////////////////////////////////////////////
-class SuppChord
+struct PackedVoicing
 {
-public:
-    Chord m_Variation[NUM_SUPP_CHORD_VARIATIONS];
-protected:
-    
-private:
+    uint8_t m_Shape[PackedShape::PACKED_SIZE];  // See PackedShape.
+    uint8_t m_Fret;                             // Starting fret.
 };
 
-
 /////////////////////////////////////////////////////////////////////////////////
-// Key class.  Defines all the chords for a single key (C, C#, ...).
+// ChordView class.  Gives read only access to a chord voicing in FLASH without
+// copying it to RAM.  The view holds only the voicing's index, and each field
+// is read from FLASH when it is asked for.  A view may instead point at a
+// PackedVoicing in RAM, which must outlive the view.
 /////////////////////////////////////////////////////////////////////////////////
-class Key
+class ChordView
 {
 public:
-    CommonChord  m_CommonChord[NUM_COMMON_CHORDS];
-    SuppChord    m_SuppChord[NUM_SUPP_CHORDS];
+    ChordView(unsigned index = 0) : m_pVoicing(NULL), m_Index(index) { }
+    ChordView(const PackedVoicing *pVoicing) : m_pVoicing(pVoicing), m_Index(0) { }
+
+    uint8_t  GetFret() const;
+    uint8_t  GetUnplayed() const                { return GetStrings(PackedShape::PACKED_UNPLAYED); }
+    uint8_t  GetFretPattern(uint8_t fret) const { return GetStrings(fret + 1); }
+    unsigned GetIndex() const                   { return m_Index; }
+
 protected:
     
 private:
+    uint8_t  GetStrings(uint8_t value) const;
+
+    const PackedVoicing *m_pVoicing;    // Synthesized voicing, or NULL.
+    uint16_t m_Index;                   // Index of the voicing in ChordShapeIds[]
+                                        // and ChordFrets[].
 };
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -116,14 +153,55 @@ union ChordUnion
 class ChordChartData
 {
 public:
-    ChordChartData() : m_CurrentKey(0), m_CurrentType(0), m_CurrentVariation(0)
+    // The highest fret a capo may be placed at.
+    static const unsigned MAX_CAPO = 7;
+
+    ChordChartData() : m_CurrentKey(0), m_CurrentType(0), m_CurrentVariation(0),
+                       m_Tuning(0), m_Capo(0)
     {
         GetChord(m_CurrentKey, m_CurrentType, m_CurrentVariation);
     }
     
     ~ChordChartData() {}
     
-    void GetChord(unsigned key, unsigned type, unsigned variation);    
+    // Limit the position to valid values and fetch the chord.  This is inline
+    // so the limits are resolved at compile time when the arguments are
+    // constants.
+    void GetChord(unsigned key, unsigned type, unsigned variation)
+    {
+        key       = (key < NUM_KEYS) ? key : NUM_KEYS - 1;
+        type      = (type < TOTAL_CHORDS_PER_KEY) ? type : TOTAL_CHORDS_PER_KEY - 1;
+        unsigned numVariations = GetNumKeyVariations(key, type);
+        if (variation >= numVariations)
+        {
+            // A key and type without voicings keeps variation 0.
+            variation = (numVariations != 0) ? numVariations - 1 : 0;
+        }
+        LoadChord(key, type, variation);
+    }
+
+    // Return the number of variations of a key and type.  Each key and type
+    // has its own count, the difference between its offset and the next one.
+    // The arguments must already be within range.
+    static unsigned GetNumVariations(unsigned key, unsigned type)
+    {
+        unsigned index = key * NUM_CHORD_TYPES + type;
+        return ChordStore::ReadVoicingOffset(index + 1) - ChordStore::ReadVoicingOffset(index);
+    }
+
+    // Return the number of variations of a key, as named with the capo on,
+    // and type, in the current tuning.  Other tunings count the voicings the
+    // synthesizer found, which may be none.  The arguments must already be
+    // within range.
+    unsigned GetNumKeyVariations(unsigned key, unsigned type) const;
+
+    // Return the index of a voicing within ChordShapeIds[] and ChordFrets[].
+    // The arguments must already be within range.
+    static unsigned GetVoicingIndex(unsigned key, unsigned type, unsigned variation)
+    {
+        return ChordStore::ReadVoicingOffset(key * NUM_CHORD_TYPES + type) + variation;
+    }
+
     bool NextChord();
     bool PreviousChord();    
     void NextKey(bool wrap = true);
@@ -133,22 +211,71 @@ public:
     void NextVariation(bool wrap = true);
     void PreviousVariation(bool wrap = true);
 
+    // Fetch the chord at a voicing index (see GetVoicingIndex()), such as one
+    // read from ChordDifficultyOrder[].
+    void GetChordAt(unsigned voicing);
+
+    // Select the tuning (see TuningType in ChordSynthesizer.h) and reload the
+    // current chord in it.
+    void SetTuning(unsigned tuning);
+    unsigned GetTuning()           const { return m_Tuning; }
+
+    // Set the capo's fret (0 for no capo, up to MAX_CAPO) and reload the
+    // current chord.  Keys are then named as they sound, and each shows the
+    // shape fingered behind the capo.
+    void SetCapo(unsigned capo);
+    unsigned GetCapo()             const { return m_Capo; }
+
     unsigned GetCurrentKey()       const { return m_CurrentKey; }
     unsigned GetCurrentType()      const { return m_CurrentType; }
     unsigned GetCurrentVariation() const { return m_CurrentVariation; }
-    uint8_t  GetCurrentFret()      const { return m_Chord.GetFret(); }
-    uint8_t  GetCurrentUnplayed()  const { return m_Chord.GetUnplayed(); }
-    uint8_t *GetChordPatternPtr()  const { return m_Chord.GetPatternPtr(); }
-    Chord   *GetChordPtr()         const { return const_cast<Chord *>(&m_Chord); }
+    uint8_t  GetCurrentFret()      const { return m_View.GetFret(); }
+    uint8_t  GetCurrentUnplayed()  const { return m_View.GetUnplayed(); }
+    uint8_t  GetCurrentDifficulty() const
+    {
+        return ChordStore::ReadDifficulty(GetCurrentVoicing());
+    }
+
+    // Return the voicing index of the current chord's shape.
+    unsigned GetCurrentVoicing() const
+    {
+        return GetVoicingIndex(GetShapeKey(m_CurrentKey), m_CurrentType, m_CurrentVariation);
+    }
+
+    // Return how many chords NextChord() steps through from the first chord to
+    // a voicing index.  With a capo on, the first chord is the shape of the
+    // key the capo raises to C, so the voicings are in a rotated order.
+    unsigned GetVoicingPosition(unsigned voicing) const
+    {
+        unsigned first = ChordStore::ReadVoicingOffset(GetShapeKey(0) * NUM_CHORD_TYPES);
+        return (voicing >= first) ? voicing - first :
+                                    voicing + ChordStore::GetNumVoicings() - first;
+    }
+    const ChordView &GetChordView() const { return m_View; }
     
 protected:
     
 private:
+    void LoadChord(unsigned key, unsigned type, unsigned variation);
+
+    // Return the key of the shape that sounds as the specified key when played
+    // behind the capo.
+    unsigned GetShapeKey(unsigned key) const
+    {
+        return (key >= m_Capo) ? key - m_Capo : key + NUM_KEYS - m_Capo;
+    }
 
-    unsigned m_CurrentKey;
-    unsigned m_CurrentType;
-    unsigned m_CurrentVariation;
-    Chord    m_Chord;
+    unsigned  m_CurrentKey;
+    unsigned  m_CurrentType;
+    unsigned  m_CurrentVariation;
+    unsigned  m_Tuning;
+    unsigned  m_Capo;                   // Capo fret, 0 for none.
+    ChordView m_View;
+    PackedVoicing m_Voicing;            // The current chord in an alternate tuning,
+                                        // or decoded from the delta stream.
+#if CHORD_DELTA_STREAM
+    ChordStreamCursor m_Cursor;         // Decodes the delta stream.
+#endif
 };
 
 
@@ -29,6 +29,8 @@
 #include "Display.h"            // For Display class.
 #include "ModeManager.h"        // For ModeManager class.
 #include "EepromConfig.h"       // For EepromConfig class.
+#include "ChordStore.h"         // For the difficulty order and the voice
+                                // leading graph.
 
 
 ChordFinderMode *ChordFinderMode::Instance()
@@ -53,45 +55,107 @@ uint32_t ChordFinderMode::Execute(uint32_t irKey)
         switch(irKey)
         {
         case NEXT_KEY:    //Next key of same type, variation 1.
+            m_DifficultyOrder = false;
             m_ChordData.NextKey();
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
         case PREV_KEY:    // Previous key of same type, variation 1.
+            m_DifficultyOrder = false;
             m_ChordData.PreviousKey();
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
         case PREV_TYPE:   // Previous type of same key, variation 1.
+            m_DifficultyOrder = false;
             m_ChordData.PreviousType();
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
         case NEXT_TYPE:   // Next type of same key, variation 1,
+            m_DifficultyOrder = false;
             m_ChordData.NextType();
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
         case FIRST_TYPE:  // First type of current key, variation 1.
+            m_DifficultyOrder = false;
             m_ChordData.GetChord(m_ChordData.GetCurrentKey(), 0, 0);
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
-        case PREV_VAR:    // Previous variation of current key and type.
-            m_ChordData.PreviousVariation();
-            pDisplay->DisplayChord(&m_ChordData);
+        case PREV_VAR:    // Previous variation of current key and type, or
+                          // the next easier chord when browsing by difficulty.
+            if (m_DifficultyOrder)
+            {
+                StepRank(false);
+            }
+            else
+            {
+                m_ChordData.PreviousVariation();
+            }
+            DisplayChord();
+            break;
+            
+        case NEXT_VAR:    // Next variation of current key and type, or the
+                          // next harder chord when browsing by difficulty.
+            if (m_DifficultyOrder)
+            {
+                StepRank(true);
+            }
+            else
+            {
+                m_ChordData.NextVariation();
+            }
+            DisplayChord();
+            break;
+            
+        case TOGGLE_ORDER: // Toggle browsing by difficulty, from the easiest chord.
+            m_DifficultyOrder ^= true;
+            if (m_DifficultyOrder)
+            {
+                m_Rank = 0;
+                m_ChordData.GetChordAt(ChordStore::ReadDifficultyOrder(m_Rank));
+            }
+            DisplayChord();
+            break;
+            
+        case HARDER:      // Raise or lower the hardest difficulty browsed.
+        case EASIER:
+            if (!m_DifficultyOrder)
+            {
+                returnedIrKey = irKey;
+                break;
+            }
+            if ((irKey == HARDER) && (m_MaxDifficulty < NUM_DIFFICULTY_LEVELS))
+            {
+                m_MaxDifficulty++;
+            }
+            else if ((irKey == EASIER) && (m_MaxDifficulty > 1))
+            {
+                m_MaxDifficulty--;
+            }
+            // Restart from the easiest chord if the current one is filtered out.
+            if (m_Rank >= GetRankLimit())
+            {
+                m_Rank = 0;
+                m_ChordData.GetChordAt(ChordStore::ReadDifficultyOrder(m_Rank));
+            }
+            DisplayChord();
             break;
             
-        case NEXT_VAR:    // Next variation of current key and type.
-            m_ChordData.NextVariation();
-            pDisplay->DisplayChord(&m_ChordData);
+        case CLOSEST:     // The chord of another key or type that is
+                          // closest to the current one under the fingers.
+            m_DifficultyOrder = false;
+            StepClosest();
+            DisplayChord();
             break;
             
         case TOGGLE_TYPE_DISPLAY: // Toggle chord type display type.
             m_VerboseDisplay ^= true;
             pAppConfig->m_Verbose = m_VerboseDisplay;
             pDisplay->SetVerbose(pAppConfig->m_Verbose);
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
         case NEXT_UNPLAYED_OPT: // Cycle through unplayed string options.
@@ -101,11 +165,11 @@ uint32_t ChordFinderMode::Execute(uint32_t irKey)
             }
             pAppConfig->m_UnplayedOption = unplayedOption;
             pDisplay->SetUnplayedOption(unplayedOption);
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
         case ModeManager::REFRESH:  // Just re-display the current chord.
-            pDisplay->DisplayChord(&m_ChordData);
+            DisplayChord();
             break;
             
         default:
@@ -118,4 +182,60 @@ uint32_t ChordFinderMode::Execute(uint32_t irKey)
     return returnedIrKey;
 }
 
+// Display the current chord, with its difficulty when browsing by difficulty.
+void ChordFinderMode::DisplayChord()
+{
+    Display::Instance()->DisplayChord(&m_ChordData, m_DifficultyOrder ? m_MaxDifficulty : 0);
+}
 
+// Return the number of chords at or below the hardest difficulty browsed.
+// ChordDifficultyOrder[] is sorted, so these are the first ranks.  The filter
+// is raised if no chord is easy enough.
+unsigned ChordFinderMode::GetRankLimit()
+{
+    unsigned limit = ChordStore::ReadDifficultyStart(m_MaxDifficulty + 1);
+    while ((limit == 0) && (m_MaxDifficulty < NUM_DIFFICULTY_LEVELS))
+    {
+        limit = ChordStore::ReadDifficultyStart(++m_MaxDifficulty + 1);
+    }
+    return limit;
+}
+
+// Step to the next or previous chord in difficulty order, wrapping within the
+// chords that pass the difficulty filter.
+// forward - true to step to a harder chord, false to step to an easier one.
+void ChordFinderMode::StepRank(bool forward)
+{
+    unsigned limit = GetRankLimit();
+    if (forward)
+    {
+        m_Rank = (m_Rank + 1 < limit) ? m_Rank + 1 : 0;
+    }
+    else
+    {
+        m_Rank = (m_Rank != 0) ? m_Rank - 1 : limit - 1;
+    }
+    m_ChordData.GetChordAt(ChordStore::ReadDifficultyOrder(m_Rank));
+}
+
+// Step to the next closest chord in the voice leading graph.  Pressing CLOSEST
+// again steps through the neighbors of the same chord, nearest first, until
+// another chord is selected.
+void ChordFinderMode::StepClosest()
+{
+    unsigned voicing = m_ChordData.GetCurrentVoicing();
+    if (voicing != m_LeadTo)
+    {
+        m_LeadFrom = voicing;
+        m_LeadRank = 0;
+    }
+    else if (++m_LeadRank >= CHORD_NEIGHBORS)
+    {
+        m_LeadRank = 0;
+    }
+    m_LeadTo = ChordStore::ReadNeighbor(m_LeadFrom, m_LeadRank);
+    m_ChordData.GetChordAt(m_LeadTo);
+}
+
+
+
@@ -46,11 +46,21 @@ public:
     virtual void     Startup()  { }
     virtual void     Shutdown() { }
     
+    // Select the tuning the chords are shown in.
+    void SetTuning(unsigned tuning) { m_ChordData.SetTuning(tuning); }
+    unsigned GetTuning() const      { return m_ChordData.GetTuning(); }
+    
+    // Select the fret of the capo, 0 for none.
+    void SetCapo(unsigned capo)     { m_ChordData.SetCapo(capo); }
+    unsigned GetCapo() const        { return m_ChordData.GetCapo(); }
+    
 protected:
     
 private:
     // Map raw IR keys to our specific use.
-    // Change mapping to suit your taste.
+    // Change mapping to suit your taste, but stay off the keys handled
+    // before any mode sees them: Vol +/- (LED brightness in
+    // GuitarChordChart.ino) and 1-5 (mode selection in ModeManager).
     static const uint32_t NEXT_KEY            = IrCodes::UP;       // Up
     static const uint32_t PREV_KEY            = IrCodes::DOWN;     // Down
     static const uint32_t PREV_TYPE           = IrCodes::LEFT;     // Left
@@ -60,20 +70,40 @@ private:
     static const uint32_t NEXT_VAR            = IrCodes::CH_UP;    // Channel Up
     static const uint32_t TOGGLE_TYPE_DISPLAY = IrCodes::INFO;     // Info
     static const uint32_t NEXT_UNPLAYED_OPT   = IrCodes::GUIDE;    // Guide
+    static const uint32_t TOGGLE_ORDER        = IrCodes::PLAY;     // Play
+    static const uint32_t HARDER              = IrCodes::PAUSE;    // Pause
+    static const uint32_t EASIER              = IrCodes::REWIND;   // Rewind
+    static const uint32_t CLOSEST             = IrCodes::FFWD;     // Ffwd
+
+    // m_LeadTo before any closest chord is shown.
+    static const unsigned NO_LEAD = (unsigned)-1;
     
     // Unimplemented methods
     ChordFinderMode(ChordFinderMode &rMgr);
     ChordFinderMode &operator=(ChordFinderMode &rMgr);
 
     // Private constructor and destructor for singleton.
-    ChordFinderMode() : m_ChordData(), m_VerboseDisplay(true)
+    ChordFinderMode() : m_ChordData(), m_VerboseDisplay(true), m_DifficultyOrder(false),
+                        m_Rank(0), m_MaxDifficulty(NUM_DIFFICULTY_LEVELS),
+                        m_LeadFrom(0), m_LeadTo(NO_LEAD), m_LeadRank(0)
     { 
         m_ChordData.GetChord(0, 0, 0);
     }
     ~ChordFinderMode() { }
     
+    void     DisplayChord();
+    unsigned GetRankLimit();
+    void     StepRank(bool forward);
+    void     StepClosest();
+    
     ChordChartData m_ChordData;
     bool           m_VerboseDisplay;
+    bool           m_DifficultyOrder;   // Browsing by difficulty.
+    unsigned       m_Rank;              // Rank in ChordDifficultyOrder[].
+    uint8_t        m_MaxDifficulty;     // Hardest level browsed.
+    unsigned       m_LeadFrom;          // Voicing the closest chords are to.
+    unsigned       m_LeadTo;            // Closest chord shown last.
+    uint8_t        m_LeadRank;          // Its rank among the closest chords.
 };
 
 
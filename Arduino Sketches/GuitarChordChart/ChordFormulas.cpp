@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordFormulas.cpp
+//
+// Contains the chord formula and tuning tables, and the methods of the
+// ChordFormulas class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordFormulas.h"
+
+
+// The note of each open string, high E first, for each tuning.  Notes count
+// semitones up from the C below the low E string, so C = 0 as a pitch class.
+static const uint8_t TuningNotes[NUM_TUNINGS][ChordFormulas::NUM_STRINGS] FORMULA_PROGMEM =
+{
+    { 28, 23, 19, 14,  9,  4 },                 // Standard: E A D G B E
+    { 28, 23, 19, 14,  9,  2 },                 // Drop D:   D A D G B E
+    { 26, 21, 19, 14,  9,  2 },                 // DADGAD:   D A D G A D
+    { 26, 23, 19, 14,  7,  2 }                  // Open G:   D G D G B D
+};
+
+// The pitch class of each note.
+static const uint8_t NotePitchClasses[ChordFormulas::NUM_NOTES] FORMULA_PROGMEM =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11
+};
+
+// Build an interval set.
+#define IV(n)   (1 << (n))
+
+// The intervals of each chord type that must be played.
+static const uint16_t RequiredIntervals[ChordFormulas::NUM_TYPES] FORMULA_PROGMEM =
+{
+    IV(0) | IV(4) | IV(7),                      // M
+    IV(0) | IV(3) | IV(7),                      // m
+    IV(0) | IV(4) | IV(9),                      // 6
+    IV(0) | IV(3) | IV(9),                      // m6
+    IV(0) | IV(4) | IV(10),                     // 7
+    IV(0) | IV(4) | IV(11),                     // M7
+    IV(0) | IV(3) | IV(10),                     // m7
+    IV(0) | IV(4) | IV(10) | IV(2),             // 9
+    IV(0) | IV(3) | IV(6) | IV(9),              // o
+    IV(0) | IV(4) | IV(8),                      // +
+    IV(0) | IV(2) | IV(7),                      // sus2
+    IV(0) | IV(2) | IV(10),                     // 7sus2
+    IV(0) | IV(5) | IV(7),                      // sus4
+    IV(0) | IV(5) | IV(10),                     // 7sus4
+    IV(0) | IV(7),                              // 5
+    IV(0) | IV(4) | IV(6),                      // -5
+    IV(0) | IV(4) | IV(6) | IV(10),             // 7b5
+    IV(0) | IV(3) | IV(6) | IV(10),             // m7b5
+    IV(0) | IV(4) | IV(8) | IV(10),             // 7#5
+    IV(0) | IV(4) | IV(10) | IV(1),             // 7b9
+    IV(0) | IV(4) | IV(10) | IV(3),             // 7#9
+    IV(0) | IV(4) | IV(8) | IV(10) | IV(1),     // 7b9#5
+    IV(0) | IV(4) | IV(9) | IV(10),             // 7/6
+    IV(0) | IV(4) | IV(6) | IV(10) | IV(2),     // 9b5
+    IV(0) | IV(4) | IV(8) | IV(10) | IV(2),     // 9#5
+    IV(0) | IV(4) | IV(11) | IV(2),             // M9
+    IV(0) | IV(3) | IV(10) | IV(2),             // m9
+    IV(0) | IV(4) | IV(9) | IV(2),              // 9/6
+    IV(0) | IV(3) | IV(9) | IV(2),              // m9/6
+    IV(0) | IV(4) | IV(7) | IV(2),              // add9
+    IV(0) | IV(10) | IV(2) | IV(5),             // 11
+    IV(0) | IV(3) | IV(10) | IV(5),             // m11
+    IV(0) | IV(4) | IV(10) | IV(6),             // 11+
+    IV(0) | IV(4) | IV(10) | IV(9),             // 13
+    IV(0) | IV(4) | IV(10) | IV(1) | IV(9),     // 13b9
+    IV(0) | IV(6) | IV(10) | IV(1) | IV(9)      // 13b9b5
+};
+
+// The intervals of each chord type that may be left out.
+static const uint16_t OptionalIntervals[ChordFormulas::NUM_TYPES] FORMULA_PROGMEM =
+{
+    0,              0,              IV(7),          IV(7),          // M, m, 6, m6
+    IV(7),          IV(7),          IV(7),          IV(7),          // 7, M7, m7, 9
+    0,              0,              0,              IV(7),          // o, +, sus2, 7sus2
+    0,              IV(7),          0,              0,              // sus4, 7sus4, 5, -5
+    0,              0,              0,              IV(7),          // 7b5, m7b5, 7#5, 7b9
+    IV(7),          0,              IV(7),          0,              // 7#9, 7b9#5, 7/6, 9b5
+    0,              IV(7),          IV(7),          IV(7),          // 9#5, M9, m9, 9/6
+    IV(7),          0,              IV(7),          IV(7) | IV(2),  // m9/6, add9, 11, m11
+    IV(7) | IV(2),  IV(7) | IV(2),  IV(7),          IV(4)           // 11+, 13, 13b9, 13b9b5
+};
+
+#undef IV
+
+
+uint16_t ChordFormulas::GetRequired(unsigned type)
+{
+    return FORMULA_READ_WORD(&RequiredIntervals[type]);
+}
+
+uint16_t ChordFormulas::GetOptional(unsigned type)
+{
+    return FORMULA_READ_WORD(&OptionalIntervals[type]);
+}
+
+uint8_t ChordFormulas::GetOpenNote(unsigned tuning, unsigned string)
+{
+    return FORMULA_READ_BYTE(&TuningNotes[tuning][string]);
+}
+
+uint8_t ChordFormulas::GetPitchClass(uint8_t note)
+{
+    // Notes above the table are out of the guitar's range, but fold them down
+    // rather than read past the end.
+    while (note >= NUM_NOTES)
+    {
+        note -= 12;
+    }
+    return FORMULA_READ_BYTE(&NotePitchClasses[note]);
+}
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordFormulas.h
+//
+// Defines the ChordFormulas class, which holds the intervals of each chord
+// type and the pitches of each supported tuning.  This file builds on the host
+// as well as the Arduino, so the host tools use the same formulas.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDFORMULAS_H
+#define CHORDFORMULAS_H
+
+#include <stdint.h>                 // For uintxx_t.
+#include "InstrumentProfile.h"      // For Instrument.
+
+// The tables are in PROGMEM on the Arduino, and in ordinary memory on the
+// host.
+#if defined(__AVR__)
+#include <avr/pgmspace.h>           // For PROGMEM and pgm_read_xxx().
+#define FORMULA_PROGMEM                 PROGMEM
+#define FORMULA_READ_BYTE(address)      pgm_read_byte(address)
+#define FORMULA_READ_WORD(address)      pgm_read_word(address)
+#else
+#define FORMULA_PROGMEM
+#define FORMULA_READ_BYTE(address)      (*(address))
+#define FORMULA_READ_WORD(address)      (*(address))
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// TuningType - enum of the supported tunings.  The stored chord table is for
+// standard tuning.  Chords for the other tunings are synthesized.
+/////////////////////////////////////////////////////////////////////////////////
+enum TuningType
+{
+    TuningStandard = 0,                     // E A D G B E
+    TuningDropD,                            // D A D G B E
+    TuningDadgad,                           // D A D G A D
+    TuningOpenG                             // D G D G B D
+};
+
+const unsigned NUM_TUNINGS = 4;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordFormulas class.  An interval set has bit n set for the note n
+// semitones above the root, so a chord's notes are a 12 bit set.  Chord types
+// are numbered as in ChordType (Strings.h).
+/////////////////////////////////////////////////////////////////////////////////
+class ChordFormulas
+{
+public:
+    // The intervals a voicing must play, and the ones it may leave out
+    // (usually the 5th).  The root is always required.
+    static uint16_t GetRequired(unsigned type);
+    static uint16_t GetOptional(unsigned type);
+    static uint16_t GetAllowed(unsigned type) { return GetRequired(type) | GetOptional(type); }
+
+    // Return the note of an open string, in semitones up from the C below the
+    // low E string.  String 0 is high E.
+    static uint8_t  GetOpenNote(unsigned tuning, unsigned string);
+
+    // Return the pitch class (C = 0) of a note, or of an open string.
+    static uint8_t  GetPitchClass(uint8_t note);
+    static uint8_t  GetOpenPitch(unsigned tuning, unsigned string)
+    {
+        return GetPitchClass(GetOpenNote(tuning, string));
+    }
+
+    // Chord types with a formula.  This is every type, even in the reduced
+    // library.
+    static const unsigned NUM_TYPES   = 36;
+    static const unsigned NUM_STRINGS = Instrument::NUM_STRINGS;
+
+    // Notes in the pitch class table: the open strings (up to 28) plus 15
+    // starting frets and a 5 fret pattern.
+    static const uint8_t  NUM_NOTES   = 48;
+
+protected:
+    
+private:
+    // Unimplemented methods.
+    ChordFormulas();
+};
+
+
+#endif // CHORDFORMULAS_H
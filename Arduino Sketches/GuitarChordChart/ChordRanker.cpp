@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordRanker.cpp
+//
+// Implements the ChordRanker class, which ranks chords by how near their
+// fingerboard patterns are to the one entered in the reverse chord finder.
+// This file builds on the host as well as the Arduino.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordRanker.h"
+
+
+void ChordRanker::Start(const Pattern &rTarget, uint8_t match)
+{
+    m_Match      = match;
+    m_NumResults = 0;
+
+    m_Target.m_Fret     = rTarget.m_Fret;
+    m_Target.m_Unplayed = rTarget.m_Unplayed & match;
+    m_TargetBits        = CountStrings(m_Target.m_Unplayed);
+    for (uint8_t row = 0; row < NUM_ROWS; row++)
+    {
+        m_Target.m_Rows[row] = rTarget.m_Rows[row] & match;
+        m_TargetBits += CountStrings(m_Target.m_Rows[row]);
+    }
+}
+
+
+// This method counts the LEDs the two patterns share rather than comparing
+// them LED by LED: the distance is the LEDs each lights less twice the ones
+// both light.  The rows are lined up by fret, so with a target fret a chord
+// starting a fret higher or lower only shares the rows that overlap.
+uint8_t ChordRanker::GetDistance(const Pattern &rPattern) const
+{
+    uint8_t unplayed = rPattern.m_Unplayed & m_Match;
+    uint8_t bits     = CountStrings(unplayed);
+    uint8_t shared   = CountStrings(unplayed & m_Target.m_Unplayed);
+
+    // Row n of the pattern is row n - shift of the target.
+    int8_t shift = (m_Target.m_Fret == 0) ? 0 : (int8_t)(m_Target.m_Fret - rPattern.m_Fret);
+    for (uint8_t row = 0; row < NUM_ROWS; row++)
+    {
+        uint8_t strings   = rPattern.m_Rows[row] & m_Match;
+        int8_t  targetRow = (int8_t)row - shift;
+        bits += CountStrings(strings);
+        if ((targetRow >= 0) && (targetRow < (int8_t)NUM_ROWS))
+        {
+            shared += CountStrings(strings & m_Target.m_Rows[targetRow]);
+        }
+    }
+    return m_TargetBits + bits - 2 * shared;
+}
+
+
+// This method keeps the nearest chords in a max-heap, so a chord is only
+// compared with the farthest one kept, and replacing it costs at most 3
+// levels of the heap.
+void ChordRanker::Add(uint16_t id, const Pattern &rPattern)
+{
+    Result result;
+    result.m_Id       = id;
+    result.m_Distance = GetDistance(rPattern);
+
+    if (m_NumResults < MAX_RESULTS)
+    {
+        // Not full yet.  Move the chord up past the nearer ones.
+        uint8_t index = m_NumResults++;
+        while (index != 0)
+        {
+            uint8_t parent = (index - 1) / 2;
+            if (!IsNearer(m_Results[parent], result))
+            {
+                break;
+            }
+            m_Results[index] = m_Results[parent];
+            index = parent;
+        }
+        m_Results[index] = result;
+    }
+    else if (IsNearer(result, m_Results[0]))
+    {
+        // Replace the farthest chord kept.
+        m_Results[0] = result;
+        SiftDown(0, m_NumResults);
+    }
+}
+
+
+// This method sorts the heap in place: the farthest chord is swapped to the
+// end and the heap shrinks past it.
+void ChordRanker::Finish()
+{
+    for (uint8_t size = m_NumResults; size > 1; size--)
+    {
+        Result farthest      = m_Results[0];
+        m_Results[0]         = m_Results[size - 1];
+        m_Results[size - 1]  = farthest;
+        SiftDown(0, size - 1);
+    }
+}
+
+
+// Move a result down the heap until the ones below it are nearer.
+void ChordRanker::SiftDown(uint8_t index, uint8_t size)
+{
+    Result result = m_Results[index];
+    for (;;)
+    {
+        uint8_t child = 2 * index + 1;
+        if (child >= size)
+        {
+            break;
+        }
+        if ((child + 1 < size) && IsNearer(m_Results[child], m_Results[child + 1]))
+        {
+            child++;
+        }
+        if (!IsNearer(result, m_Results[child]))
+        {
+            break;
+        }
+        m_Results[index] = m_Results[child];
+        index = child;
+    }
+    m_Results[index] = result;
+}
+
+
+// Return the number of strings in a string mask.  Each pass clears the
+// lowest string, so it loops once per string set.
+uint8_t ChordRanker::CountStrings(uint8_t strings)
+{
+    uint8_t count = 0;
+    for ( ; strings != 0; strings &= strings - 1)
+    {
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordRanker.h
+//
+// Defines the ChordRanker class, which ranks chords by how near their
+// fingerboard patterns are to the one entered in the reverse chord finder.
+// This file builds on the host as well as the Arduino.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDRANKER_H
+#define CHORDRANKER_H
+
+#include <stdint.h>                 // For uintxx_t.
+#include "InstrumentProfile.h"      // For Instrument.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordRanker class.  The distance between two patterns is the Hamming
+// distance between their LEDs: the strings held at each fret, plus the
+// unplayed strings, each a bit on the fingerboard.  Moving one finger to
+// another fret is 2, adding or lifting one is 1.  Only the strings in the
+// match mask are compared.  Each chord is scored as it is added, and the
+// nearest MAX_RESULTS are kept in a max-heap, so a pass over the whole chord
+// table needs no more RAM than the results.
+/////////////////////////////////////////////////////////////////////////////////
+class ChordRanker
+{
+public:
+    static const uint8_t NUM_ROWS    = Instrument::NUM_FRETS - 1;
+                                        // Frets a pattern may span.  The
+                                        // display's last fret is reserved
+                                        // for unplayed strings.
+    static const uint8_t MAX_RESULTS = 8;
+
+    // A fingerboard pattern.  The first row should have a string on it
+    // unless no string is fretted.
+    struct Pattern
+    {
+        uint8_t m_Fret;                 // Fret of the first row, 0 for any.
+        uint8_t m_Rows[NUM_ROWS];       // Strings held at each fret.
+        uint8_t m_Unplayed;             // Unplayed strings.
+    };
+
+    // A ranked chord.
+    struct Result
+    {
+        uint16_t m_Id;                  // Caller's id for the chord.
+        uint8_t  m_Distance;
+    };
+
+    ChordRanker() : m_Match(0), m_TargetBits(0), m_NumResults(0) { }
+
+    // Start a ranking.
+    // rTarget - Pattern to rank the chords against.  With a fret of 0 the
+    //           chords are compared wherever they start.
+    // match   - Strings compared.
+    void Start(const Pattern &rTarget, uint8_t match);
+
+    // Score a chord, and keep it if it is among the nearest so far.  Of
+    // chords at the same distance, the one with the lower id is kept.
+    void Add(uint16_t id, const Pattern &rPattern);
+
+    // Sort the chords kept, nearest first.  Call once, after the last Add().
+    void Finish();
+
+    uint8_t       GetNumResults() const          { return m_NumResults; }
+    const Result &GetResult(uint8_t rank) const  { return m_Results[rank]; }
+
+    // Return the distance of a pattern from the target.
+    uint8_t GetDistance(const Pattern &rPattern) const;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    ChordRanker(const ChordRanker &);
+    ChordRanker &operator=(const ChordRanker &);
+
+    void SiftDown(uint8_t index, uint8_t size);
+
+    static bool IsNearer(const Result &rA, const Result &rB)
+    {
+        return (rA.m_Distance < rB.m_Distance) ||
+               ((rA.m_Distance == rB.m_Distance) && (rA.m_Id < rB.m_Id));
+    }
+    static uint8_t CountStrings(uint8_t strings);
+
+    Pattern m_Target;                   // Masked by m_Match.
+    uint8_t m_Match;
+    uint8_t m_TargetBits;               // LEDs lit by the target.
+    Result  m_Results[MAX_RESULTS];     // A max-heap until Finish(), the
+                                        // farthest first.
+    uint8_t m_NumResults;
+};
+
+
+#endif // CHORDRANKER_H
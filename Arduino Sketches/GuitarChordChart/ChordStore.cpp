@@ -0,0 +1,332 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordStore.cpp
+//
+// Contains methods defined by the ChordStore class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordStore.h"
+
+#if CHORD_EXTERNAL_STORE
+
+#include "SpiFlashDevice.h"         // For SpiFlashDevice.
+
+// The SPI FLASH chip holding the chord table, the cache in front of it, and
+// the layout of the mounted chord pack.
+static SpiFlashDevice gChordFlash(CHORD_STORE_CS_PIN);
+PageCache ChordStore::m_Cache(&gChordFlash);
+ChordStore::Layout ChordStore::m_Layout;
+
+// The header is checked from the first block of the pack.
+static_assert(ChordStore::IMAGE_HEADER_SIZE <= BlockDevice::BLOCK_SIZE,
+              "The chord pack header must fit in one block.");
+
+
+// Update a CRC-32 with one byte.  The CRC is computed a bit at a time, which
+// is quick enough for a pack of a few KB and needs no table.
+static uint32_t UpdateCrc(uint32_t crc, uint8_t data)
+{
+    crc ^= data;
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+        crc = (crc >> 1) ^ (0xedb88320UL & (0UL - (crc & 1)));
+    }
+    return crc;
+}
+
+
+// Start the SPI FLASH chip and mount the chord pack at its start.
+bool ChordStore::Mount()
+{
+    gChordFlash.Initialize();
+    return Mount(&gChordFlash, 0);
+}
+
+
+// Mount the chord pack at the specified address of a block device.  Nothing
+// changes unless the whole pack is valid.
+bool ChordStore::Mount(BlockDevice *pDevice, uint32_t address)
+{
+    Layout layout;
+    if (!Validate(pDevice, address, layout))
+    {
+        return false;
+    }
+    m_Layout = layout;
+    m_Cache.SetDevice(pDevice);
+    return true;
+}
+
+
+// Check a chord pack header, and work out where each table is from its counts.
+// Returns true if the header is for a pack this build can read.
+// pHeader - The first IMAGE_HEADER_SIZE bytes of the pack.
+// address - Device address of the pack.
+bool ChordStore::ReadHeader(const uint8_t *pHeader, uint32_t address, Layout &rLayout)
+{
+    if ((pHeader[0] != 'G') || (pHeader[1] != 'C') ||
+        (pHeader[2] != 'C') || (pHeader[3] != 'T') ||
+        (pHeader[8] != NUM_KEYS) || (pHeader[9] != NUM_CHORD_TYPES) ||
+        (pHeader[10] == 0) || (pHeader[10] > MAX_CHORD_VARIATIONS) ||
+        (pHeader[11] != NUM_DIFFICULTY_LEVELS) ||
+        (pHeader[12] != IMAGE_VERSION) || (pHeader[13] != Instrument::NUM_STRINGS) ||
+        (pHeader[14] != CHORD_NEIGHBORS) || (pHeader[15] == 0) || (pHeader[15] > 15))
+    {
+        return false;
+    }
+
+    rLayout.m_NumVoicings      = pHeader[4] | ((uint16_t)pHeader[5] << 8);
+    rLayout.m_NumShapes        = pHeader[6] | ((uint16_t)pHeader[7] << 8);
+    rLayout.m_MaxVariations    = pHeader[10];
+    rLayout.m_Shapes           = address + IMAGE_HEADER_SIZE;
+    rLayout.m_ShapeIds         = rLayout.m_Shapes + (uint32_t)rLayout.m_NumShapes * CHORD_SHAPE_SIZE;
+    rLayout.m_Frets            = rLayout.m_ShapeIds + rLayout.m_NumVoicings;
+    rLayout.m_Offsets          = rLayout.m_Frets + (rLayout.m_NumVoicings + 1UL) / 2;
+    rLayout.m_Difficulty       = rLayout.m_Offsets +
+                                 (NUM_KEYS * NUM_CHORD_TYPES + 1UL) * sizeof(uint16_t);
+    rLayout.m_DifficultyOrder  = rLayout.m_Difficulty + rLayout.m_NumVoicings;
+    rLayout.m_DifficultyStarts = rLayout.m_DifficultyOrder +
+                                 (uint32_t)rLayout.m_NumVoicings * sizeof(uint16_t);
+    rLayout.m_Neighbors        = rLayout.m_DifficultyStarts +
+                                 (NUM_DIFFICULTY_LEVELS + 1UL) * sizeof(uint16_t);
+
+    // Each neighbor takes the fewest bits that hold any voicing index.
+    rLayout.m_NeighborBits = 1;
+    while ((1UL << rLayout.m_NeighborBits) < rLayout.m_NumVoicings)
+    {
+        rLayout.m_NeighborBits++;
+    }
+    rLayout.m_ReverseSlotBits  = pHeader[15];
+    rLayout.m_ReverseStarts    = rLayout.m_Neighbors +
+                                 ((uint32_t)rLayout.m_NumVoicings * CHORD_NEIGHBORS *
+                                  rLayout.m_NeighborBits + 7) / 8;
+    rLayout.m_ReverseVoicings  = rLayout.m_ReverseStarts +
+                                 ((1UL << rLayout.m_ReverseSlotBits) + 1) * sizeof(uint16_t);
+    rLayout.m_TransposeStarts  = rLayout.m_ReverseVoicings +
+                                 (uint32_t)rLayout.m_NumVoicings * sizeof(uint16_t);
+    rLayout.m_TransposeVoicings = rLayout.m_TransposeStarts +
+                                 ((1UL << rLayout.m_ReverseSlotBits) + 1) * sizeof(uint16_t);
+    rLayout.m_Postings         = rLayout.m_TransposeVoicings +
+                                 (uint32_t)rLayout.m_NumVoicings * sizeof(uint16_t);
+    rLayout.m_PostingBytes     = (rLayout.m_NumVoicings + 7) / 8;
+    rLayout.m_Crc              = rLayout.m_Postings +
+                                 (uint32_t)CHORD_POSTING_LISTS * rLayout.m_PostingBytes;
+
+    // Shape ids are one byte.
+    return (rLayout.m_NumVoicings != 0) && (rLayout.m_NumShapes != 0) &&
+           (rLayout.m_NumShapes <= 256);
+}
+
+
+// Check a whole chord pack in one pass over the device, reading each block
+// once: the header, the CRC, and that every index in the tables is in range,
+// so a bad pack can't send a read outside the tables.  Returns true, and the
+// pack's layout, if the pack is valid.
+// pDevice - Device holding the pack.
+// address - Device address of the pack, at the start of a block.
+bool ChordStore::Validate(BlockDevice *pDevice, uint32_t address, Layout &rLayout)
+{
+    uint8_t  block[BlockDevice::BLOCK_SIZE];
+    uint32_t crc     = 0xffffffffUL;
+    uint32_t packCrc = 0;
+    uint8_t  low     = 0;               // Low byte of the word being read.
+    uint16_t offset  = 0;               // Last voicing offset read.
+    uint32_t bits    = 0;               // Neighbor bits not yet checked.
+    uint8_t  numBits = 0;
+
+    if ((address % BlockDevice::BLOCK_SIZE != 0) ||
+        !pDevice->Read(address / BlockDevice::BLOCK_SIZE, block) ||
+        !ReadHeader(block, address, rLayout))
+    {
+        return false;
+    }
+
+    for (uint32_t at = address; at < rLayout.m_Crc + IMAGE_CRC_SIZE; at++)
+    {
+        // Read the next block when this one is used up.
+        uint8_t index = at % BlockDevice::BLOCK_SIZE;
+        if ((index == 0) && (at != address) &&
+            !pDevice->Read(at / BlockDevice::BLOCK_SIZE, block))
+        {
+            return false;
+        }
+        uint8_t data = block[index];
+
+        // The CRC is stored after the tables.
+        if (at >= rLayout.m_Crc)
+        {
+            packCrc |= (uint32_t)data << ((at - rLayout.m_Crc) * 8);
+            continue;
+        }
+        crc = UpdateCrc(crc, data);
+
+        // Check the tables that hold indexes.
+        if ((at >= rLayout.m_ShapeIds) && (at < rLayout.m_Frets))
+        {
+            // A shape id.
+            if (data >= rLayout.m_NumShapes)
+            {
+                return false;
+            }
+        }
+        else if ((at >= rLayout.m_Offsets) && (at < rLayout.m_Difficulty))
+        {
+            // The offsets of each key and type.  The first is 0, each key and
+            // type has 1 to m_MaxVariations variations, and the last is the
+            // number of voicings.
+            if (((at - rLayout.m_Offsets) & 1) == 0)
+            {
+                low = data;
+                continue;
+            }
+            uint16_t next = low | ((uint16_t)data << 8);
+            if ((at == rLayout.m_Offsets + 1) ? (next != 0) :
+                ((next <= offset) || (next - offset > rLayout.m_MaxVariations)))
+            {
+                return false;
+            }
+            offset = next;
+            if ((at == rLayout.m_Difficulty - 1) && (offset != rLayout.m_NumVoicings))
+            {
+                return false;
+            }
+        }
+        else if ((at >= rLayout.m_Difficulty) && (at < rLayout.m_DifficultyOrder))
+        {
+            // A difficulty level.
+            if ((data == 0) || (data > NUM_DIFFICULTY_LEVELS))
+            {
+                return false;
+            }
+        }
+        else if ((at >= rLayout.m_DifficultyOrder) && (at < rLayout.m_DifficultyStarts))
+        {
+            // A voicing index in difficulty order.
+            if (((at - rLayout.m_DifficultyOrder) & 1) == 0)
+            {
+                low = data;
+            }
+            else if ((low | ((uint16_t)data << 8)) >= rLayout.m_NumVoicings)
+            {
+                return false;
+            }
+        }
+        else if ((at >= rLayout.m_DifficultyStarts) && (at < rLayout.m_Neighbors))
+        {
+            // The rank where each difficulty level starts.
+            if (((at - rLayout.m_DifficultyStarts) & 1) == 0)
+            {
+                low = data;
+            }
+            else if ((low | ((uint16_t)data << 8)) > rLayout.m_NumVoicings)
+            {
+                return false;
+            }
+        }
+        else if ((at >= rLayout.m_Neighbors) && (at < rLayout.m_ReverseStarts))
+        {
+            // The packed neighbors, each a voicing index.  The padding in the
+            // last byte is 0, so it passes.
+            bits |= (uint32_t)data << numBits;
+            numBits += 8;
+            while (numBits >= rLayout.m_NeighborBits)
+            {
+                if ((bits & ((1UL << rLayout.m_NeighborBits) - 1)) >= rLayout.m_NumVoicings)
+                {
+                    return false;
+                }
+                bits >>= rLayout.m_NeighborBits;
+                numBits -= rLayout.m_NeighborBits;
+            }
+        }
+        else if (((at >= rLayout.m_ReverseStarts) && (at < rLayout.m_ReverseVoicings)) ||
+                 ((at >= rLayout.m_TransposeStarts) && (at < rLayout.m_TransposeVoicings)))
+        {
+            // The index of the first voicing of each reverse or transposition
+            // index slot.  Like the voicing offsets, the first is 0, they
+            // never go down, and the last is the number of voicings.
+            uint32_t starts   = (at < rLayout.m_ReverseVoicings) ? rLayout.m_ReverseStarts :
+                                                                   rLayout.m_TransposeStarts;
+            uint32_t voicings = (at < rLayout.m_ReverseVoicings) ? rLayout.m_ReverseVoicings :
+                                                                   rLayout.m_TransposeVoicings;
+            if (((at - starts) & 1) == 0)
+            {
+                low = data;
+                continue;
+            }
+            uint16_t next = low | ((uint16_t)data << 8);
+            if ((at == starts + 1) ? (next != 0) : (next < offset))
+            {
+                return false;
+            }
+            offset = next;
+            if ((at == voicings - 1) && (offset != rLayout.m_NumVoicings))
+            {
+                return false;
+            }
+        }
+        else if (((at >= rLayout.m_ReverseVoicings) && (at < rLayout.m_TransposeStarts)) ||
+                 ((at >= rLayout.m_TransposeVoicings) && (at < rLayout.m_Postings)))
+        {
+            // A voicing index in reverse or transposition index order.
+            uint32_t voicings = (at < rLayout.m_TransposeStarts) ? rLayout.m_ReverseVoicings :
+                                                                   rLayout.m_TransposeVoicings;
+            if (((at - voicings) & 1) == 0)
+            {
+                low = data;
+            }
+            else if ((low | ((uint16_t)data << 8)) >= rLayout.m_NumVoicings)
+            {
+                return false;
+            }
+        }
+    }
+
+    return ~crc == packCrc;
+}
+
+#else
+
+// The chord table is in PROGMEM, so there is nothing to do.
+bool ChordStore::Mount()
+{
+    return true;
+}
+
+#endif // CHORD_EXTERNAL_STORE
+
+
+// Unpack a neighbor from the voice leading graph.  A neighbor spans at most 3
+// bytes, and only the bytes it uses are read.
+uint16_t ChordStore::ReadNeighbor(unsigned voicing, uint8_t rank)
+{
+    uint8_t  numBits = GetNeighborBits();
+    uint32_t bit     = ((uint32_t)voicing * CHORD_NEIGHBORS + rank) * numBits;
+    uint32_t index   = bit / 8;
+    uint8_t  shift   = bit % 8;
+
+    uint32_t value = ReadNeighborByte(index);
+    for (uint8_t read = 8; read < shift + numBits; read += 8)
+    {
+        value |= (uint32_t)ReadNeighborByte(++index) << read;
+    }
+    return (value >> shift) & ((1UL << numBits) - 1);
+}
@@ -0,0 +1,236 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordStore.h
+//
+// Defines the ChordStore class, which reads the chord table from wherever
+// it is stored: PROGMEM, or an external SPI FLASH chip through a PageCache.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDSTORE_H
+#define CHORDSTORE_H
+
+#include "ChordTable.h"             // For the chord tables and their counts.
+#include "InstrumentProfile.h"      // For Instrument.
+#if CHORD_EXTERNAL_STORE
+#include "PageCache.h"              // For PageCache.
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordStore class.  All reads of the chord table go through this class.
+//
+// With CHORD_EXTERNAL_STORE the table is a chord pack on a block device,
+// normally the external SPI FLASH chip.  A pack (ChordTableFull.bin,
+// ChordTableReduced.bin, or one made with ChordTableCompiler --pack) holds
+// its own counts, so a new chord set only needs a new pack, not a new build.
+// A pack starts with a 16 byte header, followed by the same tables as
+// ChordTable.cpp, in the same order, and ends with a CRC:
+//
+//   0  "GCCT"              Magic.
+//   4  Voicings            uint16_t, little endian.
+//   6  Shapes              uint16_t, little endian.
+//   8  NUM_KEYS, NUM_CHORD_TYPES, most variations of any key and type,
+//      NUM_DIFFICULTY_LEVELS (1 byte each).
+//  12  IMAGE_VERSION, strings per voicing (see InstrumentProfile.h),
+//      CHORD_NEIGHBORS, and bits per reverse index slot number (1 byte each).
+//  16  ChordShapes[], ChordShapeIds[], ChordFrets[], ChordVoicingOffsets[]
+//      (the index of each key and type), ChordDifficulty[],
+//      ChordDifficultyOrder[], ChordDifficultyStarts[] (little endian), then
+//      ChordNeighbors[], packed with the fewest bits that hold any voicing
+//      index, ChordReverseStarts[], ChordReverseVoicings[],
+//      ChordTransposeStarts[], ChordTransposeVoicings[] and ChordPostings[].
+// End  CRC-32 (as zlib's crc32()) of all of the above, little endian.
+/////////////////////////////////////////////////////////////////////////////////
+class ChordStore
+{
+public:
+    // Get the chord table ready to read.  Returns false if the external store
+    // doesn't hold a valid chord pack for this build.
+    static bool Mount();
+
+#if CHORD_EXTERNAL_STORE
+    // Check the chord pack at the specified address of a block device, and
+    // read the chord table from it if it is valid.  The address must be at
+    // the start of a block.  Returns false, and keeps the current pack, if it
+    // isn't valid.  Chords already fetched by a ChordChartData must be
+    // fetched again.
+    static bool Mount(BlockDevice *pDevice, uint32_t address);
+
+    static uint16_t GetNumVoicings()               { return m_Layout.m_NumVoicings; }
+    static uint8_t  ReadShapeByte(unsigned index)  { return m_Cache.ReadByte(m_Layout.m_Shapes + index); }
+    static uint8_t  ReadShapeId(unsigned voicing)  { return m_Cache.ReadByte(m_Layout.m_ShapeIds + voicing); }
+    static uint8_t  ReadFrets(unsigned index)      { return m_Cache.ReadByte(m_Layout.m_Frets + index); }
+    static uint16_t ReadVoicingOffset(unsigned index)
+    {
+        return m_Cache.ReadWord(m_Layout.m_Offsets + index * sizeof(uint16_t));
+    }
+    static uint8_t  ReadDifficulty(unsigned voicing)
+    {
+        return m_Cache.ReadByte(m_Layout.m_Difficulty + voicing);
+    }
+    static uint16_t ReadDifficultyOrder(unsigned rank)
+    {
+        return m_Cache.ReadWord(m_Layout.m_DifficultyOrder + rank * sizeof(uint16_t));
+    }
+    static uint16_t ReadDifficultyStart(unsigned level)
+    {
+        return m_Cache.ReadWord(m_Layout.m_DifficultyStarts + (level - 1) * sizeof(uint16_t));
+    }
+    static uint8_t  ReadNeighborByte(uint32_t index) { return m_Cache.ReadByte(m_Layout.m_Neighbors + index); }
+    static uint8_t  GetNeighborBits()              { return m_Layout.m_NeighborBits; }
+#if CHORD_REVERSE_INDEX || CHORD_TRANSPOSE_INDEX
+    static uint8_t  GetReverseSlotBits()           { return m_Layout.m_ReverseSlotBits; }
+#endif
+#if CHORD_REVERSE_INDEX
+    static uint16_t ReadReverseStart(unsigned slot)
+    {
+        return m_Cache.ReadWord(m_Layout.m_ReverseStarts + slot * sizeof(uint16_t));
+    }
+    static uint16_t ReadReverseVoicing(unsigned index)
+    {
+        return m_Cache.ReadWord(m_Layout.m_ReverseVoicings + index * sizeof(uint16_t));
+    }
+#endif
+#if CHORD_TRANSPOSE_INDEX
+    static uint16_t ReadTransposeStart(unsigned slot)
+    {
+        return m_Cache.ReadWord(m_Layout.m_TransposeStarts + slot * sizeof(uint16_t));
+    }
+    static uint16_t ReadTransposeVoicing(unsigned index)
+    {
+        return m_Cache.ReadWord(m_Layout.m_TransposeVoicings + index * sizeof(uint16_t));
+    }
+#endif
+    static uint8_t  ReadPostingByte(uint8_t list, unsigned index)
+    {
+        return m_Cache.ReadByte(m_Layout.m_Postings + (uint32_t)list * m_Layout.m_PostingBytes + index);
+    }
+#else
+    static uint16_t GetNumVoicings()               { return NUM_CHORD_VOICINGS; }
+#if CHORD_DELTA_STREAM
+    static uint8_t  ReadStreamByte(unsigned index) { return CHORD_READ_BYTE(ChordStream, index); }
+    static uint16_t ReadKeyframe(unsigned keyframe)
+    {
+        return CHORD_READ_WORD(ChordStreamKeyframes, keyframe);
+    }
+#else
+    static uint8_t  ReadShapeByte(unsigned index)  { return CHORD_READ_BYTE(ChordShapes, index); }
+    static uint8_t  ReadShapeId(unsigned voicing)  { return CHORD_READ_BYTE(ChordShapeIds, voicing); }
+    static uint8_t  ReadFrets(unsigned index)      { return CHORD_READ_BYTE(ChordFrets, index); }
+#endif
+    static uint16_t ReadVoicingOffset(unsigned index)
+    {
+        return CHORD_READ_WORD(ChordVoicingOffsets, index);
+    }
+    static uint8_t  ReadDifficulty(unsigned voicing) { return CHORD_READ_BYTE(ChordDifficulty, voicing); }
+    static uint16_t ReadDifficultyOrder(unsigned rank)
+    {
+        return CHORD_READ_WORD(ChordDifficultyOrder, rank);
+    }
+    static uint16_t ReadDifficultyStart(unsigned level)
+    {
+        return CHORD_READ_WORD(ChordDifficultyStarts, level - 1);
+    }
+    static uint8_t  ReadNeighborByte(uint32_t index) { return CHORD_READ_BYTE(ChordNeighbors, index); }
+    static uint8_t  GetNeighborBits()              { return CHORD_NEIGHBOR_BITS; }
+#if CHORD_REVERSE_INDEX || CHORD_TRANSPOSE_INDEX
+    static uint8_t  GetReverseSlotBits()           { return CHORD_REVERSE_SLOT_BITS; }
+#endif
+#if CHORD_REVERSE_INDEX
+    static uint16_t ReadReverseStart(unsigned slot)
+    {
+        return CHORD_READ_WORD(ChordReverseStarts, slot);
+    }
+    static uint16_t ReadReverseVoicing(unsigned index)
+    {
+        return CHORD_READ_WORD(ChordReverseVoicings, index);
+    }
+#endif
+#if CHORD_TRANSPOSE_INDEX
+    static uint16_t ReadTransposeStart(unsigned slot)
+    {
+        return CHORD_READ_WORD(ChordTransposeStarts, slot);
+    }
+    static uint16_t ReadTransposeVoicing(unsigned index)
+    {
+        return CHORD_READ_WORD(ChordTransposeVoicings, index);
+    }
+#endif
+    static uint8_t  ReadPostingByte(uint8_t list, unsigned index)
+    {
+        return CHORD_READ_BYTE(ChordPostings, list * CHORD_POSTING_BYTES + index);
+    }
+#endif
+
+    // Return the voicing index of a voicing's neighbor in the voice leading
+    // graph.  Rank 0 is the nearest.
+    static uint16_t ReadNeighbor(unsigned voicing, uint8_t rank);
+
+    // Chord pack format.
+    static const uint8_t  IMAGE_VERSION     = 9;
+    static const uint32_t IMAGE_HEADER_SIZE = 16;
+    static const uint32_t IMAGE_CRC_SIZE    = 4;
+
+protected:
+    
+private:
+    // Unimplemented methods.
+    ChordStore();
+
+#if CHORD_EXTERNAL_STORE
+    /////////////////////////////////////////////////////////////////////////////
+    // Layout structure.  The counts of a chord pack, and the device address of
+    // each of its tables.
+    /////////////////////////////////////////////////////////////////////////////
+    struct Layout
+    {
+        uint16_t m_NumVoicings;
+        uint16_t m_NumShapes;
+        uint8_t  m_MaxVariations;
+        uint32_t m_Shapes;
+        uint32_t m_ShapeIds;
+        uint32_t m_Frets;
+        uint32_t m_Offsets;
+        uint32_t m_Difficulty;
+        uint32_t m_DifficultyOrder;
+        uint32_t m_DifficultyStarts;
+        uint32_t m_Neighbors;
+        uint8_t  m_NeighborBits;
+        uint8_t  m_ReverseSlotBits;
+        uint32_t m_ReverseStarts;
+        uint32_t m_ReverseVoicings;
+        uint32_t m_TransposeStarts;     // The same slots as the reverse index.
+        uint32_t m_TransposeVoicings;
+        uint32_t m_Postings;
+        uint16_t m_PostingBytes;        // Bytes per posting list.
+        uint32_t m_Crc;                 // Address of the CRC, the end of the tables.
+    };
+
+    static bool Validate(BlockDevice *pDevice, uint32_t address, Layout &rLayout);
+    static bool ReadHeader(const uint8_t *pHeader, uint32_t address, Layout &rLayout);
+
+    static PageCache m_Cache;
+    static Layout    m_Layout;
+#endif
+};
+
+
+#endif // CHORDSTORE_H
@@ -0,0 +1,129 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordStream.cpp
+//
+// Implements the ChordStreamCursor class, which decodes the delta encoded chord
+// stream one voicing at a time.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordStream.h"
+#include "ChordChartData.h"     // For PackedVoicing and PackedShape.
+#include "ChordStore.h"         // For reading the stream.
+
+#if CHORD_DELTA_STREAM
+
+
+// This method moves the cursor to a voicing and copies the voicing out.
+// Voicings still in the history are copied without reading the stream, and
+// voicings later in the head's keyframe interval are decoded from the head.
+// index    - Index of the voicing, less than NUM_CHORD_VOICINGS.
+// rVoicing - Receives the voicing.
+void ChordStreamCursor::Seek(unsigned index, PackedVoicing &rVoicing)
+{
+    bool inHistory = (m_Head != NO_VOICING) && (index <= m_Head) && (index >= m_Oldest) &&
+                     (index + NUM_REFERENCES > m_Head);
+    bool ahead     = (m_Head != NO_VOICING) && (index > m_Head) &&
+                     (index / CHORD_KEYFRAME_INTERVAL == (m_Head + 1u) / CHORD_KEYFRAME_INTERVAL);
+    if (!inHistory && !ahead)
+    {
+        // Jump to the keyframe before the voicing.
+        m_Oldest = index - index % CHORD_KEYFRAME_INTERVAL;
+        m_Head   = m_Oldest - 1;
+    }
+    while (!inHistory && (m_Head != index))
+    {
+        Step();
+    }
+
+    uint32_t voicing = m_History[index % NUM_REFERENCES];
+    rVoicing.m_Shape[0] = (uint8_t)voicing;
+    rVoicing.m_Shape[1] = (uint8_t)(voicing >> 8);
+    rVoicing.m_Shape[2] = (uint8_t)(voicing >> 16);
+    rVoicing.m_Fret     = (uint8_t)(voicing >> FRET_SHIFT);
+}
+
+
+// This method decodes the voicing after the head, and makes it the head.
+void ChordStreamCursor::Step()
+{
+    uint16_t next = m_Head + 1;
+    uint32_t voicing;
+    uint8_t  changed;
+    
+    if (next % CHORD_KEYFRAME_INTERVAL == 0)
+    {
+        // A keyframe holds every string and the fret.
+        m_Bit   = (uint32_t)ChordStore::ReadKeyframe(next / CHORD_KEYFRAME_INTERVAL) * 8;
+        voicing = 0;
+        changed = Instrument::ALL_STRINGS;
+    }
+    else
+    {
+        // A delta holds what changed from its reference.
+        uint8_t reference = ReadBits(REFERENCE_BITS);
+        voicing = m_History[(next - 1 - reference) % NUM_REFERENCES];
+        changed = ReadBits(NUM_CHORD_STRINGS);
+        if (ReadBits(1))
+        {
+            voicing = (voicing & ~((uint32_t)0xff << FRET_SHIFT)) |
+                      ((uint32_t)ReadBits(FRET_BITS) << FRET_SHIFT);
+        }
+    }
+
+    for (uint8_t string = 0; changed != 0; string++, changed >>= 1)
+    {
+        if (changed & 1)
+        {
+            uint8_t shift = string * PackedShape::PACKED_BITS_PER_STRING;
+            voicing = (voicing & ~((uint32_t)PackedShape::PACKED_STRING_MASK << shift)) |
+                      ((uint32_t)ReadBits(VALUE_BITS) << shift);
+        }
+    }
+    
+    if (next % CHORD_KEYFRAME_INTERVAL == 0)
+    {
+        voicing |= (uint32_t)ReadBits(FRET_BITS) << FRET_SHIFT;
+    }
+    m_History[next % NUM_REFERENCES] = voicing;
+    m_Head = next;
+}
+
+
+// This method reads the next bits of the stream, least significant first.
+// count - Bits to read, up to 8.
+uint8_t ChordStreamCursor::ReadBits(uint8_t count)
+{
+    uint16_t offset = (uint16_t)(m_Bit >> 3);
+    uint8_t  shift  = m_Bit & 7;
+    uint16_t bits   = ChordStore::ReadStreamByte(offset);
+    
+    // Only read the next byte if the bits cross into it, so the last record
+    // doesn't read past the end of the stream.
+    if (shift + count > 8)
+    {
+        bits |= (uint16_t)ChordStore::ReadStreamByte(offset + 1) << 8;
+    }
+    m_Bit += count;
+    return (bits >> shift) & ((1 << count) - 1);
+}
+
+
+#endif // CHORD_DELTA_STREAM
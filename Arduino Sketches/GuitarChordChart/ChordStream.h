@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordStream.h
+//
+// Defines the ChordStreamCursor class, which decodes the delta encoded chord
+// stream one voicing at a time.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDSTREAM_H
+#define CHORDSTREAM_H
+
+#include "ChordTable.h"             // For the stream's counts.
+
+struct PackedVoicing;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordStreamCursor class.  With CHORD_DELTA_STREAM the voicings are stored as
+// a bit stream in voicing index order (ChordStream[]).  Every
+// CHORD_KEYFRAME_INTERVAL'th voicing is a keyframe, stored whole at the byte
+// offset ChordStreamKeyframes[] gives.  Every other voicing is stored as its
+// changes from one of the NUM_REFERENCES voicings before it in the same
+// keyframe interval.  Bits are read least significant first:
+//
+//   Keyframe:  Packed value of each string (3 bits, high E first), then the
+//              starting fret (4 bits).
+//   Delta:     Reference, 0 for the previous voicing (2 bits).  Strings whose
+//              value differs from the reference (1 bit each, high E first).
+//              Starting fret differs (1 bit).  Then the starting fret (4 bits)
+//              if it differs, and the value of each string that differs
+//              (3 bits each).
+//
+// The cursor keeps the voicings it decoded last, so stepping to the next
+// voicing decodes a single delta, and stepping back to one of the last
+// NUM_REFERENCES voicings reads nothing at all.  Any other voicing is decoded
+// from the keyframe before it.
+/////////////////////////////////////////////////////////////////////////////////
+class ChordStreamCursor
+{
+public:
+    ChordStreamCursor() : m_Head(NO_VOICING), m_Oldest(0), m_Bit(0) { }
+
+    // Move to a voicing and copy it out.
+    // index     - Index of the voicing, less than NUM_CHORD_VOICINGS.
+    // rVoicing  - Receives the voicing.
+    void Seek(unsigned index, PackedVoicing &rVoicing);
+
+    // Stream format, see above.
+    static const uint8_t NUM_REFERENCES  = 4;
+    static const uint8_t REFERENCE_BITS  = 2;
+    static const uint8_t VALUE_BITS      = 3;
+    static const uint8_t FRET_BITS       = 4;
+
+protected:
+    
+private:
+    void    Step();
+    uint8_t ReadBits(uint8_t count);
+
+    // A decoded voicing: its packed shape, and its starting fret in the top byte.
+    static const uint8_t  FRET_SHIFT = 24;
+    static const uint16_t NO_VOICING = 0xffff;
+
+    uint16_t m_Head;                    // Last voicing decoded, or NO_VOICING.
+    uint16_t m_Oldest;                  // Oldest voicing decoded since the last jump.
+    uint32_t m_Bit;                     // Stream bit after the head's record.
+    uint32_t m_History[NUM_REFERENCES]; // The last voicings decoded, voicing n in
+                                        // m_History[n % NUM_REFERENCES].
+};
+
+
+#endif // CHORDSTREAM_H
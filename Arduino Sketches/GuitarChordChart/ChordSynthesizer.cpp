@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordSynthesizer.cpp
+//
+// Contains methods and data used by the ChordSynthesizer class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordSynthesizer.h"
+
+
+// The enumerator packs voicings the same way as the chord table.
+static_assert((VoicingEnumerator::VALUE_OPEN == PackedShape::PACKED_OPEN) &&
+              (VoicingEnumerator::VALUE_UNPLAYED == PackedShape::PACKED_UNPLAYED) &&
+              (VoicingEnumerator::BITS_PER_STRING == PackedShape::PACKED_BITS_PER_STRING) &&
+              (VoicingEnumerator::NUM_STRINGS == NUM_CHORD_STRINGS) &&
+              (VoicingEnumerator::NUM_ROWS == NUM_CHORD_FRETS - 1),
+              "VoicingEnumerator doesn't match PackedShape.");
+
+
+// Return a pointer to our singleton instance.
+ChordSynthesizer *ChordSynthesizer::Instance()
+{
+    static ChordSynthesizer instance;
+    return &instance;
+}
+
+// Start with an empty cache.  The standard tuning is never synthesized, so it
+// marks an unused entry.
+ChordSynthesizer::ChordSynthesizer()
+{
+    for (uint8_t i = 0; i < NUM_CACHE_ENTRIES; i++)
+    {
+        m_Cache[i].m_Tuning = TuningStandard;
+        m_Cache[i].m_Age    = i;
+    }
+}
+
+
+// Return the requested voicing, from the cache if possible.
+const PackedVoicing *ChordSynthesizer::GetVoicing(unsigned tuning, unsigned key,
+                                                  unsigned type, unsigned variation)
+{
+    CacheEntry *pEntry = GetEntry(tuning, key, type);
+
+    // Only NUM_VARIATIONS are kept per entry; show the last for any past it.
+    if (variation >= NUM_VARIATIONS)
+    {
+        variation = NUM_VARIATIONS - 1;
+    }
+    return &pEntry->m_Voicings[variation];
+}
+
+
+// Return the number of playable variations synthesized for the chord.
+unsigned ChordSynthesizer::GetNumVariations(unsigned tuning, unsigned key, unsigned type)
+{
+    return GetEntry(tuning, key, type)->m_NumVoicings;
+}
+
+
+// Return the cache entry of the chord, synthesizing it into the least recently
+// used entry if it isn't cached, and make it the most recently used.
+ChordSynthesizer::CacheEntry *ChordSynthesizer::GetEntry(unsigned tuning, unsigned key,
+                                                         unsigned type)
+{
+    // Look for the chord in the cache, and find the least recently used entry
+    // in case it isn't there.
+    CacheEntry *pEntry  = NULL;
+    CacheEntry *pOldest = &m_Cache[0];
+    for (uint8_t i = 0; i < NUM_CACHE_ENTRIES; i++)
+    {
+        CacheEntry *pCandidate = &m_Cache[i];
+        if ((pCandidate->m_Tuning == tuning) && (pCandidate->m_Key == key) &&
+            (pCandidate->m_Type == type))
+        {
+            pEntry = pCandidate;
+        }
+        if (pCandidate->m_Age > pOldest->m_Age)
+        {
+            pOldest = pCandidate;
+        }
+    }
+
+    // It's not cached, so synthesize it into the oldest entry.
+    if (pEntry == NULL)
+    {
+        pEntry           = pOldest;
+        pEntry->m_Tuning = tuning;
+        pEntry->m_Key    = key;
+        pEntry->m_Type   = type;
+        Synthesize(pEntry);
+    }
+
+    // Make the entry the most recently used.
+    for (uint8_t i = 0; i < NUM_CACHE_ENTRIES; i++)
+    {
+        if (m_Cache[i].m_Age < pEntry->m_Age)
+        {
+            m_Cache[i].m_Age++;
+        }
+    }
+    pEntry->m_Age = 0;
+    return pEntry;
+}
+
+
+// Find the best voicings of the entry's chord.  Each starting fret is
+// searched for its best voicing, and the best starting frets become the
+// variations, lowest fret first.
+void ChordSynthesizer::Synthesize(CacheEntry *pEntry)
+{
+    uint8_t bestScores[NUM_VARIATIONS];
+    uint8_t found = 0;
+    uint8_t pitches[NUM_CHORD_STRINGS];
+
+    // Set up the search.
+    for (uint8_t string = 0; string < NUM_CHORD_STRINGS; string++)
+    {
+        pitches[string] = ChordFormulas::GetOpenPitch(pEntry->m_Tuning, string);
+    }
+    m_Enumerator.SetChord(pitches, pEntry->m_Key, ChordFormulas::GetRequired(pEntry->m_Type),
+                          ChordFormulas::GetAllowed(pEntry->m_Type));
+
+    for (uint8_t fret = 1; fret <= VoicingEnumerator::MAX_BASE_FRET; fret++)
+    {
+        m_Best.m_Score = NO_SCORE;
+        m_Enumerator.Enumerate(fret, this);
+        if (m_Best.m_Score == NO_SCORE)
+        {
+            continue;
+        }
+
+        // Insert this starting fret into the best ones found so far, or replace
+        // the worst of them.
+        uint8_t slot = found;
+        if (found == NUM_VARIATIONS)
+        {
+            slot = 0;
+            for (uint8_t i = 1; i < NUM_VARIATIONS; i++)
+            {
+                if (bestScores[i] > bestScores[slot])
+                {
+                    slot = i;
+                }
+            }
+            if (m_Best.m_Score >= bestScores[slot])
+            {
+                continue;
+            }
+
+            // Keep the variations in fret order.
+            for (uint8_t i = slot; i + 1 < NUM_VARIATIONS; i++)
+            {
+                bestScores[i]         = bestScores[i + 1];
+                pEntry->m_Voicings[i] = pEntry->m_Voicings[i + 1];
+            }
+            slot = NUM_VARIATIONS - 1;
+        }
+        else
+        {
+            found++;
+        }
+
+        PackedVoicing *pVoicing = &pEntry->m_Voicings[slot];
+        bestScores[slot] = m_Best.m_Score;
+        pVoicing->m_Fret = fret;
+        for (uint8_t i = 0; i < PackedShape::PACKED_SIZE; i++)
+        {
+            pVoicing->m_Shape[i] = (uint8_t)(m_Best.m_Shape >> (i * 8));
+        }
+    }
+
+    // Fill any variations that weren't found with an unplayable chord.
+    pEntry->m_NumVoicings = found;
+    for (uint8_t i = found; i < NUM_VARIATIONS; i++)
+    {
+        pEntry->m_Voicings[i].m_Fret = 1;
+        for (uint8_t j = 0; j < PackedShape::PACKED_SIZE; j++)
+        {
+            pEntry->m_Voicings[i].m_Shape[j] = 0xff;
+        }
+    }
+}
+
+
+// Keep the best voicing found at the starting fret being searched.
+void ChordSynthesizer::Visit(const VoicingEnumerator::Voicing &rVoicing)
+{
+    if (rVoicing.m_Score < m_Best.m_Score)
+    {
+        m_Best = rVoicing;
+    }
+}
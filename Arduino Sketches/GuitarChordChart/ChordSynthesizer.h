@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordSynthesizer.h
+//
+// Defines the ChordSynthesizer class, which builds chord voicings for
+// alternate tunings from the interval formula of each chord type.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDSYNTHESIZER_H
+#define CHORDSYNTHESIZER_H
+
+#include "ChordChartData.h"     // For PackedVoicing and the chord counts.
+#include "ChordFormulas.h"      // For TuningType and the chord formulas.
+#include "VoicingEnumerator.h"  // For VoicingEnumerator.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordSynthesizer class.  Uses a VoicingEnumerator to search the fingerboard
+// for playable voicings of the requested key and type with the root in the
+// bass.  The best voicings of each (tuning, key, type) are kept in a small LRU
+// cache, so browsing back and forth only searches once.
+/////////////////////////////////////////////////////////////////////////////////
+class ChordSynthesizer : private VoicingEnumerator::Visitor
+{
+public:
+    static ChordSynthesizer *Instance();
+
+    // Return a voicing of the specified chord in the specified tuning.  The
+    // arguments must already be within range.  The voicing stays valid until
+    // the next call.  A chord that can't be played in the tuning is returned
+    // with every string unplayed.
+    const PackedVoicing *GetVoicing(unsigned tuning, unsigned key, unsigned type,
+                                    unsigned variation);
+
+    // Return the number of playable variations of the specified chord in the
+    // specified tuning, which may be 0.  The arguments must already be within
+    // range.
+    unsigned GetNumVariations(unsigned tuning, unsigned key, unsigned type);
+
+    // Synthesized variations per chord.  This is the most variations of any
+    // key and type in the stored chord table.
+    static const uint8_t NUM_VARIATIONS = MAX_CHORD_VARIATIONS;
+
+    // Number of chords in the cache.
+    static const uint8_t NUM_CACHE_ENTRIES = 8;
+
+protected:
+    
+private:
+    // Unimplemented methods.
+    ChordSynthesizer(const ChordSynthesizer &);
+    ChordSynthesizer &operator=(const ChordSynthesizer &);
+
+    // Private constructor and destructor for singleton.
+    ChordSynthesizer();
+    ~ChordSynthesizer() { }
+
+    // The synthesized variations of one chord.
+    struct CacheEntry
+    {
+        uint8_t       m_Tuning;
+        uint8_t       m_Key;
+        uint8_t       m_Type;
+        uint8_t       m_Age;                // 0 = most recently used.
+        uint8_t       m_NumVoicings;        // Playable variations found.
+        PackedVoicing m_Voicings[NUM_VARIATIONS];
+    };
+
+    CacheEntry  *GetEntry(unsigned tuning, unsigned key, unsigned type);
+    void         Synthesize(CacheEntry *pEntry);
+    virtual void Visit(const VoicingEnumerator::Voicing &rVoicing);
+
+    static const uint8_t NO_SCORE = 0xff;
+
+    CacheEntry        m_Cache[NUM_CACHE_ENTRIES];
+    VoicingEnumerator m_Enumerator;
+    VoicingEnumerator::Voicing m_Best;      // Best voicing at the fret being searched.
+};
+
+
+#endif // CHORDSYNTHESIZER_H
@@ -0,0 +1,2569 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordTable.cpp
+//
+// Contains the packed chord tables stored in FLASH.
+//
+// THIS FILE IS GENERATED by ChordTableCompiler from ChordTable.txt.  Do not
+// edit it by hand.  Edit ChordTable.txt and re-run the compiler instead.
+//
+// Copyright (C) 2015-2016 Joseph M. Corbett
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordChartData.h"     // For PACK_SHAPE() and PACK_FRETS().
+
+
+// Each PACK_SHAPE() lists the fret offset of each string from low E to
+// high E.  0 is an open string, and X is an unplayed string.  Each shape is
+// commented with the first chord that uses it.
+#define X PackedShape::PACKED_UNPLAYED
+
+#if !CHORD_EXTERNAL_STORE
+#if FULL_CHORD_LIBRARY
+
+#if CHORD_DELTA_STREAM
+
+// The delta encoded voicings of the full chord library.
+const uint8_t ChordStream[CHORD_STREAM_SIZE] CHORD_PROGMEM =
+{
+    0x08, 0xb4, 0x05, 0xff, 0xc9, 0xb6, 0x24, 0xd0, 0xc9, 0x2c, 0x57, 0xa0, 0x78, 0x12, 0x60, 0xbd,
+    0x92, 0x71, 0x08, 0x8c, 0x93, 0xfe, 0x6b, 0xd8, 0xb6, 0x7e, 0xb6, 0x24, 0xd0, 0xf1, 0x0b, 0x10,
+    0x49, 0x82, 0x4c, 0x2c, 0x19, 0x14, 0x92, 0x22, 0x09, 0xf6, 0x4a, 0xf2, 0x5e, 0x59, 0x76, 0xc0,
+    0x18, 0xb3, 0x71, 0x0d, 0x70, 0x71, 0xeb, 0x64, 0x69, 0x43, 0x26, 0x11, 0x52, 0x40, 0x2b, 0x18,
+    0xc9, 0xb8, 0x74, 0xf8, 0x13, 0x22, 0x31, 0xb6, 0x2f, 0xff, 0x07, 0x21, 0xa3, 0x0b, 0xff, 0x7b,
+    0xc6, 0x08, 0xf7, 0x2c, 0xba, 0x67, 0xfc, 0x95, 0x04, 0x8a, 0x90, 0x13, 0xe2, 0x93, 0x88, 0xcc,
+    0x45, 0xd1, 0x9b, 0x28, 0x6b, 0xf0, 0x15, 0xe0, 0x81, 0x71, 0xb6, 0x30, 0xcb, 0x3b, 0xcb, 0xf2,
+    0x20, 0x03, 0x91, 0xa2, 0x0b, 0xff, 0x53, 0xa2, 0x08, 0x70, 0xb1, 0xc1, 0x57, 0x62, 0x21, 0xce,
+    0xe1, 0xb9, 0xc6, 0xb7, 0x09, 0xc7, 0xc5, 0xa9, 0x48, 0x1a, 0x5e, 0xe1, 0x04, 0x65, 0x20, 0x0d,
+    0x70, 0x39, 0x8b, 0x47, 0x3a, 0x09, 0x65, 0xdc, 0x02, 0x51, 0x92, 0x0f, 0x62, 0x4c, 0x52, 0x4c,
+    0x51, 0xa4, 0x12, 0xdb, 0xe8, 0x22, 0x0d, 0x0b, 0xff, 0x44, 0xbb, 0x7a, 0x93, 0xbe, 0x28, 0x57,
+    0xf8, 0x18, 0x83, 0x95, 0xb6, 0x1c, 0x0e, 0x3c, 0x81, 0x8e, 0x30, 0xec, 0x2d, 0xc9, 0x08, 0x50,
+    0x94, 0x07, 0x5f, 0x59, 0x94, 0xc1, 0x99, 0xee, 0x9a, 0xb2, 0x05, 0x69, 0x84, 0x11, 0xd4, 0x0a,
+    0xd0, 0xf9, 0xca, 0xb2, 0x8c, 0xfb, 0x48, 0x92, 0xaa, 0x9a, 0x92, 0x5e, 0x59, 0x76, 0xc0, 0x19,
+    0xb3, 0x72, 0x0d, 0xb0, 0x71, 0x2b, 0x65, 0x69, 0x43, 0x26, 0x49, 0x96, 0x13, 0x6b, 0x13, 0xc3,
+    0x1c, 0x5c, 0x24, 0xe7, 0xd2, 0xe1, 0x4f, 0x88, 0xc4, 0xd8, 0xbe, 0xfc, 0x9f, 0xf6, 0x21, 0x75,
+    0xd5, 0x18, 0x6a, 0xc7, 0xa2, 0x39, 0x8a, 0x12, 0x28, 0x42, 0x4e, 0x88, 0x4f, 0x22, 0x02, 0x8a,
+    0xa2, 0x0f, 0xf0, 0x5c, 0x1a, 0x7c, 0x05, 0x78, 0x60, 0x9c, 0x2f, 0xcc, 0xf2, 0xd2, 0xb2, 0x3c,
+    0xc8, 0x1e, 0x44, 0xae, 0x51, 0x91, 0x00, 0x1b, 0x1b, 0x7c, 0x5b, 0x23, 0xa1, 0x89, 0xa5, 0xab,
+    0x7c, 0x5b, 0xf0, 0x5c, 0x00, 0x52, 0xa2, 0x0f, 0x73, 0x4b, 0xc2, 0xae, 0xf2, 0x69, 0x19, 0xc8,
+    0xa3, 0x11, 0x1e, 0x20, 0x61, 0xca, 0x29, 0xe7, 0x96, 0x04, 0xaa, 0x90, 0xa4, 0x98, 0xa2, 0x48,
+    0x25, 0xb6, 0xd1, 0x46, 0x1a, 0x1e, 0xfe, 0x89, 0x76, 0x51, 0xf4, 0x1d, 0xff, 0xd4, 0x1e, 0x25,
+    0xbc, 0x00, 0xc1, 0x5b, 0xdb, 0x12, 0xec, 0xd7, 0x18, 0x93, 0x02, 0x05, 0xfb, 0x97, 0x01, 0xb1,
+    0x28, 0x4c, 0xc4, 0xd0, 0xdb, 0x59, 0xb2, 0x46, 0x8a, 0xe2, 0x4c, 0x0f, 0xf6, 0x5b, 0x96, 0x24,
+    0x99, 0x96, 0x14, 0xfa, 0x08, 0x70, 0xba, 0xb3, 0x65, 0x85, 0x20, 0xb6, 0x24, 0x45, 0xbc, 0xb2,
+    0xec, 0x80, 0x35, 0x6d, 0xe7, 0xd1, 0x00, 0x1f, 0xb7, 0x56, 0x96, 0x36, 0x64, 0x12, 0x21, 0x05,
+    0xb4, 0x82, 0x91, 0xac, 0x4b, 0x87, 0x3f, 0xc9, 0x92, 0x28, 0xeb, 0xfa, 0x77, 0xe8, 0xfa, 0x45,
+    0x3b, 0x91, 0xba, 0xea, 0x0c, 0xb5, 0x63, 0xd1, 0x1c, 0x45, 0x09, 0x14, 0x21, 0x27, 0xc4, 0x27,
+    0x11, 0x99, 0x93, 0xa2, 0x37, 0x51, 0xd6, 0xe0, 0x2b, 0xc0, 0x03, 0x03, 0x61, 0xa2, 0x21, 0xfb,
+    0xda, 0x96, 0x67, 0xd7, 0x69, 0x41, 0x4e, 0xd2, 0x5d, 0xa7, 0x22, 0x01, 0x3e, 0x36, 0xf8, 0xb6,
+    0x4a, 0x42, 0x13, 0x4b, 0xd7, 0xf9, 0xb6, 0xe0, 0xba, 0x3c, 0x25, 0x49, 0x07, 0x32, 0x41, 0x19,
+    0xc8, 0xa3, 0x12, 0x02, 0x4c, 0x12, 0x1e, 0xe1, 0xca, 0x29, 0xeb, 0x96, 0x04, 0xaa, 0x90, 0xa4,
+    0x98, 0xa2, 0x48, 0x25, 0xb6, 0xd1, 0x47, 0x1a, 0x26, 0xfe, 0x89, 0x76, 0xf5, 0x28, 0x7d, 0x51,
+    0xae, 0xf0, 0x33, 0x06, 0xab, 0x6d, 0x61, 0x1d, 0x62, 0x0e, 0x99, 0xf6, 0x0b, 0xdf, 0x58, 0x96,
+    0xf0, 0x1e, 0x2a, 0x4b, 0x01, 0x49, 0x25, 0x6d, 0x81, 0xe2, 0x4c, 0xa7, 0x3f, 0xc9, 0x18, 0xac,
+    0x36, 0xe5, 0x80, 0xc6, 0x64, 0x15, 0x02, 0x48, 0x5b, 0xde, 0x5a, 0x26, 0xc0, 0x9b, 0xb6, 0xf4,
+    0x68, 0x4f, 0x34, 0x22, 0x7d, 0xcb, 0x96, 0xb7, 0x21, 0x93, 0x08, 0x29, 0xa0, 0x15, 0x8c, 0xe4,
+    0x5d, 0x3a, 0xfc, 0x09, 0x91, 0x18, 0xdb, 0x97, 0xff, 0xd3, 0x5e, 0xa4, 0xae, 0x5a, 0x43, 0xed,
+    0x58, 0x34, 0x47, 0x51, 0x02, 0x01, 0x7f, 0xa2, 0x2c, 0x7b, 0xd3, 0x98, 0x77, 0x89, 0x44, 0xe6,
+    0xa5, 0xe8, 0x4d, 0x94, 0x35, 0xf8, 0x0a, 0xf0, 0xc0, 0x38, 0x67, 0x98, 0xe5, 0xb5, 0x65, 0x79,
+    0x90, 0x3d, 0x88, 0x5c, 0xab, 0x22, 0x01, 0x46, 0x36, 0xf8, 0xb6, 0x4e, 0x42, 0x4b, 0x12, 0x22,
+    0x77, 0xfa, 0xb6, 0x07, 0xdf, 0x85, 0x79, 0x49, 0xfa, 0x81, 0x4c, 0x50, 0x06, 0xf2, 0xe8, 0x84,
+    0x07, 0x48, 0xd8, 0x72, 0xca, 0xbb, 0x25, 0x81, 0x2a, 0x24, 0x29, 0xa6, 0x28, 0x52, 0x89, 0x0d,
+    0x49, 0x18, 0x22, 0xfd, 0xa2, 0xa2, 0x33, 0x5f, 0xed, 0x51, 0x9f, 0xd2, 0x17, 0xe5, 0x6a, 0x1e,
+    0x80, 0x20, 0x9e, 0xc6, 0xc4, 0x15, 0x24, 0x9c, 0xc4, 0x7d, 0x81, 0x1a, 0x2d, 0x58, 0x90, 0x05,
+    0x59, 0xb0, 0x05, 0x4a, 0x81, 0x00, 0x49, 0xc6, 0x10, 0x7f, 0x01, 0x80, 0x80, 0x97, 0xb4, 0xbc,
+    0x6a, 0x28, 0x2a, 0x94, 0xb5, 0xb6, 0x6c, 0x07, 0xcc, 0x69, 0x5b, 0x8f, 0x06, 0x38, 0xb9, 0xf5,
+    0xb2, 0xb4, 0x21, 0x93, 0x08, 0x29, 0xa0, 0x15, 0x8c, 0x64, 0x5e, 0x3a, 0xfc, 0x01, 0xc9, 0x92,
+    0x30, 0xeb, 0xfb, 0x77, 0xe8, 0xfc, 0x45, 0xbb, 0x91, 0xba, 0xea, 0x0d, 0xb5, 0x63, 0xd1, 0x1c,
+    0x45, 0x09, 0x14, 0x21, 0x27, 0xc4, 0x27, 0x11, 0x99, 0x9b, 0xa2, 0x37, 0x51, 0xd6, 0xe0, 0x2b,
+    0xc0, 0x03, 0x03, 0x61, 0xa2, 0x29, 0xfb, 0xdb, 0x96, 0x67, 0xe7, 0x69, 0x41, 0x6e, 0xd2, 0x5d,
+    0xaf, 0x22, 0x01, 0x4e, 0x36, 0xf8, 0xb6, 0x52, 0x42, 0x13, 0x4b, 0xd7, 0xfa, 0xb6, 0xe0, 0xbc,
+    0x3c, 0x35, 0x49, 0x07, 0x32, 0x41, 0x19, 0xc8, 0xa3, 0x14, 0x02, 0x4c, 0x12, 0x26, 0xe1, 0xcb,
+    0x29, 0xf3, 0x96, 0x04, 0xaa, 0x90, 0xa4, 0x98, 0xa2, 0x48, 0x25, 0xb6, 0xd1, 0x49, 0x1a, 0x36,
+    0xfe, 0x89, 0x76, 0xf5, 0x2a, 0x7d, 0x51, 0x2e, 0xb7, 0x91, 0x6c, 0x58, 0x4b, 0x61, 0x84, 0x00,
+    0xe2, 0x92, 0x0f, 0xff, 0x48, 0x04, 0xa4, 0xc1, 0x12, 0x2d, 0x3f, 0xba, 0x6d, 0xc1, 0x41, 0x65,
+    0x81, 0x5a, 0x20, 0x5b, 0x5a, 0xe1, 0x86, 0xe4, 0x80, 0xa2, 0x00, 0x16, 0xa6, 0x35, 0x9b, 0x00,
+    0xdf, 0xd9, 0xda, 0xa3, 0x01, 0x4f, 0x34, 0x2a, 0x7d, 0xcc, 0x96, 0xb7, 0x21, 0x93, 0x08, 0x29,
+    0xa0, 0xc1, 0x11, 0x1d, 0x5c, 0x42, 0xa4, 0xc3, 0x9f, 0x2f, 0xff, 0x17, 0x63, 0xf3, 0x7a, 0x21,
+    0x95, 0x9a, 0x43, 0xcd, 0x51, 0xb4, 0x63, 0x51, 0x84, 0x00, 0x57, 0x94, 0x23, 0xfd, 0x88, 0xc2,
+    0xb4, 0xd0, 0xd8, 0x44, 0x19, 0xf0, 0xd3, 0x0b, 0xb0, 0xc1, 0x67, 0x60, 0x9c, 0x37, 0xcc, 0x1e,
+    0x64, 0x7a, 0x71, 0x59, 0x1e, 0x44, 0xad, 0x59, 0x91, 0x00, 0x2b, 0x1b, 0x7c, 0x5b, 0x2b, 0x21,
+    0x4b, 0x12, 0x2a, 0xf0, 0x58, 0x38, 0xdb, 0xb7, 0x73, 0x3d, 0x29, 0x3a, 0x10, 0x09, 0xca, 0x40,
+    0x1e, 0xad, 0xf0, 0x00, 0x29, 0xc7, 0x96, 0xc2, 0x98, 0x57, 0x48, 0x12, 0x28, 0x8a, 0x94, 0x62,
+    0x22, 0xb1, 0x01, 0x49, 0x18, 0x2a, 0xff, 0xd0, 0x94, 0x87, 0xf9, 0x31, 0x7a, 0x94, 0x6b, 0xfd,
+    0x4a, 0x9f, 0x79, 0xc9, 0x16, 0xac, 0xa6, 0x30, 0x42, 0xf8, 0x93, 0xb8, 0xe4, 0x08, 0x43, 0x0d,
+    0x96, 0x68, 0x82, 0xf8, 0x4b, 0x96, 0x2d, 0x1c, 0x10, 0xb1, 0x08, 0x73, 0x2f, 0x63, 0x0e, 0x89,
+    0xb4, 0x08, 0x8c, 0x84, 0x3b, 0x49, 0xcb, 0x61, 0x46, 0x64, 0x61, 0x5a, 0xb3, 0x09, 0x30, 0xfe,
+    0xe9, 0x3d, 0x03, 0xbc, 0xd4, 0x9a, 0x59, 0xda, 0x90, 0x49, 0x84, 0x14, 0xd0, 0x60, 0x89, 0x0e,
+    0x2e, 0x21, 0x02, 0x7f, 0x92, 0x27, 0x7c, 0xf9, 0x96, 0x18, 0x1b, 0xea, 0x08, 0xf5, 0x15, 0x43,
+    0x6a, 0x8e, 0xa2, 0x1d, 0x8b, 0x22, 0x24, 0x81, 0x9e, 0x44, 0x3c, 0x21, 0x36, 0x51, 0x06, 0x1c,
+    0xf5, 0x02, 0x6c, 0xf0, 0x19, 0x18, 0x61, 0xa2, 0x31, 0x76, 0x99, 0x16, 0xfa, 0xb9, 0x2c, 0x67,
+    0x1d, 0x8a, 0xa4, 0x1c, 0xa5, 0x37, 0xf8, 0x04, 0x2f, 0xb5, 0x5a, 0xc2, 0x12, 0x0b, 0x70, 0x59,
+    0x38, 0xdf, 0xb7, 0x3f, 0x45, 0x49, 0x07, 0x22, 0x41, 0x19, 0xc8, 0xa3, 0x16, 0x02, 0x4c, 0x12,
+    0x2e, 0x65, 0xd9, 0x52, 0x38, 0xf3, 0x0a, 0x49, 0x02, 0x45, 0x91, 0x52, 0x4c, 0x24, 0xb6, 0xd4,
+    0x1b, 0xf2, 0x89, 0x76, 0xe6, 0xc8, 0xe8, 0x51, 0xae, 0xf5, 0x2c, 0x7d, 0xf9, 0x00, 0x44, 0xe7,
+    0x27, 0x5b, 0x12, 0x08, 0x49, 0xb6, 0x0c, 0xff, 0x12, 0x97, 0x9c, 0xb7, 0x00, 0x80, 0x2c, 0x40,
+    0xa9, 0x63, 0xfa, 0x56, 0x91, 0x7e, 0x3c, 0xa2, 0xbd, 0x08, 0x13, 0x5c, 0x22, 0x5c, 0x1a, 0xaf,
+    0x21, 0x29, 0x59, 0xca, 0xf4, 0x90, 0x76, 0x43, 0xd1, 0x9a, 0x4d, 0x80, 0xf3, 0x4f, 0xb4, 0x23,
+    0x60, 0x66, 0x5d, 0xcd, 0x96, 0x36, 0x64, 0x12, 0x21, 0x05, 0x34, 0x78, 0xa2, 0x83, 0x4b, 0x88,
+    0x74, 0xf8, 0xf3, 0xe5, 0xff, 0x62, 0x6c, 0xa8, 0x25, 0xd4, 0xd7, 0x0c, 0xa9, 0x39, 0x8a, 0x76,
+    0x2c, 0x02, 0x7f, 0xa2, 0x0c, 0x7a, 0x95, 0xf2, 0x2e, 0x91, 0xd8, 0x42, 0x63, 0x13, 0x65, 0xc0,
+    0x53, 0x2f, 0xc0, 0x06, 0x1f, 0xe7, 0x08, 0xb3, 0x03, 0x7b, 0x90, 0xe5, 0xd5, 0x65, 0x61, 0x2d,
+    0x8a, 0xf4, 0x20, 0x6a, 0xf0, 0x09, 0x66, 0x02, 0x49, 0xc2, 0x1f, 0x71, 0x5e, 0x08, 0x7c, 0x16,
+    0xce, 0xf8, 0xed, 0x4f, 0x53, 0xd2, 0x81, 0x48, 0x50, 0x06, 0xf2, 0xe8, 0x85, 0x07, 0x48, 0x79,
+    0xb6, 0x14, 0xd6, 0xbc, 0x42, 0x92, 0x40, 0x51, 0xa4, 0x14, 0x13, 0x5b, 0x96, 0x2b, 0x6b, 0x4e,
+    0xc8, 0xfa, 0x23, 0xe5, 0x61, 0x9e, 0x8c, 0xae, 0x3e, 0xa4, 0x4f, 0xca, 0x25, 0x3d, 0x32, 0xd2,
+    0xa6, 0x68, 0x81, 0x90, 0xed, 0xc6, 0xe5, 0x07, 0x92, 0x70, 0x94, 0x0c, 0x4a, 0x14, 0xfd, 0x98,
+    0x7e, 0xad, 0x44, 0x0d, 0x4b, 0xb2, 0x07, 0xdf, 0x89, 0xc6, 0x34, 0x11, 0x6e, 0x98, 0x92, 0x24,
+    0xc9, 0x0d, 0x45, 0x6a, 0x36, 0x01, 0xd6, 0x9f, 0xbb, 0x46, 0xc0, 0xf9, 0x36, 0x64, 0xb2, 0x75,
+    0xb3, 0x14, 0x50, 0x84, 0x08, 0xa6, 0xac, 0x60, 0x00, 0xc9, 0x92, 0x10, 0xe7, 0xfd, 0xf3, 0x3e,
+    0xff, 0xb7, 0x18, 0x1b, 0xea, 0x09, 0xf5, 0x55, 0x43, 0x6a, 0x8e, 0xa2, 0x1d, 0x8b, 0x22, 0x24,
+    0x81, 0x9e, 0x44, 0x3c, 0x21, 0x36, 0x51, 0x06, 0x5c, 0xf5, 0x02, 0x6c, 0xf0, 0x01, 0x61, 0xa2,
+    0x09, 0x67, 0x5d, 0x74, 0xe6, 0x94, 0x2d, 0x79, 0x77, 0x59, 0x58, 0x8f, 0x22, 0x3d, 0x88, 0x02,
+    0x07, 0x1d, 0x7c, 0x25, 0x16, 0xe2, 0x18, 0x3e, 0x38, 0x2d, 0x9c, 0xf3, 0xdb, 0x0f, 0xe4, 0xa9,
+    0x4a, 0xca, 0x40, 0x4e, 0x10, 0x4c, 0x12, 0x06, 0x73, 0x8c, 0xf8, 0xca, 0xb4, 0x25, 0xe9, 0x26,
+    0x15, 0x92, 0x04, 0x8a, 0x22, 0xa5, 0x98, 0x46, 0x07, 0x59, 0x62, 0x7b, 0xa2, 0x9d, 0xb9, 0x32,
+    0xfa, 0x7a, 0x91, 0x3e, 0x29, 0x57, 0x3b, 0x24, 0x00, 0x31, 0x8e, 0x48, 0x82, 0x0b, 0xec, 0x90,
+    0x50, 0xbe, 0xb2, 0x25, 0xd0, 0x0f, 0x05, 0xdc, 0x49, 0x5a, 0x6e, 0x48, 0x88, 0x22, 0x5c, 0x00,
+    0x9a, 0x57, 0xb8, 0x7c, 0x80, 0x72, 0x27, 0x63, 0x32, 0x04, 0x1b, 0x92, 0x9a, 0xa2, 0xe5, 0x86,
+    0x22, 0x59, 0xa6, 0x14, 0xe0, 0x3d, 0x7b, 0x79, 0x34, 0x02, 0xd6, 0xb7, 0x21, 0x93, 0xad, 0x9c,
+    0xa5, 0x80, 0x22, 0x44, 0x70, 0x65, 0x05, 0x13, 0x22, 0x1d, 0xfe, 0x7c, 0xf9, 0xbf, 0x18, 0x1b,
+    0x6a, 0x0a, 0xf5, 0x75, 0x43, 0x0a, 0xbf, 0xa2, 0x14, 0x7e, 0x5e, 0x94, 0x47, 0x48, 0x02, 0x3d,
+    0x89, 0x78, 0x42, 0x6c, 0xa2, 0x0c, 0xf8, 0xea, 0x05, 0xd8, 0xe0, 0xe3, 0x3c, 0x61, 0x76, 0x60,
+    0x0f, 0xb2, 0xbc, 0xbc, 0x2c, 0xac, 0x49, 0x91, 0x1e, 0x44, 0x4a, 0x14, 0x0a, 0x63, 0xfa, 0x54,
+    0x62, 0x21, 0x9e, 0xe1, 0x83, 0xd7, 0xc2, 0x59, 0xbf, 0xfd, 0x40, 0x9e, 0xae, 0xa4, 0x0c, 0xe4,
+    0x04, 0x1d, 0xe0, 0xd1, 0x0c, 0x2b, 0xd7, 0x96, 0xa4, 0x9c, 0x54, 0x48, 0x12, 0x08, 0x89, 0xa2,
+    0x14, 0x7e, 0x5e, 0x94, 0xa3, 0x96, 0x90, 0x25, 0xb6, 0x27, 0xda, 0x99, 0x2f, 0xa3, 0xaf, 0x1f,
+    0xe9, 0x93, 0x72, 0xd1, 0x8d, 0x6c, 0x99, 0x3e, 0x19, 0x13, 0x08, 0xab, 0x25, 0x33, 0x10, 0xd3,
+    0xa5, 0x1c, 0xaf, 0x44, 0x7a, 0x14, 0x1d, 0x59, 0x96, 0x04, 0xfb, 0x51, 0xf2, 0x47, 0x50, 0x91,
+    0x6d, 0x81, 0x0a, 0x5b, 0x92, 0x22, 0x38, 0xa2, 0xa8, 0xd9, 0x04, 0x98, 0x6f, 0xee, 0x1a, 0x01,
+    0xef, 0xb5, 0x46, 0x16, 0x37, 0x64, 0x12, 0x21, 0x05, 0x04, 0xe1, 0x92, 0x07, 0x6a, 0xcb, 0xd2,
+    0xe1, 0x4f, 0x88, 0xc4, 0xd8, 0xbe, 0xfc, 0x5f, 0xea, 0x0a, 0xb5, 0x9d, 0x49, 0x7d, 0xc7, 0xa2,
+    0x39, 0x8a, 0x12, 0x28, 0x42, 0x4e, 0x88, 0x4f, 0x22, 0x32, 0x51, 0x06, 0x9c, 0x75, 0x8c, 0xb2,
+    0x18, 0x73, 0xfe, 0x74, 0xce, 0x14, 0x66, 0x0d, 0x16, 0xbc, 0xb1, 0x2c, 0xc7, 0x2d, 0x4b, 0xeb,
+    0x52, 0xa4, 0x07, 0x51, 0xe0, 0xa1, 0x83, 0xaf, 0xc4, 0x42, 0x5c, 0xc3, 0x07, 0xb7, 0x85, 0xf3,
+    0x7e, 0xfb, 0x81, 0x3c, 0x65, 0x49, 0x21, 0x13, 0x0e, 0xf7, 0xfd, 0xb4, 0x77, 0x60, 0xc2, 0x5c,
+    0x23, 0x1e, 0x69, 0x24, 0x94, 0x6d, 0x4b, 0x02, 0x55, 0x48, 0x52, 0x4c, 0x51, 0xa4, 0x12, 0xdb,
+    0xe8, 0x21, 0x9d, 0x68, 0x3f, 0xcc, 0xbc, 0x7a, 0x92, 0x3e, 0x29, 0x17, 0xd9, 0x96, 0x08, 0x7f,
+    0x62, 0x92, 0x31, 0x81, 0xb0, 0x5e, 0x32, 0xe7, 0x21, 0xfc, 0x07, 0x12, 0x0e, 0x92, 0xce, 0x89,
+    0x14, 0x43, 0x59, 0x2f, 0x5b, 0x02, 0x41, 0x77, 0x69, 0xc9, 0x54, 0x00, 0x0b, 0x44, 0x3f, 0xa4,
+    0x48, 0x47, 0x14, 0x59, 0xa6, 0x07, 0xe0, 0x0b, 0x7b, 0x7a, 0x34, 0x02, 0xe6, 0x6f, 0x95, 0x2c,
+    0x6e, 0xc8, 0x24, 0x42, 0x0a, 0x68, 0x05, 0x23, 0xf9, 0x96, 0x0e, 0x7f, 0x42, 0x24, 0xc6, 0xf6,
+    0xe5, 0xff, 0xb4, 0x07, 0xa9, 0xab, 0xb6, 0x50, 0x5f, 0x94, 0x0b, 0xfe, 0xbb, 0xa2, 0x24, 0x50,
+    0x84, 0x9c, 0x10, 0x9f, 0x44, 0x64, 0x1e, 0x8a, 0xde, 0x44, 0x59, 0x83, 0xaf, 0x00, 0x0f, 0x8c,
+    0x73, 0x85, 0x59, 0x5e, 0x59, 0x96, 0x07, 0xd9, 0x83, 0xc8, 0xb5, 0x29, 0x12, 0x4a, 0x14, 0x12,
+    0x63, 0xfb, 0x54, 0x62, 0x21, 0xbe, 0xe1, 0x83, 0xdf, 0xc2, 0x99, 0xbf, 0xdd, 0x69, 0x48, 0x1a,
+    0x4e, 0x21, 0x06, 0x72, 0x82, 0x0c, 0x70, 0xf9, 0x8a, 0x47, 0x2a, 0x09, 0xe5, 0xdb, 0x92, 0x40,
+    0x15, 0x12, 0x59, 0x94, 0x0b, 0xfe, 0x8b, 0xa2, 0x94, 0xd8, 0x54, 0x53, 0x48, 0xc3, 0xc1, 0x3f,
+    0xd1, 0xae, 0xbe, 0xa4, 0x2f, 0xca, 0x05
+};
+
+// The byte offset in ChordStream[] of every CHORD_KEYFRAME_INTERVAL'th voicing.
+const uint16_t ChordStreamKeyframes[(NUM_CHORD_VOICINGS + CHORD_KEYFRAME_INTERVAL - 1) /
+                                    CHORD_KEYFRAME_INTERVAL] CHORD_PROGMEM =
+{
+       0,   38,   75,  114,  153,  191,  234,  271,  309,  345,  384,  423,
+     460,  500,  538,  577,  614,  653,  688,  726,  766,  803,  843,  880,
+     917,  954,  992, 1027, 1071, 1107, 1142, 1182, 1220, 1261, 1298, 1336,
+    1371, 1412, 1449, 1486, 1525, 1563, 1601, 1638, 1674, 1710, 1751, 1786,
+    1822, 1862, 1900, 1939, 1976, 2013, 2050
+};
+
+#else
+
+// The shape dictionary of the full chord library.
+const uint8_t ChordShapes[NUM_CHORD_SHAPES * CHORD_SHAPE_SIZE] CHORD_PROGMEM =
+{
+    PACK_SHAPE(3, 3, 2, 0, 1, 0),   //   0: C Major 1
+    PACK_SHAPE(1, 1, 3, 3, 3, 1),   //   1: C Major 2
+    PACK_SHAPE(X, 3, 2, 0, 1, 0),   //   2: C Major 3
+    PACK_SHAPE(X, X, 1, 0, 1, 3),   //   3: C Minor 1
+    PACK_SHAPE(1, 1, 3, 3, 2, 1),   //   4: C Minor 2
+    PACK_SHAPE(0, 0, 2, 2, 1, 3),   //   5: C 6th 1
+    PACK_SHAPE(4, 3, 1, 1, 1, 1),   //   6: C 6th 2
+    PACK_SHAPE(X, 0, 1, 0, 1, 3),   //   7: C Minor 6th 1
+    PACK_SHAPE(X, X, 2, 2, 1, 2),   //   8: C Minor 6th 2
+    PACK_SHAPE(3, 3, 2, 3, 1, 0),   //   9: C 7th 1
+    PACK_SHAPE(1, 1, 3, 1, 3, 1),   //  10: C 7th 2
+    PACK_SHAPE(X, 3, 2, 3, 1, 0),   //  11: C 7th 3
+    PACK_SHAPE(2, 2, 1, 0, 0, 0),   //  12: C Major 7th 1
+    PACK_SHAPE(1, 1, 3, 2, 3, 1),   //  13: C Major 7th 2
+    PACK_SHAPE(X, 3, 1, 3, 1, 3),   //  14: C Minor 7th 1
+    PACK_SHAPE(1, 1, 3, 1, 2, 1),   //  15: C Minor 7th 2
+    PACK_SHAPE(2, 2, 1, 2, 2, 2),   //  16: C 9th 1
+    PACK_SHAPE(X, 1, 1, 1, 1, 2),   //  17: C 9th 2
+    PACK_SHAPE(X, 2, 3, 1, 3, 1),   //  18: C Diminished 1
+    PACK_SHAPE(1, 2, 3, 1, 3, 1),   //  19: C Diminished 2
+    PACK_SHAPE(X, 3, 2, 1, 1, X),   //  20: C Augmented 1
+    PACK_SHAPE(4, 3, 2, 1, 1, X),   //  21: C Augmented 2
+    PACK_SHAPE(X, 1, 3, 3, 1, 1),   //  22: C Suspended 2nd 1
+    PACK_SHAPE(4, 1, 1, 1, 4, 4),   //  23: C Suspended 2nd 2
+    PACK_SHAPE(X, 1, 3, 1, 1, 1),   //  24: C 7th Susp. 2nd 1
+    PACK_SHAPE(4, 1, 1, 1, 4, 2),   //  25: C 7th Susp. 2nd 2
+    PACK_SHAPE(X, 1, 1, 3, 4, 1),   //  26: C Suspended 4th 1
+    PACK_SHAPE(1, 1, 3, 3, 1, 1),   //  27: C Suspended 4th 2
+    PACK_SHAPE(X, 1, 1, 1, X, X),   //  28: C 7th Susp. 4th 1
+    PACK_SHAPE(1, 1, 1, 3, 1, 1),   //  29: C 7th Susp. 4th 2
+    PACK_SHAPE(X, 1, 3, 3, X, X),   //  30: C 5th 1
+    PACK_SHAPE(1, 3, 3, X, X, X),   //  31: C 5th 2
+    PACK_SHAPE(X, 2, 1, 4, 4, 1),   //  32: C Diminished 5th 1
+    PACK_SHAPE(2, 1, 4, 3, 1, X),   //  33: C Diminished 5th 2
+    PACK_SHAPE(X, 1, 2, 1, 3, X),   //  34: C 7th Dim. 5th 1
+    PACK_SHAPE(1, 2, 1, 2, X, X),   //  35: C 7th Dim. 5th 2
+    PACK_SHAPE(X, 1, 2, 1, 2, X),   //  36: C Mnr 7th Dim. 5th 1
+    PACK_SHAPE(1, 2, 1, 1, X, X),   //  37: C Mnr 7th Dim. 5th 2
+    PACK_SHAPE(X, 1, 4, 1, 3, 2),   //  38: C 7th Aug. 5th 1
+    PACK_SHAPE(1, 4, 1, 2, 2, 1),   //  39: C 7th Aug. 5th 2
+    PACK_SHAPE(X, 2, 1, 2, 1, 2),   //  40: C 7th Minor 9th 1
+    PACK_SHAPE(1, 3, 1, 2, 1, 2),   //  41: C 7th Minor 9th 2
+    PACK_SHAPE(X, 2, 1, 2, 3, X),   //  42: C 7th Aug. 9th 1
+    PACK_SHAPE(1, 3, 1, 2, 1, 4),   //  43: C 7th Aug. 9th 2
+    PACK_SHAPE(X, 2, 1, 2, 1, 3),   //  44: C 7 Minor 9 Aug. 5 1
+    PACK_SHAPE(3, 2, 1, 1, 4, 1),   //  45: C 7 Minor 9 Aug. 5 2
+    PACK_SHAPE(X, 1, 3, 1, 3, 3),   //  46: C Seven-Six 1
+    PACK_SHAPE(1, 3, 1, 2, 3, 1),   //  47: C Seven-Six 2
+    PACK_SHAPE(X, 2, 1, 2, 2, 1),   //  48: C 9th Dim. 5th 1
+    PACK_SHAPE(2, 1, 2, 1, 1, 2),   //  49: C 9th Dim. 5th 2
+    PACK_SHAPE(4, 1, 2, 1, 1, 2),   //  50: C 9th Aug. 5th 1
+    PACK_SHAPE(2, 1, 2, 1, 3, X),   //  51: C 9th Aug. 5th 2
+    PACK_SHAPE(4, 1, 1, 1, 1, 3),   //  52: C Major 9th 1
+    PACK_SHAPE(X, 4, 1, 1, 1, 1),   //  53: C Major 9th 2
+    PACK_SHAPE(X, 3, 1, 3, 3, X),   //  54: C Minor 9th 1
+    PACK_SHAPE(1, 3, 1, 1, 1, 3),   //  55: C Minor 9th 2
+    PACK_SHAPE(X, 2, 1, 1, 2, 2),   //  56: C Nine-Six 1
+    PACK_SHAPE(4, 1, 1, 1, 1, 1),   //  57: C Nine-Six 2
+    PACK_SHAPE(X, 3, 1, 2, 3, X),   //  58: C Minor Nine-Six 1
+    PACK_SHAPE(4, 1, 1, 4, 4, 1),   //  59: C Minor Nine-Six 2
+    PACK_SHAPE(4, 1, 1, 1, 1, 4),   //  60: C Added 9th 1
+    PACK_SHAPE(X, 4, 1, 1, 2, 1),   //  61: C Added 9th 2
+    PACK_SHAPE(X, 1, 1, 1, 1, 1),   //  62: C 11th 1
+    PACK_SHAPE(1, 1, 1, 3, 1, 3),   //  63: C 11th 2
+    PACK_SHAPE(X, 1, 1, 1, 2, 1),   //  64: C Minor 11th 1
+    PACK_SHAPE(1, 1, 1, 1, 1, 1),   //  65: C Minor 11th 2
+    PACK_SHAPE(X, 1, 2, 1, 3, 1),   //  66: C Augmented 11th 1
+    PACK_SHAPE(1, 2, 1, 2, 1, 1),   //  67: C Augmented 11th 2
+    PACK_SHAPE(4, 1, 4, 1, 1, 1),   //  68: C 13th 2
+    PACK_SHAPE(X, 2, 1, 2, 1, 4),   //  69: C 13th Minor 9th 1
+    PACK_SHAPE(1, X, 1, 2, 3, 2),   //  70: C 13th Minor 9th 2
+    PACK_SHAPE(3, X, 2, 1, 2, 1),   //  71: C 13 Minor 9 Dim 5 1
+    PACK_SHAPE(1, 2, 1, X, 3, 2),   //  72: C 13 Minor 9 Dim 5 2
+    PACK_SHAPE(1, 4, 3, 1, 2, 1),   //  73: C# Major 1
+    PACK_SHAPE(X, X, 2, 1, 2, 0),   //  74: C# Minor 1
+    PACK_SHAPE(1, 1, 3, 1, 2, 4),   //  75: C# 6th 1
+    PACK_SHAPE(X, 1, 2, 1, 2, 0),   //  76: C# Minor 6th 1
+    PACK_SHAPE(X, 3, 1, 2, 1, 3),   //  77: C# Minor 6th 2
+    PACK_SHAPE(X, X, 2, 3, 1, 3),   //  78: C# 7th 1
+    PACK_SHAPE(1, 4, 3, 1, 1, 1),   //  79: C# Major 7th 1
+    PACK_SHAPE(X, 4, 2, 1, 0, 0),   //  80: C# Minor 7th 1
+    PACK_SHAPE(1, 0, 0, 1, 2, 1),   //  81: D Major 1
+    PACK_SHAPE(X, X, 0, 1, 2, 1),   //  82: D Major 3
+    PACK_SHAPE(1, 0, 0, 2, 3, 1),   //  83: D Minor 1
+    PACK_SHAPE(X, X, 0, 2, 3, 1),   //  84: D Minor 3
+    PACK_SHAPE(1, 0, 0, 1, 0, 1),   //  85: D 6th 1
+    PACK_SHAPE(1, 0, 0, 2, 0, 1),   //  86: D Minor 6th 1
+    PACK_SHAPE(2, 0, 0, 2, 1, 2),   //  87: D 7th 1
+    PACK_SHAPE(X, X, 0, 2, 1, 2),   //  88: D 7th 3
+    PACK_SHAPE(1, 0, 0, 1, 1, 1),   //  89: D Major 7th 1
+    PACK_SHAPE(X, 0, 0, 2, 1, 1),   //  90: D Minor 7th 1
+    PACK_SHAPE(2, 0, 0, 2, 1, 0),   //  91: D 9th 1
+    PACK_SHAPE(X, 1, 1, 3, 4, 2),   //  92: Eb Minor 1
+    PACK_SHAPE(X, X, 3, 2, 3, 1),   //  93: Eb Minor 2
+    PACK_SHAPE(X, 1, 1, 3, 1, 3),   //  94: Eb 6th 1
+    PACK_SHAPE(X, 1, 1, 3, 1, 2),   //  95: Eb Minor 6th 1
+    PACK_SHAPE(X, 1, 1, 3, 2, 3),   //  96: Eb 7th 1
+    PACK_SHAPE(X, 1, 1, 3, 2, 2),   //  97: Eb Minor 7th 1
+    PACK_SHAPE(X, 1, 1, 0, 2, 1),   //  98: Eb 9th 1
+    PACK_SHAPE(3, 1, 1, 3, 2, 1),   //  99: Eb 9th 2
+    PACK_SHAPE(0, 2, 2, 1, 0, 0),   // 100: E Major 1
+    PACK_SHAPE(0, 1, 1, 0, 0, 0),   // 101: E Minor 1
+    PACK_SHAPE(0, 2, 2, 1, 2, 0),   // 102: E 6th 1
+    PACK_SHAPE(0, 1, 1, 3, 1, 3),   // 103: E 6th 2
+    PACK_SHAPE(0, 1, 1, 0, 1, 0),   // 104: E Minor 6th 1
+    PACK_SHAPE(0, 2, 2, 1, 3, 0),   // 105: E 7th 1
+    PACK_SHAPE(0, 1, 1, 3, 2, 3),   // 106: E 7th 2
+    PACK_SHAPE(0, 2, 1, 1, 0, 0),   // 107: E Major 7th 1
+    PACK_SHAPE(0, 1, 0, 0, 0, 0),   // 108: E Minor 7th 1
+    PACK_SHAPE(0, 2, 0, 1, 0, 2),   // 109: E 9th 1
+    PACK_SHAPE(1, 3, 3, 2, 1, 1),   // 110: F Major 1
+    PACK_SHAPE(1, 3, 3, 1, 1, 1),   // 111: F Minor 1
+    PACK_SHAPE(1, 0, 0, 2, 1, 1),   // 112: F 6th 1
+    PACK_SHAPE(X, X, 0, 1, 1, 1),   // 113: F Minor 6th 1
+    PACK_SHAPE(1, 3, 3, 1, 3, 1),   // 114: F Minor 6th 2
+    PACK_SHAPE(1, 3, 1, 2, 4, 1),   // 115: F 7th 1
+    PACK_SHAPE(1, 3, 3, 2, 1, 0),   // 116: F Major 7th 1
+    PACK_SHAPE(1, 3, 1, 1, 1, 1),   // 117: F Minor 7th 1
+    PACK_SHAPE(1, 0, 1, 0, 1, 1),   // 118: F 9th 1
+    PACK_SHAPE(1, 3, 1, 2, 1, 3),   // 119: F 9th 2
+    PACK_SHAPE(2, 0, 1, 2, 2, 2),   // 120: F# Minor 6th 1
+    PACK_SHAPE(X, 1, 4, 3, 2, 1),   // 121: F# Major 7th 1
+    PACK_SHAPE(1, 3, 2, 2, 1, 1),   // 122: F# Major 7th 2
+    PACK_SHAPE(X, 1, 2, 1, 2, 2),   // 123: F# 9th 1
+    PACK_SHAPE(2, 1, 0, 0, 0, 2),   // 124: G Major 1
+    PACK_SHAPE(2, 1, 0, 0, 2, 2),   // 125: G Major 3
+    PACK_SHAPE(2, 1, 0, 0, 0, 0),   // 126: G 6th 1
+    PACK_SHAPE(X, 1, 2, 0, 3, 0),   // 127: G Minor 6th 1
+    PACK_SHAPE(X, X, 1, 2, 2, 2),   // 128: G Minor 6th 2
+    PACK_SHAPE(3, 2, 0, 0, 0, 1),   // 129: G 7th 1
+    PACK_SHAPE(2, 1, 0, 0, 0, 1),   // 130: G Major 7th 1
+    PACK_SHAPE(3, 2, 0, 2, 0, 1),   // 131: G 9th 1
+    PACK_SHAPE(4, 3, 1, 1, 1, 4),   // 132: Ab Major 1
+    PACK_SHAPE(1, 2, 1, 1, 0, 1),   // 133: Ab Minor 6th 1
+    PACK_SHAPE(X, X, 1, 1, 1, 2),   // 134: Ab 7th 1
+    PACK_SHAPE(X, 3, 1, 1, 1, 3),   // 135: Ab Major 7th 1
+    PACK_SHAPE(X, X, 1, 1, 0, 2),   // 136: Ab Minor 7th 1
+    PACK_SHAPE(0, 0, 1, 1, 1, 0),   // 137: A Major 1
+    PACK_SHAPE(X, 0, 1, 1, 1, 0),   // 138: A Major 3
+    PACK_SHAPE(0, 0, 2, 2, 1, 0),   // 139: A Minor 1
+    PACK_SHAPE(X, 0, 2, 2, 1, 0),   // 140: A Minor 3
+    PACK_SHAPE(0, 0, 1, 1, 1, 1),   // 141: A 6th 1
+    PACK_SHAPE(0, 0, 2, 2, 1, 2),   // 142: A Minor 6th 1
+    PACK_SHAPE(X, 0, 1, 2, 2, 2),   // 143: A Minor 6th 2
+    PACK_SHAPE(0, 0, 1, 0, 1, 0),   // 144: A 7th 1
+    PACK_SHAPE(0, 0, 2, 1, 2, 0),   // 145: A Major 7th 1
+    PACK_SHAPE(0, 0, 2, 0, 1, 0),   // 146: A Minor 7th 1
+    PACK_SHAPE(0, 0, 1, 3, 1, 2),   // 147: A 9th 1
+    PACK_SHAPE(1, 1, 0, 1, 1, 1),   // 148: Bb 9th 1
+    PACK_SHAPE(2, 2, 0, 1, 0, 2),   // 149: B Minor 6th 1
+    PACK_SHAPE(2, 2, 1, 2, 0, 2),   // 150: B 7th 1
+    PACK_SHAPE(1, 1, 0, 1, 0, 1)    // 151: B Minor 7th 1
+};
+
+// The shape id of each voicing, in key, type, variation order.
+const uint8_t ChordShapeIds[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+      0,   1,   2,    // C Major
+      3,   4,    // C Minor
+      5,   6,    // C 6th
+      7,   8,    // C Minor 6th
+      9,  10,  11,    // C 7th
+     12,  13,    // C Major 7th
+     14,  15,    // C Minor 7th
+     16,  17,    // C 9th
+     18,  19,    // C Diminished
+     20,  21,    // C Augmented
+     22,  23,    // C Suspended 2nd
+     24,  25,    // C 7th Susp. 2nd
+     26,  27,    // C Suspended 4th
+     28,  29,    // C 7th Susp. 4th
+     30,  31,    // C 5th
+     32,  33,    // C Diminished 5th
+     34,  35,    // C 7th Dim. 5th
+     36,  37,    // C Mnr 7th Dim. 5th
+     38,  39,    // C 7th Aug. 5th
+     40,  41,    // C 7th Minor 9th
+     42,  43,    // C 7th Aug. 9th
+     44,  45,    // C 7 Minor 9 Aug. 5
+     46,  47,    // C Seven-Six
+     48,  49,    // C 9th Dim. 5th
+     50,  51,    // C 9th Aug. 5th
+     52,  53,    // C Major 9th
+     54,  55,    // C Minor 9th
+     56,  57,    // C Nine-Six
+     58,  59,    // C Minor Nine-Six
+     60,  61,    // C Added 9th
+     62,  63,    // C 11th
+     64,  65,    // C Minor 11th
+     66,  67,    // C Augmented 11th
+     46,  68,    // C 13th
+     69,  70,    // C 13th Minor 9th
+     71,  72,    // C 13 Minor 9 Dim 5
+     73,   1,    // C# Major
+     74,   4,    // C# Minor
+     75,   6,    // C# 6th
+     76,  77,    // C# Minor 6th
+     78,  10,    // C# 7th
+     79,  13,    // C# Major 7th
+     80,  14,    // C# Minor 7th
+     16,  17,    // C# 9th
+     18,  19,    // C# Diminished
+     20,  21,    // C# Augmented
+     22,  23,    // C# Suspended 2nd
+     24,  25,    // C# 7th Susp. 2nd
+     26,  27,    // C# Suspended 4th
+     28,  29,    // C# 7th Susp. 4th
+     30,  31,    // C# 5th
+     32,  33,    // C# Diminished 5th
+     34,  35,    // C# 7th Dim. 5th
+     36,  37,    // C# Mnr 7th Dim. 5th
+     38,  39,    // C# 7th Aug. 5th
+     40,  41,    // C# 7th Minor 9th
+     42,  43,    // C# 7th Aug. 9th
+     44,  45,    // C# 7 Minor 9 Aug. 5
+     46,  47,    // C# Seven-Six
+     48,  49,    // C# 9th Dim. 5th
+     50,  51,    // C# 9th Aug. 5th
+     53,  52,    // C# Major 9th
+     54,  55,    // C# Minor 9th
+     56,  57,    // C# Nine-Six
+     58,  59,    // C# Minor Nine-Six
+     61,  60,    // C# Added 9th
+     62,  63,    // C# 11th
+     64,  65,    // C# Minor 11th
+     66,  67,    // C# Augmented 11th
+     46,  68,    // C# 13th
+     69,  70,    // C# 13th Minor 9th
+     71,  72,    // C# 13 Minor 9 Dim 5
+     81,   1,  82,    // D Major
+     83,   4,  84,    // D Minor
+     85,  75,    // D 6th
+     86,  77,    // D Minor 6th
+     87,  78,  88,    // D 7th
+     89,  13,    // D Major 7th
+     90,  14,    // D Minor 7th
+     91,  16,    // D 9th
+     18,  19,    // D Diminished
+     20,  21,    // D Augmented
+     22,  23,    // D Suspended 2nd
+     24,  25,    // D 7th Susp. 2nd
+     26,  27,    // D Suspended 4th
+     28,  29,    // D 7th Susp. 4th
+     30,  31,    // D 5th
+     32,  33,    // D Diminished 5th
+     34,  35,    // D 7th Dim. 5th
+     36,  37,    // D Mnr 7th Dim. 5th
+     38,  39,    // D 7th Aug. 5th
+     40,  41,    // D 7th Minor 9th
+     42,  43,    // D 7th Aug. 9th
+     44,  45,    // D 7 Minor 9 Aug. 5
+     46,  47,    // D Seven-Six
+     48,  49,    // D 9th Dim. 5th
+     50,  51,    // D 9th Aug. 5th
+     53,  52,    // D Major 9th
+     54,  55,    // D Minor 9th
+     56,  57,    // D Nine-Six
+     58,  59,    // D Minor Nine-Six
+     61,  60,    // D Added 9th
+     62,  63,    // D 11th
+     64,  65,    // D Minor 11th
+     66,  67,    // D Augmented 11th
+     46,  68,    // D 13th
+     69,  70,    // D 13th Minor 9th
+     71,  72,    // D 13 Minor 9 Dim 5
+     73,   1,    // Eb Major
+     92,  93,    // Eb Minor
+     94,  75,    // Eb 6th
+     95,  77,    // Eb Minor 6th
+     96,  78,    // Eb 7th
+     79,  13,    // Eb Major 7th
+     97,  14,    // Eb Minor 7th
+     98,  99,    // Eb 9th
+     18,  19,    // Eb Diminished
+     20,  21,    // Eb Augmented
+     22,  23,    // Eb Suspended 2nd
+     24,  25,    // Eb 7th Susp. 2nd
+     26,  27,    // Eb Suspended 4th
+     28,  29,    // Eb 7th Susp. 4th
+     30,  31,    // Eb 5th
+     32,  33,    // Eb Diminished 5th
+     34,  35,    // Eb 7th Dim. 5th
+     36,  37,    // Eb Mnr 7th Dim. 5th
+     38,  39,    // Eb 7th Aug. 5th
+     40,  41,    // Eb 7th Minor 9th
+     42,  43,    // Eb 7th Aug. 9th
+     44,  45,    // Eb 7 Minor 9 Aug. 5
+     46,  47,    // Eb Seven-Six
+     48,  49,    // Eb 9th Dim. 5th
+     50,  51,    // Eb 9th Aug. 5th
+     53,  52,    // Eb Major 9th
+     54,  55,    // Eb Minor 9th
+     56,  57,    // Eb Nine-Six
+     58,  59,    // Eb Minor Nine-Six
+     61,  60,    // Eb Added 9th
+     62,  63,    // Eb 11th
+     64,  65,    // Eb Minor 11th
+     66,  67,    // Eb Augmented 11th
+     46,  68,    // Eb 13th
+     69,  70,    // Eb 13th Minor 9th
+     71,  72,    // Eb 13 Minor 9 Dim 5
+    100,  73,    // E Major
+    101,  92,    // E Minor
+    102, 103,    // E 6th
+    104,  95,    // E Minor 6th
+    105, 106,    // E 7th
+    107,  79,    // E Major 7th
+    108,  97,    // E Minor 7th
+    109,  99,    // E 9th
+     18,  19,    // E Diminished
+     20,  21,    // E Augmented
+     22,  23,    // E Suspended 2nd
+     24,  25,    // E 7th Susp. 2nd
+     26,  27,    // E Suspended 4th
+     28,  29,    // E 7th Susp. 4th
+     30,  31,    // E 5th
+     32,  33,    // E Diminished 5th
+     34,  35,    // E 7th Dim. 5th
+     36,  37,    // E Mnr 7th Dim. 5th
+     38,  39,    // E 7th Aug. 5th
+     40,  41,    // E 7th Minor 9th
+     42,  43,    // E 7th Aug. 9th
+     44,  45,    // E 7 Minor 9 Aug. 5
+     46,  47,    // E Seven-Six
+     48,  49,    // E 9th Dim. 5th
+     50,  51,    // E 9th Aug. 5th
+     53,  52,    // E Major 9th
+     54,  55,    // E Minor 9th
+     56,  57,    // E Nine-Six
+     58,  59,    // E Minor Nine-Six
+     61,  60,    // E Added 9th
+     62,  63,    // E 11th
+     64,  65,    // E Minor 11th
+     66,  67,    // E Augmented 11th
+     46,  68,    // E 13th
+     69,  70,    // E 13th Minor 9th
+     71,  72,    // E 13 Minor 9 Dim 5
+    110,  73,    // F Major
+    111,  92,    // F Minor
+    112,  94,    // F 6th
+    113, 114,    // F Minor 6th
+    115,  96,    // F 7th
+    116,  79,    // F Major 7th
+    117,  97,    // F Minor 7th
+    118, 119,    // F 9th
+     19,  18,    // F Diminished
+     20,  21,    // F Augmented
+     22,  23,    // F Suspended 2nd
+     24,  25,    // F 7th Susp. 2nd
+     27,  26,    // F Suspended 4th
+     29,  28,    // F 7th Susp. 4th
+     31,  30,    // F 5th
+     32,  33,    // F Diminished 5th
+     35,  34,    // F 7th Dim. 5th
+     37,  36,    // F Mnr 7th Dim. 5th
+     39,  38,    // F 7th Aug. 5th
+     41,  40,    // F 7th Minor 9th
+     43,  42,    // F 7th Aug. 9th
+     44,  45,    // F 7 Minor 9 Aug. 5
+     47,  46,    // F Seven-Six
+     48,  49,    // F 9th Dim. 5th
+     50,  51,    // F 9th Aug. 5th
+     53,  52,    // F Major 9th
+     55,  54,    // F Minor 9th
+     56,  57,    // F Nine-Six
+     58,  59,    // F Minor Nine-Six
+     61,  60,    // F Added 9th
+     63,  62,    // F 11th
+     65,  64,    // F Minor 11th
+     67,  66,    // F Augmented 11th
+     46,  68,    // F 13th
+     70,  69,    // F 13th Minor 9th
+     72,  71,    // F 13 Minor 9 Dim 5
+    110,  73,    // F# Major
+    111,  92,    // F# Minor
+     97,  94,    // F# 6th
+    120, 114,    // F# Minor 6th
+    116, 115,    // F# 7th
+    121, 122,    // F# Major 7th
+    117,  97,    // F# Minor 7th
+    123, 119,    // F# 9th
+     19,  18,    // F# Diminished
+     20,  21,    // F# Augmented
+     22,  23,    // F# Suspended 2nd
+     24,  25,    // F# 7th Susp. 2nd
+     27,  26,    // F# Suspended 4th
+     29,  28,    // F# 7th Susp. 4th
+     31,  30,    // F# 5th
+     33,  32,    // F# Diminished 5th
+     35,  34,    // F# 7th Dim. 5th
+     37,  36,    // F# Mnr 7th Dim. 5th
+     39,  38,    // F# 7th Aug. 5th
+     41,  40,    // F# 7th Minor 9th
+     43,  42,    // F# 7th Aug. 9th
+     44,  45,    // F# 7 Minor 9 Aug. 5
+     47,  46,    // F# Seven-Six
+     49,  48,    // F# 9th Dim. 5th
+     51,  50,    // F# 9th Aug. 5th
+     53,  52,    // F# Major 9th
+     55,  54,    // F# Minor 9th
+     56,  57,    // F# Nine-Six
+     58,  59,    // F# Minor Nine-Six
+     61,  60,    // F# Added 9th
+     63,  62,    // F# 11th
+     65,  64,    // F# Minor 11th
+     67,  66,    // F# Augmented 11th
+     46,  68,    // F# 13th
+     70,  69,    // F# 13th Minor 9th
+     72,  71,    // F# 13 Minor 9 Dim 5
+    124, 110, 125,    // G Major
+    111,  92,    // G Minor
+    126, 116,    // G 6th
+    127, 128,    // G Minor 6th
+    129, 115,    // G 7th
+    130, 121,    // G Major 7th
+    117,  97,    // G Minor 7th
+    131, 123,    // G 9th
+     19,  18,    // G Diminished
+     20,  21,    // G Augmented
+     22,  23,    // G Suspended 2nd
+     24,  25,    // G 7th Susp. 2nd
+     27,  26,    // G Suspended 4th
+     29,  28,    // G 7th Susp. 4th
+     31,  30,    // G 5th
+     33,  32,    // G Diminished 5th
+     35,  34,    // G 7th Dim. 5th
+     37,  36,    // G Mnr 7th Dim. 5th
+     39,  38,    // G 7th Aug. 5th
+     41,  40,    // G 7th Minor 9th
+     43,  42,    // G 7th Aug. 9th
+     45,  44,    // G 7 Minor 9 Aug. 5
+     47,  46,    // G Seven-Six
+     49,  48,    // G 9th Dim. 5th
+     51,  50,    // G 9th Aug. 5th
+     53,  52,    // G Major 9th
+     55,  54,    // G Minor 9th
+     56,  57,    // G Nine-Six
+     58,  59,    // G Minor Nine-Six
+     61,  60,    // G Added 9th
+     63,  62,    // G 11th
+     65,  64,    // G Minor 11th
+     67,  66,    // G Augmented 11th
+     46,  68,    // G 13th
+     70,  69,    // G 13th Minor 9th
+     71,  72,    // G 13 Minor 9 Dim 5
+    132, 110,    // Ab Major
+    111,  92,    // Ab Minor
+      6,  97,    // Ab 6th
+    133, 128,    // Ab Minor 6th
+    134, 115,    // Ab 7th
+    135, 121,    // Ab Major 7th
+    136, 117,    // Ab Minor 7th
+     17, 123,    // Ab 9th
+     19,  18,    // Ab Diminished
+     21,  20,    // Ab Augmented
+     23,  22,    // Ab Suspended 2nd
+     25,  24,    // Ab 7th Susp. 2nd
+     27,  26,    // Ab Suspended 4th
+     29,  28,    // Ab 7th Susp. 4th
+     31,  30,    // Ab 5th
+     33,  32,    // Ab Diminished 5th
+     35,  34,    // Ab 7th Dim. 5th
+     37,  36,    // Ab Mnr 7th Dim. 5th
+     39,  38,    // Ab 7th Aug. 5th
+     41,  40,    // Ab 7th Minor 9th
+     43,  42,    // Ab 7th Aug. 9th
+     45,  44,    // Ab 7 Minor 9 Aug. 5
+     47,  46,    // Ab Seven-Six
+     49,  48,    // Ab 9th Dim. 5th
+     50,  51,    // Ab 9th Aug. 5th
+     52,  53,    // Ab Major 9th
+     55,  54,    // Ab Minor 9th
+     57,  56,    // Ab Nine-Six
+     59,  58,    // Ab Minor Nine-Six
+     60,  61,    // Ab Added 9th
+     63,  62,    // Ab 11th
+     65,  64,    // Ab Minor 11th
+     67,  66,    // Ab Augmented 11th
+     68,  46,    // Ab 13th
+     70,  69,    // Ab 13th Minor 9th
+     71,  72,    // Ab 13 Minor 9 Dim 5
+    137, 132, 138,    // A Major
+    139, 111, 140,    // A Minor
+    141,  97,    // A 6th
+    142, 143,    // A Minor 6th
+    144, 115,    // A 7th
+    145, 121,    // A Major 7th
+    146, 117,    // A Minor 7th
+    147, 123,    // A 9th
+     19,  18,    // A Diminished
+     21,  20,    // A Augmented
+     23,  22,    // A Suspended 2nd
+     25,  24,    // A 7th Susp. 2nd
+     27,  26,    // A Suspended 4th
+     29,  28,    // A 7th Susp. 4th
+     31,  30,    // A 5th
+     33,  32,    // A Diminished 5th
+     35,  34,    // A 7th Dim. 5th
+     37,  36,    // A Mnr 7th Dim. 5th
+     39,  38,    // A 7th Aug. 5th
+     41,  40,    // A 7th Minor 9th
+     43,  42,    // A 7th Aug. 9th
+     45,  44,    // A 7 Minor 9 Aug. 5
+     47,  46,    // A Seven-Six
+     49,  48,    // A 9th Dim. 5th
+     50,  51,    // A 9th Aug. 5th
+     52,  53,    // A Major 9th
+     55,  54,    // A Minor 9th
+     57,  56,    // A Nine-Six
+     59,  58,    // A Minor Nine-Six
+     60,  61,    // A Added 9th
+     63,  62,    // A 11th
+     65,  64,    // A Minor 11th
+     67,  66,    // A Augmented 11th
+     68,  46,    // A 13th
+     70,  69,    // A 13th Minor 9th
+     71,  72,    // A 13 Minor 9 Dim 5
+      1, 132,    // Bb Major
+      4, 111,    // Bb Minor
+      6,  97,    // Bb 6th
+      8, 128,    // Bb Minor 6th
+     10, 134,    // Bb 7th
+     13, 135,    // Bb Major 7th
+     15, 117,    // Bb Minor 7th
+    148,  17,    // Bb 9th
+     19,  18,    // Bb Diminished
+     21,  20,    // Bb Augmented
+     22,  23,    // Bb Suspended 2nd
+     24,  25,    // Bb 7th Susp. 2nd
+     26,  27,    // Bb Suspended 4th
+     28,  29,    // Bb 7th Susp. 4th
+     30,  31,    // Bb 5th
+     33,  32,    // Bb Diminished 5th
+     34,  35,    // Bb 7th Dim. 5th
+     36,  37,    // Bb Mnr 7th Dim. 5th
+     38,  39,    // Bb 7th Aug. 5th
+     41,  40,    // Bb 7th Minor 9th
+     43,  42,    // Bb 7th Aug. 9th
+     45,  44,    // Bb 7 Minor 9 Aug. 5
+     46,  47,    // Bb Seven-Six
+     49,  48,    // Bb 9th Dim. 5th
+     50,  51,    // Bb 9th Aug. 5th
+     52,  53,    // Bb Major 9th
+     55,  54,    // Bb Minor 9th
+     57,  56,    // Bb Nine-Six
+     59,  58,    // Bb Minor Nine-Six
+     60,  61,    // Bb Added 9th
+     62,  63,    // Bb 11th
+     64,  65,    // Bb Minor 11th
+     66,  67,    // Bb Augmented 11th
+     46,  68,    // Bb 13th
+     70,  69,    // Bb 13th Minor 9th
+     71,  72,    // Bb 13 Minor 9 Dim 5
+      1, 132,    // B Major
+      4, 111,    // B Minor
+    136,   6,    // B 6th
+    149,   8,    // B Minor 6th
+    150,  10,    // B 7th
+     13, 135,    // B Major 7th
+    151,  15,    // B Minor 7th
+     16,  17,    // B 9th
+     18,  19,    // B Diminished
+     21,  20,    // B Augmented
+     22,  23,    // B Suspended 2nd
+     24,  25,    // B 7th Susp. 2nd
+     26,  27,    // B Suspended 4th
+     28,  29,    // B 7th Susp. 4th
+     30,  31,    // B 5th
+     32,  33,    // B Diminished 5th
+     34,  35,    // B 7th Dim. 5th
+     36,  37,    // B Mnr 7th Dim. 5th
+     38,  39,    // B 7th Aug. 5th
+     40,  41,    // B 7th Minor 9th
+     42,  43,    // B 7th Aug. 9th
+     44,  45,    // B 7 Minor 9 Aug. 5
+     46,  47,    // B Seven-Six
+     48,  49,    // B 9th Dim. 5th
+     50,  51,    // B 9th Aug. 5th
+     52,  53,    // B Major 9th
+     55,  54,    // B Minor 9th
+     56,  57,    // B Nine-Six
+     59,  58,    // B Minor Nine-Six
+     60,  61,    // B Added 9th
+     62,  63,    // B 11th
+     64,  65,    // B Minor 11th
+     66,  67,    // B Augmented 11th
+     46,  68,    // B 13th
+     69,  70,    // B 13th Minor 9th
+     71,  72    // B 13 Minor 9 Dim 5
+};
+
+// The starting fret of each voicing.  Each PACK_FRETS() holds two voicings,
+// one key per line.
+const uint8_t ChordFrets[(NUM_CHORD_VOICINGS + 1) / 2] CHORD_PROGMEM =
+{
+    // C
+    PACK_FRETS(1, 3), PACK_FRETS(1, 1), PACK_FRETS(3, 1), PACK_FRETS(5, 1),
+    PACK_FRETS(4, 1), PACK_FRETS(3, 1), PACK_FRETS(2, 3), PACK_FRETS(1, 3),
+    PACK_FRETS(2, 5), PACK_FRETS(2, 8), PACK_FRETS(1, 5), PACK_FRETS(3, 5),
+    PACK_FRETS(3, 5), PACK_FRETS(3, 8), PACK_FRETS(3, 8), PACK_FRETS(3, 8),
+    PACK_FRETS(2, 7), PACK_FRETS(3, 8), PACK_FRETS(3, 8), PACK_FRETS(3, 8),
+    PACK_FRETS(2, 8), PACK_FRETS(2, 8), PACK_FRETS(2, 6), PACK_FRETS(3, 8),
+    PACK_FRETS(2, 7), PACK_FRETS(5, 7), PACK_FRETS(5, 12), PACK_FRETS(1, 8),
+    PACK_FRETS(2, 5), PACK_FRETS(1, 5), PACK_FRETS(5, 12), PACK_FRETS(3, 8),
+    PACK_FRETS(3, 8), PACK_FRETS(3, 8), PACK_FRETS(3, 5), PACK_FRETS(2, 8),
+    PACK_FRETS(6, 8),
+    // C#
+    PACK_FRETS(1, 4), PACK_FRETS(1, 4), PACK_FRETS(1, 6),
+    PACK_FRETS(1, 2), PACK_FRETS(2, 4), PACK_FRETS(1, 4), PACK_FRETS(1, 2),
+    PACK_FRETS(3, 6), PACK_FRETS(3, 9), PACK_FRETS(2, 6), PACK_FRETS(4, 6),
+    PACK_FRETS(4, 6), PACK_FRETS(4, 9), PACK_FRETS(4, 9), PACK_FRETS(4, 9),
+    PACK_FRETS(3, 8), PACK_FRETS(4, 9), PACK_FRETS(4, 9), PACK_FRETS(4, 9),
+    PACK_FRETS(3, 9), PACK_FRETS(3, 9), PACK_FRETS(3, 7), PACK_FRETS(4, 9),
+    PACK_FRETS(3, 8), PACK_FRETS(6, 8), PACK_FRETS(1, 6), PACK_FRETS(2, 9),
+    PACK_FRETS(3, 6), PACK_FRETS(2, 6), PACK_FRETS(1, 6), PACK_FRETS(4, 9),
+    PACK_FRETS(4, 9), PACK_FRETS(4, 9), PACK_FRETS(4, 6), PACK_FRETS(3, 9),
+    PACK_FRETS(7, 9),
+    // D
+    PACK_FRETS(2, 5), PACK_FRETS(2, 1), PACK_FRETS(5, 1),
+    PACK_FRETS(2, 2), PACK_FRETS(1, 3), PACK_FRETS(1, 3), PACK_FRETS(1, 2),
+    PACK_FRETS(5, 1), PACK_FRETS(3, 1), PACK_FRETS(4, 4), PACK_FRETS(10, 3),
+    PACK_FRETS(7, 5), PACK_FRETS(7, 5), PACK_FRETS(7, 5), PACK_FRETS(10, 5),
+    PACK_FRETS(10, 5), PACK_FRETS(10, 4), PACK_FRETS(9, 5), PACK_FRETS(10, 5),
+    PACK_FRETS(10, 5), PACK_FRETS(10, 4), PACK_FRETS(10, 4), PACK_FRETS(10, 4),
+    PACK_FRETS(8, 5), PACK_FRETS(10, 4), PACK_FRETS(9, 7), PACK_FRETS(9, 2),
+    PACK_FRETS(7, 3), PACK_FRETS(10, 4), PACK_FRETS(7, 3), PACK_FRETS(7, 2),
+    PACK_FRETS(7, 5), PACK_FRETS(10, 5), PACK_FRETS(10, 5), PACK_FRETS(10, 5),
+    PACK_FRETS(7, 4), PACK_FRETS(10, 8), PACK_FRETS(10, 3),
+    // Eb
+    PACK_FRETS(6, 1),
+    PACK_FRETS(2, 1), PACK_FRETS(3, 1), PACK_FRETS(4, 1), PACK_FRETS(4, 3),
+    PACK_FRETS(6, 1), PACK_FRETS(4, 1), PACK_FRETS(1, 5), PACK_FRETS(11, 4),
+    PACK_FRETS(8, 6), PACK_FRETS(8, 6), PACK_FRETS(8, 6), PACK_FRETS(11, 6),
+    PACK_FRETS(11, 6), PACK_FRETS(11, 5), PACK_FRETS(10, 6), PACK_FRETS(11, 6),
+    PACK_FRETS(11, 6), PACK_FRETS(11, 5), PACK_FRETS(11, 5), PACK_FRETS(11, 5),
+    PACK_FRETS(9, 6), PACK_FRETS(11, 5), PACK_FRETS(10, 8), PACK_FRETS(10, 3),
+    PACK_FRETS(8, 4), PACK_FRETS(11, 5), PACK_FRETS(8, 4), PACK_FRETS(8, 3),
+    PACK_FRETS(8, 6), PACK_FRETS(11, 6), PACK_FRETS(11, 6), PACK_FRETS(11, 6),
+    PACK_FRETS(8, 5), PACK_FRETS(11, 9), PACK_FRETS(11, 1),
+    // E
+    PACK_FRETS(4, 2),
+    PACK_FRETS(2, 1), PACK_FRETS(2, 2), PACK_FRETS(2, 1), PACK_FRETS(2, 1),
+    PACK_FRETS(4, 2), PACK_FRETS(2, 1), PACK_FRETS(2, 6), PACK_FRETS(12, 5),
+    PACK_FRETS(9, 7), PACK_FRETS(9, 7), PACK_FRETS(9, 7), PACK_FRETS(12, 7),
+    PACK_FRETS(12, 7), PACK_FRETS(12, 6), PACK_FRETS(11, 7), PACK_FRETS(12, 7),
+    PACK_FRETS(12, 7), PACK_FRETS(12, 6), PACK_FRETS(12, 6), PACK_FRETS(12, 6),
+    PACK_FRETS(10, 7), PACK_FRETS(12, 6), PACK_FRETS(11, 9), PACK_FRETS(11, 4),
+    PACK_FRETS(9, 5), PACK_FRETS(12, 6), PACK_FRETS(9, 5), PACK_FRETS(9, 4),
+    PACK_FRETS(9, 7), PACK_FRETS(12, 7), PACK_FRETS(12, 7), PACK_FRETS(12, 7),
+    PACK_FRETS(9, 6), PACK_FRETS(12, 10), PACK_FRETS(12, 1),
+    // F
+    PACK_FRETS(5, 1),
+    PACK_FRETS(3, 1), PACK_FRETS(3, 1), PACK_FRETS(1, 1), PACK_FRETS(3, 1),
+    PACK_FRETS(5, 1), PACK_FRETS(3, 1), PACK_FRETS(1, 1), PACK_FRETS(7, 6),
+    PACK_FRETS(10, 8), PACK_FRETS(10, 8), PACK_FRETS(10, 1), PACK_FRETS(8, 1),
+    PACK_FRETS(8, 1), PACK_FRETS(8, 7), PACK_FRETS(12, 1), PACK_FRETS(8, 1),
+    PACK_FRETS(8, 1), PACK_FRETS(8, 1), PACK_FRETS(7, 1), PACK_FRETS(7, 7),
+    PACK_FRETS(11, 1), PACK_FRETS(8, 7), PACK_FRETS(12, 10), PACK_FRETS(12, 5),
+    PACK_FRETS(10, 1), PACK_FRETS(6, 7), PACK_FRETS(10, 6), PACK_FRETS(10, 5),
+    PACK_FRETS(10, 1), PACK_FRETS(8, 1), PACK_FRETS(8, 1), PACK_FRETS(8, 8),
+    PACK_FRETS(10, 1), PACK_FRETS(7, 1), PACK_FRETS(11, 2),
+    // F#
+    PACK_FRETS(6, 2),
+    PACK_FRETS(4, 1), PACK_FRETS(4, 1), PACK_FRETS(2, 2), PACK_FRETS(2, 1),
+    PACK_FRETS(2, 2), PACK_FRETS(4, 1), PACK_FRETS(2, 2), PACK_FRETS(8, 7),
+    PACK_FRETS(11, 9), PACK_FRETS(11, 9), PACK_FRETS(11, 2), PACK_FRETS(9, 2),
+    PACK_FRETS(9, 2), PACK_FRETS(9, 1), PACK_FRETS(8, 2), PACK_FRETS(9, 2),
+    PACK_FRETS(9, 2), PACK_FRETS(9, 2), PACK_FRETS(8, 2), PACK_FRETS(8, 8),
+    PACK_FRETS(12, 2), PACK_FRETS(9, 1), PACK_FRETS(8, 1), PACK_FRETS(11, 6),
+    PACK_FRETS(11, 2), PACK_FRETS(7, 8), PACK_FRETS(11, 7), PACK_FRETS(11, 6),
+    PACK_FRETS(11, 2), PACK_FRETS(9, 2), PACK_FRETS(9, 2), PACK_FRETS(9, 9),
+    PACK_FRETS(11, 2), PACK_FRETS(8, 2), PACK_FRETS(12, 2),
+    // G
+    PACK_FRETS(3, 2),
+    PACK_FRETS(3, 5), PACK_FRETS(2, 3), PACK_FRETS(1, 2), PACK_FRETS(1, 3),
+    PACK_FRETS(2, 2), PACK_FRETS(3, 5), PACK_FRETS(1, 2), PACK_FRETS(3, 9),
+    PACK_FRETS(8, 12), PACK_FRETS(10, 12), PACK_FRETS(10, 12), PACK_FRETS(3, 10),
+    PACK_FRETS(3, 10), PACK_FRETS(3, 10), PACK_FRETS(2, 9), PACK_FRETS(3, 10),
+    PACK_FRETS(3, 10), PACK_FRETS(3, 10), PACK_FRETS(3, 9), PACK_FRETS(3, 9),
+    PACK_FRETS(1, 9), PACK_FRETS(3, 10), PACK_FRETS(2, 9), PACK_FRETS(2, 12),
+    PACK_FRETS(7, 12), PACK_FRETS(3, 8), PACK_FRETS(9, 12), PACK_FRETS(8, 12),
+    PACK_FRETS(7, 12), PACK_FRETS(3, 10), PACK_FRETS(3, 10), PACK_FRETS(3, 10),
+    PACK_FRETS(10, 12), PACK_FRETS(3, 9), PACK_FRETS(1, 3),
+    // Ab
+    PACK_FRETS(1, 4),
+    PACK_FRETS(4, 6), PACK_FRETS(1, 3), PACK_FRETS(1, 3), PACK_FRETS(1, 4),
+    PACK_FRETS(1, 3), PACK_FRETS(1, 4), PACK_FRETS(1, 3), PACK_FRETS(4, 10),
+    PACK_FRETS(1, 9), PACK_FRETS(1, 11), PACK_FRETS(1, 11), PACK_FRETS(4, 11),
+    PACK_FRETS(4, 11), PACK_FRETS(4, 11), PACK_FRETS(3, 10), PACK_FRETS(4, 11),
+    PACK_FRETS(4, 11), PACK_FRETS(4, 11), PACK_FRETS(4, 10), PACK_FRETS(4, 10),
+    PACK_FRETS(2, 10), PACK_FRETS(4, 11), PACK_FRETS(3, 10), PACK_FRETS(1, 3),
+    PACK_FRETS(1, 8), PACK_FRETS(4, 9), PACK_FRETS(1, 10), PACK_FRETS(1, 9),
+    PACK_FRETS(1, 8), PACK_FRETS(4, 11), PACK_FRETS(4, 11), PACK_FRETS(4, 11),
+    PACK_FRETS(1, 11), PACK_FRETS(4, 10), PACK_FRETS(2, 4),
+    // A
+    PACK_FRETS(2, 2),
+    PACK_FRETS(2, 1), PACK_FRETS(5, 1), PACK_FRETS(2, 4), PACK_FRETS(1, 4),
+    PACK_FRETS(2, 5), PACK_FRETS(1, 4), PACK_FRETS(1, 5), PACK_FRETS(2, 4),
+    PACK_FRETS(5, 11), PACK_FRETS(2, 10), PACK_FRETS(2, 12), PACK_FRETS(2, 12),
+    PACK_FRETS(5, 12), PACK_FRETS(5, 12), PACK_FRETS(5, 12), PACK_FRETS(4, 11),
+    PACK_FRETS(5, 12), PACK_FRETS(5, 12), PACK_FRETS(5, 12), PACK_FRETS(5, 11),
+    PACK_FRETS(5, 11), PACK_FRETS(3, 11), PACK_FRETS(5, 12), PACK_FRETS(4, 11),
+    PACK_FRETS(2, 4), PACK_FRETS(2, 9), PACK_FRETS(5, 10), PACK_FRETS(2, 11),
+    PACK_FRETS(2, 10), PACK_FRETS(2, 9), PACK_FRETS(5, 12), PACK_FRETS(5, 12),
+    PACK_FRETS(5, 12), PACK_FRETS(2, 12), PACK_FRETS(5, 11), PACK_FRETS(3, 5),
+    // Bb
+    PACK_FRETS(1, 3), PACK_FRETS(1, 6), PACK_FRETS(3, 5), PACK_FRETS(2, 5),
+    PACK_FRETS(1, 3), PACK_FRETS(1, 3), PACK_FRETS(1, 6), PACK_FRETS(1, 3),
+    PACK_FRETS(6, 12), PACK_FRETS(3, 11), PACK_FRETS(1, 3), PACK_FRETS(1, 3),
+    PACK_FRETS(1, 6), PACK_FRETS(1, 6), PACK_FRETS(1, 6), PACK_FRETS(5, 12),
+    PACK_FRETS(1, 6), PACK_FRETS(1, 6), PACK_FRETS(1, 6), PACK_FRETS(6, 12),
+    PACK_FRETS(6, 12), PACK_FRETS(4, 12), PACK_FRETS(1, 6), PACK_FRETS(5, 12),
+    PACK_FRETS(3, 5), PACK_FRETS(3, 10), PACK_FRETS(6, 11), PACK_FRETS(3, 12),
+    PACK_FRETS(3, 11), PACK_FRETS(3, 10), PACK_FRETS(1, 6), PACK_FRETS(1, 6),
+    PACK_FRETS(1, 6), PACK_FRETS(1, 3), PACK_FRETS(6, 12), PACK_FRETS(4, 6),
+    // B
+    PACK_FRETS(2, 4), PACK_FRETS(2, 7), PACK_FRETS(1, 4), PACK_FRETS(1, 3),
+    PACK_FRETS(1, 2), PACK_FRETS(2, 4), PACK_FRETS(2, 2), PACK_FRETS(1, 4),
+    PACK_FRETS(1, 7), PACK_FRETS(4, 12), PACK_FRETS(2, 4), PACK_FRETS(2, 4),
+    PACK_FRETS(2, 7), PACK_FRETS(2, 7), PACK_FRETS(2, 7), PACK_FRETS(1, 6),
+    PACK_FRETS(2, 7), PACK_FRETS(2, 7), PACK_FRETS(2, 7), PACK_FRETS(1, 7),
+    PACK_FRETS(1, 7), PACK_FRETS(1, 5), PACK_FRETS(2, 7), PACK_FRETS(1, 6),
+    PACK_FRETS(4, 6), PACK_FRETS(4, 11), PACK_FRETS(7, 12), PACK_FRETS(1, 4),
+    PACK_FRETS(4, 12), PACK_FRETS(4, 11), PACK_FRETS(2, 7), PACK_FRETS(2, 7),
+    PACK_FRETS(2, 7), PACK_FRETS(2, 4), PACK_FRETS(1, 7), PACK_FRETS(5, 7)
+};
+#endif
+
+// The index of the first voicing of each type, one key per line, then the
+// end of the table.
+const uint16_t ChordVoicingOffsets[NUM_KEYS * NUM_CHORD_TYPES + 1] CHORD_PROGMEM =
+{
+    // C
+      0,   3,   5,   7,   9,  12,  14,  16,  18,  20,  22,  24,
+     26,  28,  30,  32,  34,  36,  38,  40,  42,  44,  46,  48,
+     50,  52,  54,  56,  58,  60,  62,  64,  66,  68,  70,  72,
+    // C#
+     74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,  96,
+     98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120,
+    122, 124, 126, 128, 130, 132, 134, 136, 138, 140, 142, 144,
+    // D
+    146, 149, 152, 154, 156, 159, 161, 163, 165, 167, 169, 171,
+    173, 175, 177, 179, 181, 183, 185, 187, 189, 191, 193, 195,
+    197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219,
+    // Eb
+    221, 223, 225, 227, 229, 231, 233, 235, 237, 239, 241, 243,
+    245, 247, 249, 251, 253, 255, 257, 259, 261, 263, 265, 267,
+    269, 271, 273, 275, 277, 279, 281, 283, 285, 287, 289, 291,
+    // E
+    293, 295, 297, 299, 301, 303, 305, 307, 309, 311, 313, 315,
+    317, 319, 321, 323, 325, 327, 329, 331, 333, 335, 337, 339,
+    341, 343, 345, 347, 349, 351, 353, 355, 357, 359, 361, 363,
+    // F
+    365, 367, 369, 371, 373, 375, 377, 379, 381, 383, 385, 387,
+    389, 391, 393, 395, 397, 399, 401, 403, 405, 407, 409, 411,
+    413, 415, 417, 419, 421, 423, 425, 427, 429, 431, 433, 435,
+    // F#
+    437, 439, 441, 443, 445, 447, 449, 451, 453, 455, 457, 459,
+    461, 463, 465, 467, 469, 471, 473, 475, 477, 479, 481, 483,
+    485, 487, 489, 491, 493, 495, 497, 499, 501, 503, 505, 507,
+    // G
+    509, 512, 514, 516, 518, 520, 522, 524, 526, 528, 530, 532,
+    534, 536, 538, 540, 542, 544, 546, 548, 550, 552, 554, 556,
+    558, 560, 562, 564, 566, 568, 570, 572, 574, 576, 578, 580,
+    // Ab
+    582, 584, 586, 588, 590, 592, 594, 596, 598, 600, 602, 604,
+    606, 608, 610, 612, 614, 616, 618, 620, 622, 624, 626, 628,
+    630, 632, 634, 636, 638, 640, 642, 644, 646, 648, 650, 652,
+    // A
+    654, 657, 660, 662, 664, 666, 668, 670, 672, 674, 676, 678,
+    680, 682, 684, 686, 688, 690, 692, 694, 696, 698, 700, 702,
+    704, 706, 708, 710, 712, 714, 716, 718, 720, 722, 724, 726,
+    // Bb
+    728, 730, 732, 734, 736, 738, 740, 742, 744, 746, 748, 750,
+    752, 754, 756, 758, 760, 762, 764, 766, 768, 770, 772, 774,
+    776, 778, 780, 782, 784, 786, 788, 790, 792, 794, 796, 798,
+    // B
+    800, 802, 804, 806, 808, 810, 812, 814, 816, 818, 820, 822,
+    824, 826, 828, 830, 832, 834, 836, 838, 840, 842, 844, 846,
+    848, 850, 852, 854, 856, 858, 860, 862, 864, 866, 868, 870,
+    // End
+    872
+};
+
+// The difficulty level of each voicing, one key per line.
+const uint8_t ChordDifficulty[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+    // C
+    5, 7, 5, 5, 7, 5, 7, 5, 5, 8, 6, 6, 4, 7, 7, 6, 7, 5, 7, 7, 6, 8, 7, 8,
+    6, 8, 8, 6, 4, 6, 6, 6, 8, 8, 6, 5, 5, 5, 8, 8, 6, 7, 6, 8, 7, 8, 7, 7,
+    6, 6, 8, 7, 7, 7, 6, 6, 6, 7, 6, 8, 7, 8, 3, 6, 5, 3, 7, 5, 7, 7, 8, 9,
+    9, 9,
+    // C#
+    8, 7, 4, 7, 8, 7, 5, 7, 6, 6, 7, 7, 6, 7, 7, 5, 7, 7, 6, 8, 7, 8,
+    6, 8, 8, 6, 4, 6, 6, 6, 8, 8, 6, 5, 5, 5, 8, 8, 6, 7, 6, 8, 7, 8, 7, 7,
+    6, 6, 8, 7, 7, 7, 6, 6, 6, 7, 6, 8, 8, 7, 3, 6, 5, 3, 7, 5, 7, 7, 8, 9,
+    9, 9,
+    // D
+    5, 7, 4, 5, 7, 5, 3, 8, 4, 7, 4, 6, 4, 3, 7, 4, 7, 4, 7, 7, 7, 6,
+    8, 7, 8, 6, 8, 8, 6, 4, 6, 6, 6, 8, 8, 6, 5, 5, 5, 8, 8, 6, 7, 6, 8, 7,
+    8, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 6, 7, 6, 8, 8, 7, 3, 6, 5, 3, 7, 5, 7,
+    7, 8, 9, 9, 9,
+    // Eb
+    8, 7, 8, 6, 7, 8, 7, 7, 7, 6, 7, 7, 7, 7, 5, 7, 7, 7, 6,
+    8, 7, 8, 6, 8, 8, 6, 4, 6, 6, 6, 8, 8, 6, 5, 5, 5, 8, 8, 6, 7, 6, 8, 7,
+    8, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 6, 7, 6, 8, 8, 7, 3, 6, 5, 3, 7, 5, 7,
+    7, 8, 9, 9, 9,
+    // E
+    4, 8, 2, 8, 4, 6, 3, 7, 5, 7, 4, 7, 1, 7, 4, 7, 7, 7, 6,
+    8, 7, 8, 6, 8, 8, 6, 4, 6, 6, 6, 8, 8, 6, 5, 5, 5, 8, 8, 6, 7, 6, 8, 7,
+    8, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 6, 7, 6, 8, 8, 7, 3, 6, 5, 3, 7, 5, 7,
+    7, 8, 9, 9, 9,
+    // F
+    7, 8, 6, 8, 5, 7, 4, 7, 8, 7, 7, 7, 6, 7, 3, 7, 7, 7, 6,
+    8, 7, 8, 6, 8, 6, 8, 6, 4, 6, 6, 8, 8, 5, 6, 5, 5, 8, 8, 7, 6, 8, 6, 7,
+    8, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 6, 7, 6, 8, 8, 7, 6, 3, 3, 5, 5, 7, 7,
+    7, 9, 8, 9, 9,
+    // F#
+    7, 8, 6, 8, 7, 7, 7, 7, 7, 8, 8, 7, 6, 7, 6, 7, 7, 7, 6,
+    8, 7, 8, 6, 8, 6, 8, 6, 4, 6, 6, 8, 8, 5, 6, 5, 5, 8, 8, 7, 6, 8, 6, 7,
+    8, 7, 7, 6, 6, 7, 8, 7, 7, 6, 6, 6, 7, 6, 8, 8, 7, 6, 3, 3, 5, 5, 7, 7,
+    7, 9, 8, 9, 9,
+    // G
+    4, 7, 4, 6, 8, 3, 7, 5, 5, 5, 8, 4, 8, 6, 7, 5, 6, 7, 7,
+    6, 8, 7, 8, 6, 8, 6, 8, 6, 4, 6, 6, 8, 8, 5, 6, 5, 5, 8, 8, 7, 6, 8, 6,
+    8, 7, 7, 7, 6, 6, 7, 8, 7, 7, 6, 6, 6, 7, 6, 8, 8, 7, 6, 3, 3, 5, 5, 7,
+    7, 7, 9, 8, 9, 9,
+    // Ab
+    8, 7, 6, 8, 7, 7, 5, 5, 5, 8, 7, 8, 4, 6, 5, 6, 7, 7,
+    8, 6, 8, 7, 8, 6, 6, 8, 6, 4, 6, 6, 8, 8, 5, 6, 5, 5, 8, 8, 7, 6, 8, 6,
+    8, 7, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 7, 6, 8, 6, 7, 8, 6, 3, 3, 5, 5, 7,
+    7, 7, 9, 8, 9, 9,
+    // A
+    3, 8, 3, 4, 6, 4, 3, 7, 4, 5, 2, 8, 4, 8, 3, 6, 5, 6,
+    7, 7, 8, 6, 8, 7, 8, 6, 6, 8, 6, 4, 6, 6, 8, 8, 5, 6, 5, 5, 8, 8, 7, 6,
+    8, 6, 8, 7, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 7, 6, 8, 6, 7, 8, 6, 3, 3, 5,
+    5, 7, 7, 7, 9, 8, 9, 9,
+    // Bb
+    7, 8, 7, 6, 7, 7, 5, 5, 6, 5, 7, 7, 6, 6, 3, 5,
+    7, 7, 8, 6, 7, 8, 6, 8, 8, 6, 4, 6, 6, 6, 8, 8, 6, 5, 5, 5, 8, 8, 7, 6,
+    8, 6, 8, 7, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 7, 6, 8, 6, 7, 8, 3, 6, 5, 3,
+    7, 5, 7, 7, 9, 8, 9, 9,
+    // B
+    7, 8, 7, 6, 4, 7, 4, 5, 7, 6, 7, 7, 3, 6, 7, 5,
+    7, 7, 8, 6, 7, 8, 6, 8, 8, 6, 4, 6, 6, 6, 8, 8, 6, 5, 5, 5, 8, 8, 6, 7,
+    6, 8, 7, 8, 7, 7, 6, 6, 8, 7, 7, 7, 6, 6, 6, 7, 8, 6, 7, 8, 3, 6, 5, 3,
+    7, 5, 7, 7, 8, 9, 9, 9
+};
+
+// The voicings sorted by difficulty, easiest first.
+const uint16_t ChordDifficultyOrder[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+    305, 295, 664,  62,  65, 134, 137, 152, 159, 209, 212, 281,
+    284, 299, 353, 356, 379, 426, 427, 498, 499, 514, 571, 572,
+    643, 644, 654, 656, 660, 668, 717, 718, 742, 788, 791, 812,
+    860, 863,  12,  28,  76, 100, 148, 154, 156, 158, 161, 163,
+    175, 247, 293, 297, 303, 307, 319, 371, 392, 464, 509, 511,
+    520, 537, 594, 609, 657, 659, 662, 666, 683, 754, 804, 806,
+    826,   0,   2,   3,   5,   7,   8,  17,  35,  36,  37,  64,
+     67,  80,  89, 107, 108, 109, 136, 139, 146, 149, 151, 182,
+    183, 184, 211, 214, 235, 254, 255, 256, 283, 286, 301, 326,
+    327, 328, 355, 358, 369, 397, 399, 400, 428, 429, 469, 471,
+    472, 500, 501, 516, 517, 518, 524, 542, 544, 545, 573, 574,
+    588, 589, 590, 596, 614, 616, 617, 645, 646, 663, 670, 688,
+    690, 691, 719, 720, 734, 735, 737, 743, 761, 762, 763, 790,
+    793, 807, 815, 833, 834, 835, 862, 865,  10,  11,  15,  20,
+     24,  27,  29,  30,  31,  34,  40,  42,  48,  49,  54,  55,
+     56,  58,  63,  82,  83,  86,  92,  96,  99, 101, 102, 103,
+    106, 112, 114, 120, 121, 126, 127, 128, 130, 135, 157, 167,
+    171, 174, 176, 177, 178, 181, 187, 189, 195, 196, 201, 202,
+    203, 205, 210, 224, 230, 239, 243, 246, 248, 249, 250, 253,
+    259, 261, 267, 268, 273, 274, 275, 277, 282, 298, 311, 315,
+    318, 320, 321, 322, 325, 331, 333, 339, 340, 345, 346, 347,
+    349, 354, 367, 377, 383, 387, 389, 391, 393, 394, 398, 404,
+    406, 411, 412, 417, 418, 419, 421, 425, 439, 449, 451, 455,
+    459, 461, 463, 465, 466, 470, 476, 478, 483, 484, 489, 490,
+    491, 493, 497, 512, 522, 525, 528, 532, 534, 536, 538, 539,
+    543, 549, 551, 556, 557, 562, 563, 564, 566, 570, 584, 595,
+    597, 601, 605, 606, 608, 610, 611, 615, 621, 623, 628, 629,
+    634, 635, 637, 639, 642, 658, 669, 671, 675, 679, 680, 682,
+    684, 685, 689, 695, 697, 702, 703, 708, 709, 711, 713, 716,
+    731, 736, 740, 741, 747, 750, 753, 755, 756, 757, 760, 767,
+    769, 774, 775, 780, 781, 783, 785, 789, 803, 809, 813, 819,
+    822, 825, 827, 828, 829, 832, 838, 840, 846, 847, 852, 853,
+    854, 857, 861,   1,   4,   6,  13,  14,  16,  18,  19,  22,
+     41,  44,  46,  47,  51,  52,  53,  57,  60,  66,  68,  69,
+     75,  77,  79,  81,  84,  85,  87,  88,  90,  91,  94, 113,
+    116, 118, 119, 123, 124, 125, 129, 133, 138, 140, 141, 147,
+    150, 155, 160, 162, 164, 165, 166, 169, 188, 191, 193, 194,
+    198, 199, 200, 204, 208, 213, 215, 216, 222, 225, 227, 228,
+    229, 231, 232, 233, 234, 236, 237, 238, 241, 260, 263, 265,
+    266, 270, 271, 272, 276, 280, 285, 287, 288, 300, 302, 304,
+    306, 308, 309, 310, 313, 332, 335, 337, 338, 342, 343, 344,
+    348, 352, 357, 359, 360, 365, 370, 372, 374, 375, 376, 378,
+    380, 381, 382, 385, 403, 407, 409, 410, 414, 415, 416, 420,
+    424, 430, 431, 432, 437, 441, 442, 443, 444, 445, 448, 450,
+    452, 453, 454, 457, 475, 479, 481, 482, 485, 487, 488, 492,
+    496, 502, 503, 504, 510, 515, 523, 526, 527, 530, 548, 553,
+    554, 555, 558, 560, 561, 565, 569, 575, 576, 577, 583, 586,
+    587, 592, 598, 599, 603, 620, 625, 626, 627, 631, 632, 633,
+    636, 640, 647, 648, 649, 661, 672, 673, 677, 694, 699, 700,
+    701, 705, 706, 707, 710, 714, 721, 722, 723, 728, 730, 732,
+    733, 738, 739, 744, 745, 748, 766, 771, 772, 773, 777, 778,
+    779, 782, 786, 792, 794, 795, 800, 802, 805, 808, 810, 811,
+    814, 816, 817, 820, 839, 842, 844, 845, 849, 850, 851, 855,
+    858, 864, 866, 867,   9,  21,  23,  25,  26,  32,  33,  38,
+     39,  43,  45,  50,  59,  61,  70,  74,  78,  93,  95,  97,
+     98, 104, 105, 110, 111, 115, 117, 122, 131, 132, 142, 153,
+    168, 170, 172, 173, 179, 180, 185, 186, 190, 192, 197, 206,
+    207, 217, 221, 223, 226, 240, 242, 244, 245, 251, 252, 257,
+    258, 262, 264, 269, 278, 279, 289, 294, 296, 312, 314, 316,
+    317, 323, 324, 329, 330, 334, 336, 341, 350, 351, 361, 366,
+    368, 373, 384, 386, 388, 390, 395, 396, 401, 402, 405, 408,
+    413, 422, 423, 434, 438, 440, 446, 447, 456, 458, 460, 462,
+    467, 468, 473, 474, 477, 480, 486, 494, 495, 506, 513, 519,
+    521, 529, 531, 533, 535, 540, 541, 546, 547, 550, 552, 559,
+    567, 568, 579, 582, 585, 591, 593, 600, 602, 604, 607, 612,
+    613, 618, 619, 622, 624, 630, 638, 641, 651, 655, 665, 667,
+    674, 676, 678, 681, 686, 687, 692, 693, 696, 698, 704, 712,
+    715, 725, 729, 746, 749, 751, 752, 758, 759, 764, 765, 768,
+    770, 776, 784, 787, 797, 801, 818, 821, 823, 824, 830, 831,
+    836, 837, 841, 843, 848, 856, 859, 868,  71,  72,  73, 143,
+    144, 145, 218, 219, 220, 290, 291, 292, 362, 363, 364, 433,
+    435, 436, 505, 507, 508, 578, 580, 581, 650, 652, 653, 724,
+    726, 727, 796, 798, 799, 869, 870, 871
+};
+
+// The rank in ChordDifficultyOrder[] of the first voicing of each level.
+const uint16_t ChordDifficultyStarts[NUM_DIFFICULTY_LEVELS + 1] CHORD_PROGMEM =
+{
+    0, 1, 3, 38, 73, 164, 387, 640, 836, 872
+};
+
+// The voice leading graph, CHORD_NEIGHBORS voicings of other chords per voicing.
+const uint8_t ChordNeighbors[CHORD_NEIGHBOR_BYTES] CHORD_PROGMEM =
+{
+    0x09, 0x30, 0xc0, 0x29, 0x05, 0x04, 0x34, 0xa0, 0x80, 0x85, 0x0b, 0x30, 0x40, 0xc1, 0xa4, 0x07,
+    0x38, 0x10, 0x8e, 0x93, 0x01, 0x58, 0xd8, 0xc0, 0x03, 0x91, 0x5a, 0xea, 0x28, 0xa5, 0x15, 0xe4,
+    0xf0, 0x19, 0x02, 0x03, 0x38, 0x10, 0x0e, 0x94, 0x9d, 0xec, 0x12, 0x8d, 0x39, 0x00, 0x30, 0xe0,
+    0x00, 0x04, 0x0d, 0x3c, 0xe0, 0x60, 0x00, 0x02, 0x38, 0x80, 0x02, 0x0b, 0x00, 0x24, 0x70, 0x92,
+    0x80, 0x01, 0x28, 0x40, 0xc0, 0x03, 0x03, 0x1c, 0xb0, 0x00, 0x0a, 0x0a, 0x10, 0xd0, 0x00, 0x06,
+    0x3c, 0xa2, 0x00, 0x03, 0x0e, 0xd1, 0xc8, 0x40, 0x43, 0x0e, 0xc5, 0x91, 0x00, 0x0e, 0x6f, 0xc6,
+    0xb9, 0x86, 0xdd, 0x07, 0x58, 0x0a, 0x00, 0xe5, 0x02, 0x37, 0x19, 0x20, 0x03, 0x0d, 0x16, 0x12,
+    0x80, 0x81, 0x07, 0x19, 0xf0, 0xf0, 0x0a, 0x0d, 0x0f, 0x58, 0xe0, 0xc3, 0xc6, 0x17, 0xbc, 0x12,
+    0xe0, 0xd2, 0x70, 0xa1, 0x01, 0x31, 0x08, 0x81, 0x75, 0x90, 0xc6, 0x60, 0x22, 0x90, 0xa0, 0x82,
+    0x0f, 0x1b, 0xfc, 0x10, 0xc4, 0x10, 0x16, 0xbc, 0x12, 0x00, 0x01, 0x19, 0x9e, 0xb1, 0x46, 0x1b,
+    0xc8, 0xe2, 0xac, 0x01, 0x4a, 0x39, 0x05, 0x95, 0xf3, 0x06, 0x24, 0x08, 0x71, 0x27, 0x07, 0x25,
+    0x0c, 0x01, 0x9d, 0x77, 0x22, 0x54, 0x29, 0x01, 0x07, 0x23, 0x20, 0x76, 0x43, 0x10, 0x2e, 0x10,
+    0xa1, 0x80, 0x08, 0x2f, 0x04, 0x9a, 0xc2, 0x10, 0x2c, 0x2c, 0xe0, 0x00, 0x04, 0x2b, 0xdc, 0x30,
+    0x04, 0x77, 0x82, 0x70, 0x40, 0x02, 0x0c, 0x29, 0xdc, 0xa0, 0xdf, 0x08, 0x28, 0x18, 0x11, 0xc5,
+    0x02, 0x61, 0xcc, 0x80, 0x44, 0x3d, 0x22, 0x98, 0xf0, 0xa9, 0x02, 0x27, 0x1c, 0x61, 0xe3, 0x08,
+    0x10, 0xa0, 0xa0, 0x82, 0x0d, 0xc5, 0xcc, 0x10, 0xc4, 0x4e, 0x11, 0xd0, 0x90, 0x83, 0xc1, 0x45,
+    0x1d, 0x55, 0x56, 0x0c, 0x3c, 0x44, 0x20, 0x43, 0x0e, 0x3d, 0x28, 0xd5, 0xec, 0xcc, 0x3a, 0xa8,
+    0x00, 0x03, 0xd2, 0x29, 0xac, 0x50, 0xc2, 0x77, 0x10, 0xa0, 0x00, 0x83, 0x0e, 0xd1, 0x18, 0x10,
+    0x81, 0x0c, 0x36, 0x20, 0x8d, 0x43, 0x66, 0xad, 0xec, 0x13, 0x60, 0x06, 0x34, 0x44, 0x70, 0x81,
+    0x0c, 0x35, 0x28, 0x25, 0x12, 0x7f, 0x40, 0xf0, 0x78, 0xae, 0xc3, 0x1d, 0x7c, 0xb7, 0xc1, 0x08,
+    0x3e, 0x70, 0x40, 0x82, 0x0a, 0xaa, 0x75, 0x30, 0x04, 0x6b, 0x22, 0x28, 0x40, 0x02, 0x10, 0x1d,
+    0x8c, 0x90, 0x42, 0x10, 0x22, 0x98, 0xf0, 0xa9, 0x02, 0xab, 0xc8, 0x90, 0x43, 0x2a, 0x2c, 0x2c,
+    0x80, 0x42, 0x14, 0x2f, 0x24, 0x31, 0xc2, 0x09, 0xff, 0x6c, 0xd4, 0xd1, 0x7b, 0x47, 0x8c, 0x50,
+    0xc2, 0x0b, 0x54, 0xbc, 0x45, 0x17, 0x17, 0x4d, 0x54, 0x31, 0x85, 0x97, 0x50, 0x58, 0x91, 0xd2,
+    0x70, 0x4b, 0x78, 0x59, 0x85, 0x17, 0x50, 0x90, 0xab, 0x2f, 0xc1, 0x5d, 0x04, 0x72, 0x5e, 0x46,
+    0x4c, 0x0c, 0xa7, 0x6f, 0x4a, 0x2c, 0x5c, 0x41, 0x1c, 0x0a, 0x57, 0xc0, 0xd1, 0xa4, 0xb7, 0x55,
+    0x58, 0xb9, 0x84, 0x22, 0x4a, 0xbc, 0xd5, 0x16, 0x1f, 0x4b, 0x4c, 0xd1, 0x84, 0x95, 0x4c, 0x08,
+    0xc0, 0x00, 0x05, 0x51, 0xb0, 0x20, 0x05, 0x1c, 0x84, 0xc2, 0x81, 0x07, 0x20, 0x19, 0xe9, 0xd1,
+    0x47, 0x20, 0x0e, 0x2a, 0x20, 0x04, 0x1b, 0x0f, 0xda, 0x17, 0xe2, 0x19, 0xa2, 0x72, 0xa0, 0x44,
+    0x14, 0x7f, 0x3d, 0xa1, 0x07, 0x12, 0x5e, 0x36, 0x01, 0x86, 0x19, 0x61, 0x14, 0x72, 0x4f, 0x1f,
+    0x5e, 0x18, 0x32, 0xb6, 0x09, 0x5f, 0xb4, 0x70, 0x4f, 0x92, 0xb8, 0xcd, 0x82, 0x35, 0x1a, 0xc9,
+    0x95, 0x41, 0xcb, 0x72, 0x6a, 0xb0, 0x21, 0x87, 0x21, 0x63, 0x1c, 0x92, 0xc8, 0x22, 0x5e, 0xdc,
+    0xe3, 0xc1, 0x12, 0x61, 0x7e, 0x20, 0x8b, 0x2d, 0x1a, 0x40, 0x2c, 0x06, 0x5c, 0x1b, 0x04, 0xa6,
+    0xd8, 0x18, 0x6c, 0x28, 0x12, 0x2c, 0x19, 0x6d, 0x2c, 0x92, 0xe1, 0x89, 0x6a, 0x7c, 0xaa, 0x05,
+    0x19, 0x6b, 0x40, 0xf7, 0xc1, 0x08, 0x76, 0x30, 0x32, 0x85, 0x1a, 0x77, 0x2c, 0x1b, 0xc7, 0x22,
+    0x74, 0x48, 0x71, 0x05, 0x16, 0x73, 0xfc, 0xb1, 0x48, 0x89, 0xcd, 0x90, 0xc1, 0x06, 0x1e, 0x71,
+    0xfc, 0x31, 0xe4, 0x1a, 0x70, 0x38, 0xb2, 0x89, 0x28, 0xac, 0xec, 0x01, 0x49, 0x4f, 0x6a, 0xb8,
+    0x31, 0x05, 0x1b, 0x6f, 0x3c, 0xf2, 0xe7, 0x1a, 0x40, 0x60, 0x01, 0x87, 0x1c, 0x0d, 0x05, 0xb1,
+    0x47, 0x22, 0x59, 0xf4, 0x11, 0xc8, 0xd3, 0x8e, 0x41, 0xe6, 0x5a, 0x1e, 0x84, 0xcc, 0x95, 0x97,
+    0x92, 0x85, 0x64, 0xa1, 0x47, 0x20, 0x82, 0xa8, 0x20, 0x07, 0x1e, 0x71, 0xcc, 0xd1, 0x46, 0x8a,
+    0x40, 0x60, 0x01, 0x07, 0x1e, 0x19, 0x3d, 0x91, 0x85, 0x1e, 0x2a, 0xf8, 0x01, 0x48, 0x78, 0xf5,
+    0x0c, 0x95, 0x64, 0x18, 0x7c, 0x44, 0xa6, 0x04, 0x13, 0x7d, 0x64, 0xf1, 0x85, 0x1e, 0x88, 0x10,
+    0xfa, 0xf2, 0xd5, 0x65, 0xa4, 0x38, 0xc6, 0x1a, 0x86, 0x90, 0xc1, 0x86, 0x1c, 0xf2, 0x95, 0xb1,
+    0x08, 0x7d, 0x6a, 0x4c, 0xc1, 0x06, 0x22, 0x65, 0xac, 0x11, 0x47, 0x22, 0x6a, 0xb8, 0x31, 0x05,
+    0x1b, 0xf3, 0xe8, 0x11, 0x48, 0x3c, 0x74, 0xc0, 0xb1, 0x89, 0x89, 0x77, 0x44, 0xb2, 0xc6, 0x1b,
+    0x47, 0x8d, 0x55, 0x16, 0x8e, 0x8f, 0xac, 0xd1, 0xc6, 0x1d, 0x98, 0x7c, 0x52, 0x09, 0x27, 0x96,
+    0x80, 0x82, 0x6a, 0x2a, 0x97, 0x78, 0xf2, 0x4c, 0x6c, 0x9a, 0x48, 0x12, 0x57, 0x66, 0x93, 0xa0,
+    0x0a, 0x4a, 0x2a, 0x94, 0xe8, 0xa0, 0x89, 0x27, 0x92, 0x70, 0xf2, 0x09, 0xcb, 0x2d, 0x0b, 0xcd,
+    0xb4, 0xd8, 0x95, 0xc4, 0x85, 0x49, 0x28, 0x74, 0x88, 0x32, 0x2e, 0x1c, 0x98, 0x7c, 0x32, 0x8a,
+    0x24, 0x08, 0x88, 0xb2, 0x8b, 0x5c, 0x94, 0x84, 0x32, 0x97, 0x93, 0x92, 0x60, 0xc2, 0xc9, 0x6e,
+    0x93, 0x58, 0x02, 0x6a, 0x35, 0x71, 0x69, 0xc2, 0xc9, 0x28, 0x9b, 0xd0, 0xd1, 0xc9, 0x2e, 0x9c,
+    0x60, 0xf2, 0x49, 0x28, 0xce, 0xee, 0x32, 0xcc, 0x32, 0x56, 0x4e, 0xa1, 0xc8, 0x2d, 0x57, 0xfe,
+    0x98, 0xa6, 0x2c, 0xea, 0x8e, 0x4b, 0x02, 0x19, 0xc7, 0x15, 0x53, 0x02, 0x24, 0xa8, 0x5a, 0xb2,
+    0x4a, 0x2c, 0xac, 0x40, 0xf3, 0x13, 0x32, 0x45, 0xa4, 0x12, 0x4d, 0x04, 0xaa, 0xd4, 0xf1, 0x53,
+    0x31, 0x01, 0xee, 0xb0, 0xcf, 0x2c, 0x12, 0xc2, 0xc2, 0x0f, 0x85, 0x11, 0x78, 0x50, 0xcb, 0x2d,
+    0xae, 0x48, 0x43, 0x8d, 0x35, 0xa9, 0xfc, 0x64, 0xc6, 0x24, 0xab, 0x9e, 0xa1, 0x8f, 0x3f, 0x62,
+    0x60, 0xdd, 0x0a, 0x6e, 0x63, 0x24, 0x27, 0x9d, 0x2b, 0xb7, 0x54, 0x93, 0xf0, 0x2b, 0xb8, 0x58,
+    0x13, 0xe6, 0x9b, 0xb5, 0x94, 0xf2, 0x4a, 0x2f, 0xb6, 0x64, 0x78, 0xc6, 0x1a, 0xc1, 0x5c, 0x53,
+    0x4b, 0x35, 0xc2, 0x4c, 0xcc, 0x8b, 0x35, 0xbf, 0x20, 0xd0, 0x89, 0x28, 0xbe, 0x28, 0x63, 0x4d,
+    0x9b, 0x15, 0xbd, 0x72, 0xcb, 0x30, 0xbc, 0x28, 0xb3, 0xa8, 0x2d, 0xbb, 0x64, 0x43, 0x4e, 0x04,
+    0xf4, 0x94, 0x60, 0xcc, 0x36, 0xb5, 0xe4, 0x72, 0x4b, 0x35, 0xba, 0x68, 0x93, 0xac, 0x2d, 0x88,
+    0x90, 0xb2, 0x4b, 0x2f, 0x55, 0x25, 0x62, 0x0c, 0x35, 0x31, 0x20, 0xc3, 0x0c, 0x2a, 0xd6, 0x61,
+    0x67, 0x1f, 0x31, 0xcf, 0x04, 0x07, 0x29, 0xa5, 0xd0, 0x14, 0xc3, 0xcc, 0x4f, 0xcd, 0xc8, 0xd1,
+    0xcb, 0x30, 0xbc, 0xf8, 0x82, 0x4b, 0x9c, 0x88, 0x90, 0xb2, 0xcb, 0x30, 0x61, 0x15, 0x83, 0xcc,
+    0x58, 0x72, 0x24, 0xb3, 0x8c, 0x8a, 0x3d, 0x2d, 0xc6, 0x4a, 0x1d, 0xc7, 0x50, 0x92, 0x1d, 0x0c,
+    0xc8, 0xa8, 0x52, 0x0c, 0x33, 0x11, 0xe4, 0x30, 0x8d, 0xb3, 0xb0, 0xc4, 0xe9, 0x8a, 0x2d, 0xd1,
+    0x44, 0x90, 0xc3, 0x2b, 0x3b, 0xc2, 0x62, 0x4d, 0x8f, 0xb5, 0xdc, 0x32, 0x4d, 0x3b, 0xb0, 0xd8,
+    0xc2, 0x0b, 0x35, 0xb5, 0xe4, 0x72, 0x4b, 0x35, 0x3b, 0x15, 0xc3, 0x4c, 0x4e, 0xbf, 0xec, 0x42,
+    0x8e, 0x9b, 0xc2, 0x70, 0x63, 0x8b, 0x2e, 0x90, 0xb1, 0xe6, 0x5a, 0xa0, 0xda, 0xd8, 0x82, 0x8b,
+    0x30, 0xe7, 0x00, 0xf8, 0xc0, 0x3b, 0xe8, 0xc4, 0x1b, 0x4f, 0x3e, 0xf0, 0xa6, 0x93, 0xdb, 0x38,
+    0x12, 0x90, 0x60, 0xad, 0xca, 0xe3, 0x94, 0x93, 0xda, 0x00, 0x0f, 0x90, 0xe0, 0x02, 0x11, 0xe1,
+    0xa4, 0x93, 0x5b, 0x39, 0xbf, 0xa8, 0xb3, 0xf2, 0x2e, 0xe1, 0xa4, 0x93, 0xdb, 0x38, 0x08, 0xa8,
+    0x33, 0x90, 0x6e, 0xdd, 0x00, 0xe8, 0xdf, 0x43, 0xde, 0xa0, 0xdb, 0x51, 0x4d, 0xe3, 0x94, 0xf3,
+    0x4d, 0x38, 0xe4, 0xfc, 0x62, 0xce, 0x40, 0x16, 0xa7, 0x93, 0x1b, 0xc5, 0xe9, 0xe4, 0x36, 0x4e,
+    0x39, 0xa0, 0x56, 0xf3, 0x0f, 0x28, 0xa1, 0x1e, 0x3a, 0xab, 0x3e, 0x32, 0xaf, 0x8c, 0x00, 0x1b,
+    0x10, 0x36, 0xd4, 0xc6, 0x36, 0xf1, 0xce, 0x93, 0x8f, 0x37, 0xf4, 0x60, 0x84, 0x18, 0x44, 0x8d,
+    0xc4, 0x93, 0x51, 0x16, 0xf2, 0x00, 0x83, 0x58, 0x43, 0x49, 0x0e, 0x32, 0xd4, 0x3e, 0x5b, 0xe2,
+    0x43, 0x54, 0x97, 0x59, 0x98, 0xd1, 0xcf, 0x3f, 0xf6, 0x68, 0xc4, 0x91, 0x47, 0xf1, 0x20, 0x16,
+    0x8b, 0x37, 0xb2, 0x08, 0x65, 0x14, 0x52, 0x3b, 0xb4, 0x52, 0x4f, 0x80, 0xae, 0x48, 0xb8, 0xa1,
+    0x3d, 0xff, 0x74, 0x14, 0xf5, 0x3d, 0x00, 0x79, 0xb4, 0x6a, 0xae, 0xfd, 0xb4, 0x73, 0x4f, 0x41,
+    0xfe, 0x84, 0x29, 0x8b, 0x2d, 0x09, 0x7d, 0xd4, 0x4f, 0x47, 0x0a, 0x6d, 0x4d, 0x90, 0x47, 0x07,
+    0x45, 0x60, 0x8e, 0x3a, 0x06, 0x49, 0xe4, 0xd1, 0xad, 0x5d, 0xdd, 0xf3, 0xcf, 0x42, 0x04, 0x49,
+    0x54, 0xad, 0x3f, 0x03, 0x85, 0x94, 0x45, 0x04, 0x3c, 0xb5, 0xe1, 0xd0, 0x48, 0xfd, 0x04, 0xf4,
+    0x4f, 0x47, 0x02, 0x89, 0x14, 0xb1, 0x3f, 0xd3, 0x0c, 0x54, 0x50, 0x44, 0x9d, 0x51, 0xe3, 0x10,
+    0x47, 0x79, 0x40, 0x44, 0x11, 0x3c, 0x1f, 0x86, 0xf8, 0x23, 0x43, 0x17, 0x15, 0xa8, 0x20, 0xb7,
+    0x18, 0x35, 0x44, 0x11, 0x62, 0x15, 0xf5, 0x52, 0xd0, 0x42, 0x04, 0x19, 0x04, 0xd0, 0xae, 0x11,
+    0x4c, 0x33, 0xd0, 0x42, 0xaa, 0x35, 0x04, 0x11, 0x6b, 0xbd, 0x44, 0x34, 0x91, 0x9c, 0x86, 0x51,
+    0x47, 0x0f, 0x30, 0x0f, 0x89, 0x08, 0x04, 0x1e, 0x10, 0xc9, 0xd3, 0x10, 0x45, 0x59, 0x04, 0xb2,
+    0xd1, 0xc5, 0xf8, 0xec, 0x6a, 0x8f, 0x3f, 0x19, 0x65, 0x11, 0xc8, 0x3d, 0x83, 0xe2, 0xe3, 0x51,
+    0xa1, 0xfd, 0xfc, 0xb3, 0x51, 0x4d, 0xf8, 0xf8, 0x43, 0x10, 0x47, 0xfd, 0x04, 0xf4, 0x4f, 0x47,
+    0x83, 0x35, 0x44, 0x51, 0x60, 0x07, 0x0d, 0x84, 0x2b, 0x0f, 0x0a, 0x91, 0xd4, 0x83, 0x3f, 0xd8,
+    0xd1, 0x67, 0xdf, 0xb2, 0x22, 0xf9, 0x03, 0x90, 0x42, 0x27, 0xa5, 0xd4, 0xd2, 0x4b, 0x30, 0x21,
+    0x79, 0xd3, 0x57, 0x25, 0xad, 0x14, 0x13, 0x03, 0x38, 0xcb, 0x04, 0x02, 0x4b, 0x25, 0xad, 0xd4,
+    0x92, 0xa6, 0x2e, 0xc5, 0xb7, 0x92, 0xa7, 0x27, 0xa5, 0x84, 0x69, 0x49, 0x32, 0xa1, 0xa0, 0xd2,
+    0x73, 0x25, 0xa5, 0x74, 0xd2, 0x4a, 0x2a, 0xc9, 0x14, 0xdf, 0x49, 0x25, 0x9d, 0x94, 0x52, 0x4b,
+    0x26, 0x21, 0x79, 0xe4, 0x55, 0x27, 0x09, 0x58, 0xd2, 0x4a, 0x2c, 0xa1, 0xe4, 0x12, 0x4d, 0x26,
+    0x97, 0xf4, 0x52, 0x4c, 0x32, 0xc1, 0xc0, 0x92, 0x4b, 0xe8, 0x76, 0x74, 0x14, 0x3a, 0xe9, 0x46,
+    0x2b, 0x14, 0x52, 0x15, 0x18, 0x70, 0xcb, 0x3d, 0x59, 0x56, 0x85, 0xcb, 0x48, 0x39, 0xef, 0x14,
+    0x54, 0x08, 0x3c, 0x81, 0x05, 0x1d, 0x56, 0xd8, 0xe4, 0x14, 0x56, 0x0c, 0x3a, 0x21, 0x04, 0x5d,
+    0x55, 0xce, 0x2c, 0x36, 0x54, 0x1d, 0xa5, 0x02, 0xc5, 0xd8, 0xa9, 0xb1, 0x14, 0x75, 0x54, 0x53,
+    0x3e, 0x89, 0x45, 0x96, 0x59, 0x39, 0x41, 0x17, 0x42, 0x3e, 0xfa, 0xd8, 0x64, 0x14, 0x52, 0x83,
+    0xd4, 0xd3, 0x53, 0x92, 0xf6, 0x6c, 0x39, 0xa6, 0x4f, 0x33, 0x1c, 0x55, 0xd6, 0x4f, 0x48, 0x99,
+    0x15, 0xb0, 0x3e, 0x45, 0xcd, 0x50, 0xd3, 0x4f, 0x46, 0xad, 0xaa, 0x8f, 0x3f, 0x51, 0x9d, 0x55,
+    0x54, 0x59, 0x3d, 0x48, 0x55, 0x03, 0x53, 0x4f, 0x65, 0x31, 0xd5, 0x56, 0x4e, 0x69, 0x65, 0xd6,
+    0xbf, 0xa5, 0xfd, 0x74, 0xd4, 0x54, 0x4c, 0x69, 0xd5, 0xb1, 0x51, 0x4b, 0xa5, 0x95, 0x45, 0x1f,
+    0x84, 0xe1, 0x62, 0xd5, 0x5a, 0x45, 0x25, 0x35, 0xc3, 0x51, 0x4a, 0xa9, 0x95, 0xb5, 0x51, 0x1b,
+    0x2d, 0xd5, 0x54, 0x56, 0xe6, 0x71, 0x64, 0x15, 0x59, 0xc4, 0x60, 0xc5, 0x15, 0x4e, 0x67, 0xa6,
+    0x79, 0x28, 0x55, 0x5f, 0x35, 0x39, 0x65, 0xc9, 0x60, 0x55, 0xc5, 0x15, 0x74, 0x5d, 0x15, 0xd4,
+    0xd4, 0x54, 0x4c, 0x39, 0x85, 0xd4, 0xc0, 0x59, 0x6c, 0xb4, 0xd4, 0x54, 0xf2, 0x55, 0x85, 0x15,
+    0x7d, 0x05, 0x65, 0xb5, 0x15, 0xaf, 0xce, 0x75, 0xc8, 0x13, 0x42, 0x57, 0xa9, 0x89, 0xc8, 0x30,
+    0x58, 0xe9, 0x54, 0x15, 0x57, 0xcc, 0x8c, 0xf5, 0xf5, 0x4e, 0x40, 0x0d, 0xec, 0x93, 0x51, 0x61,
+    0x31, 0xf3, 0xd3, 0x51, 0xcd, 0x02, 0x65, 0xd6, 0xb3, 0x45, 0xcd, 0x70, 0xd4, 0x58, 0x40, 0x19,
+    0xc5, 0x14, 0x59, 0x45, 0x25, 0x35, 0xc3, 0x51, 0xcb, 0x55, 0xc5, 0x55, 0x72, 0x4f, 0x2d, 0x05,
+    0x70, 0x21, 0x52, 0xb1, 0x65, 0x94, 0x52, 0x21, 0xf6, 0xf8, 0xe3, 0xc4, 0x6a, 0x19, 0x85, 0x94,
+    0x54, 0x6f, 0xdd, 0x45, 0x45, 0x5c, 0x78, 0x49, 0xfa, 0xd7, 0x69, 0x54, 0xb4, 0xa5, 0x04, 0x5d,
+    0x1a, 0xe8, 0xb5, 0x24, 0x1a, 0x9a, 0x84, 0x52, 0x09, 0x27, 0x76, 0xe9, 0x48, 0x47, 0x27, 0x7c,
+    0x78, 0x12, 0x8a, 0x93, 0x7d, 0x29, 0xf1, 0x16, 0xb8, 0x99, 0xe9, 0x50, 0x89, 0x26, 0x72, 0xe9,
+    0xb5, 0xa4, 0x8e, 0x6d, 0xbd, 0x25, 0xc0, 0x02, 0x6e, 0x49, 0xfa, 0x59, 0xa7, 0x7c, 0xbc, 0xb5,
+    0xd7, 0x64, 0x76, 0xc1, 0x25, 0x57, 0x93, 0x71, 0xe5, 0x75, 0xd8, 0x6a, 0x93, 0x55, 0x16, 0x9a,
+    0x03, 0x74, 0x81, 0x0b, 0xb3, 0xb8, 0x31, 0x97, 0x05, 0xd9, 0x4e, 0x5d, 0x3c, 0xf1, 0xcf, 0x4f,
+    0xa3, 0x76, 0x06, 0xd0, 0x5a, 0x1b, 0x0c, 0xa6, 0x58, 0x07, 0x84, 0xa1, 0x96, 0x21, 0x68, 0x20,
+    0x05, 0xa6, 0xda, 0x06, 0x82, 0x41, 0x95, 0x61, 0x67, 0xda, 0xb2, 0x7b, 0x18, 0xb6, 0x16, 0x51,
+    0xb7, 0x58, 0x07, 0xe3, 0xec, 0x55, 0x58, 0x6a, 0x25, 0xe4, 0xe3, 0x18, 0x64, 0x1c, 0xb4, 0xf5,
+    0x16, 0x5d, 0x81, 0x65, 0xb8, 0x41, 0x1a, 0xce, 0xf4, 0x64, 0x58, 0x1d, 0x3e, 0x95, 0xda, 0x2a,
+    0x50, 0x8f, 0xb5, 0xa6, 0x33, 0xd2, 0x7b, 0x40, 0xe6, 0x1a, 0x62, 0x8d, 0x31, 0x29, 0xef, 0x4b,
+    0x8e, 0xed, 0xe1, 0x17, 0x62, 0x84, 0x64, 0xa6, 0x04, 0x1f, 0x9a, 0xbd, 0xe6, 0x98, 0x6b, 0x7c,
+    0xe5, 0x55, 0x59, 0x68, 0x97, 0x6d, 0x36, 0x9a, 0x6a, 0x7c, 0x4d, 0x16, 0x1a, 0xd9, 0xed, 0x21,
+    0x06, 0xd9, 0x66, 0x94, 0xc9, 0x86, 0x0c, 0x62, 0xcc, 0x01, 0xe4, 0x19, 0x6d, 0x75, 0xe9, 0x50,
+    0x49, 0x64, 0x8e, 0x49, 0xb6, 0x07, 0x64, 0x63, 0x51, 0x66, 0x99, 0x68, 0x2f, 0x92, 0xe5, 0xd9,
+    0xa9, 0x0c, 0x81, 0x46, 0x1a, 0x60, 0xb1, 0xce, 0x1a, 0x2d, 0x67, 0xa7, 0x19, 0x80, 0xc0, 0xa5,
+    0xa8, 0x75, 0x46, 0x5a, 0x86, 0x7c, 0x41, 0x99, 0xd7, 0x64, 0xa5, 0x35, 0x65, 0xd9, 0x66, 0x63,
+    0x51, 0xb6, 0x59, 0x69, 0x3b, 0x76, 0x06, 0x5a, 0x8f, 0x4d, 0x89, 0x36, 0x5a, 0xc1, 0x17, 0x96,
+    0x49, 0x18, 0x54, 0x9f, 0xd1, 0x6a, 0x00, 0x02, 0xa0, 0x09, 0xd6, 0x19, 0x69, 0xe1, 0x8c, 0x53,
+    0xce, 0x61, 0x41, 0x50, 0xc4, 0xda, 0x60, 0xe6, 0x52, 0x9c, 0xd7, 0x5e, 0xaa, 0x05, 0x41, 0x11,
+    0x62, 0x71, 0xe5, 0xb5, 0xd7, 0x61, 0x8e, 0xed, 0x01, 0x19, 0x6b, 0x8e, 0x49, 0xb6, 0x07, 0x64,
+    0x14, 0x76, 0x46, 0x9a, 0x84, 0x94, 0x64, 0x36, 0x9b, 0x0e, 0x97, 0x51, 0x96, 0x34, 0x34, 0xb1,
+    0x35, 0xf6, 0x58, 0x66, 0x69, 0x16, 0x7a, 0xe8, 0xd6, 0xb7, 0xf5, 0x06, 0xdc, 0x27, 0xdb, 0x1e,
+    0xf7, 0x1e, 0xba, 0xb5, 0x7d, 0xc2, 0x5b, 0x6f, 0x62, 0x08, 0x57, 0xe9, 0x2c, 0xe3, 0x94, 0xf3,
+    0x4d, 0x38, 0x82, 0xfe, 0x62, 0x8e, 0x3a, 0x9f, 0xb8, 0x2c, 0x09, 0x26, 0xc5, 0x49, 0x70, 0x5b,
+    0xca, 0xb5, 0xdd, 0x06, 0x1c, 0x71, 0xe1, 0x09, 0x52, 0x5d, 0x76, 0xda, 0xb2, 0x5b, 0xd8, 0x74,
+    0xb5, 0xdd, 0xd6, 0x5b, 0x70, 0x9f, 0x1c, 0x73, 0xdb, 0x6e, 0xb8, 0xe9, 0x76, 0xa9, 0x18, 0x50,
+    0xe8, 0xcb, 0xc4, 0x78, 0x51, 0x6c, 0xd7, 0x5d, 0x7a, 0x12, 0xf0, 0x96, 0xb2, 0xca, 0x13, 0xb8,
+    0x86, 0xdd, 0x60, 0xa8, 0x94, 0x70, 0x14, 0x62, 0xeb, 0x9a, 0x87, 0x14, 0x6d, 0x63, 0x2c, 0x27,
+    0x5d, 0x19, 0xcc, 0xc1, 0x17, 0x26, 0x7a, 0x68, 0x25, 0x27, 0xdf, 0x18, 0xca, 0x61, 0x16, 0xa6,
+    0x79, 0x22, 0xd3, 0xfc, 0x1c, 0xc8, 0x5e, 0x75, 0x48, 0x5d, 0x19, 0x2c, 0x35, 0x17, 0xdf, 0x7c,
+    0x23, 0xb4, 0x11, 0x94, 0x75, 0x64, 0x24, 0x56, 0xdb, 0x6d, 0xc9, 0x85, 0x39, 0x06, 0x2d, 0x85,
+    0xfd, 0xc6, 0x2e, 0xbd, 0x16, 0x19, 0xe6, 0x5c, 0x12, 0xd7, 0x71, 0xa0, 0x42, 0x7d, 0xc6, 0x60,
+    0x67, 0x1f, 0x74, 0xd5, 0xe9, 0x4c, 0x01, 0x07, 0xd6, 0x19, 0x63, 0x1c, 0x74, 0xcf, 0x84, 0x07,
+    0x83, 0x24, 0xe2, 0xdd, 0x67, 0x9d, 0x7d, 0xc4, 0xa1, 0x10, 0x05, 0x70, 0xdf, 0xa5, 0x30, 0x04,
+    0x79, 0xc4, 0x19, 0x11, 0xc5, 0x76, 0x36, 0x8e, 0x00, 0x1d, 0x76, 0xdc, 0xe9, 0x37, 0x42, 0x0a,
+    0x15, 0x22, 0xc5, 0x5f, 0xaa, 0xbe, 0x09, 0x92, 0x5d, 0x7e, 0xd6, 0x69, 0x67, 0x0c, 0x76, 0xc3,
+    0x51, 0x69, 0x27, 0x14, 0x43, 0xb0, 0xc6, 0x9d, 0x77, 0xf8, 0xea, 0x8b, 0x31, 0x14, 0x54, 0xa1,
+    0xc7, 0x1e, 0x72, 0xef, 0x3d, 0xf1, 0x6d, 0xb9, 0xf0, 0x99, 0xc7, 0x5e, 0x98, 0xc4, 0x45, 0x11,
+    0xdc, 0x76, 0xed, 0x59, 0xe6, 0x1d, 0x79, 0xac, 0x71, 0x47, 0x5e, 0x7b, 0x83, 0x9a, 0x87, 0x5e,
+    0xa1, 0x96, 0xa9, 0xb7, 0x5e, 0xd3, 0x5f, 0xbe, 0xca, 0x1c, 0x66, 0xe7, 0xf5, 0x8b, 0xc4, 0x13,
+    0xe8, 0x29, 0x67, 0x1e, 0x7b, 0x2a, 0xb1, 0xe4, 0xd2, 0x73, 0x89, 0x70, 0x45, 0xdf, 0x72, 0x2e,
+    0x73, 0xfd, 0xc9, 0x6e, 0xf2, 0x25, 0xc2, 0x15, 0x74, 0x28, 0xc0, 0x00, 0x5c, 0x70, 0xd6, 0x19,
+    0x83, 0x1d, 0x7d, 0xd6, 0x69, 0x67, 0x0c, 0x76, 0x5d, 0x9a, 0xc7, 0xde, 0x96, 0xe1, 0xed, 0x57,
+    0x20, 0x04, 0xdf, 0xad, 0xc0, 0xdd, 0x08, 0xf9, 0x41, 0xa0, 0x02, 0x0e, 0x3d, 0xcc, 0xfa, 0x6c,
+    0xb4, 0x02, 0x22, 0x18, 0x93, 0x81, 0x00, 0x0e, 0x78, 0x4e, 0x37, 0x02, 0x22, 0x08, 0x41, 0x4c,
+    0xe7, 0xf8, 0xd7, 0xcd, 0x80, 0xad, 0x2c, 0xd8, 0x6d, 0x06, 0x31, 0xf5, 0x67, 0x20, 0x82, 0xfe,
+    0x01, 0x78, 0x8e, 0x86, 0x50, 0xe0, 0x8b, 0x31, 0x13, 0x10, 0xa0, 0x00, 0x03, 0x0e, 0x02, 0x22,
+    0xc8, 0x60, 0x4c, 0x2a, 0x36, 0xe3, 0xa1, 0x88, 0xfd, 0x09, 0x68, 0x60, 0x4c, 0x22, 0xd3, 0x6c,
+    0x01, 0x06, 0x0f, 0x01, 0x48, 0xa2, 0x8c, 0x01, 0x7e, 0x1b, 0x41, 0x2b, 0x06, 0x0a, 0x88, 0x20,
+    0xcb, 0x42, 0xe3, 0xe0, 0x03, 0x8b, 0x0a, 0x68, 0xd1, 0xc0, 0x03, 0x5b, 0xd8, 0x17, 0xe2, 0x72,
+    0xf0, 0xdc, 0xd0, 0x06, 0x64, 0x33, 0xbf, 0x58, 0x03, 0x7f, 0xae, 0x50, 0xb8, 0x21, 0x2c, 0x15,
+    0xe6, 0xb8, 0x6a, 0x8c, 0xb0, 0x49, 0xb8, 0xa3, 0x2b, 0x13, 0x82, 0xb7, 0xea, 0x8b, 0x04, 0x58,
+    0x10, 0x00, 0x86, 0xa6, 0x95, 0xd9, 0xe1, 0x07, 0x16, 0xea, 0xc8, 0xa3, 0x8f, 0x1f, 0xac, 0x81,
+    0x8b, 0x62, 0xaf, 0x44, 0xe7, 0x1f, 0x80, 0x12, 0xae, 0xea, 0x0a, 0x3f, 0xcd, 0x25, 0x48, 0x33,
+    0xcf, 0x5e, 0x39, 0x77, 0x61, 0x24, 0x20, 0x92, 0x21, 0x87, 0x8f, 0x0e, 0x85, 0xf8, 0x63, 0x86,
+    0x1e, 0x72, 0xc0, 0x05, 0x19, 0x1f, 0x3a, 0xf4, 0x60, 0x86, 0x17, 0xa9, 0x88, 0x47, 0x37, 0x2b,
+    0x02, 0xf9, 0xe1, 0x8f, 0x70, 0x6c, 0xa2, 0xa0, 0x89, 0x29, 0xc6, 0xb1, 0x48, 0x8b, 0x8e, 0x6c,
+    0x42, 0xa2, 0x8c, 0x7f, 0xae, 0x91, 0x61, 0x88, 0x2f, 0x19, 0xc8, 0x20, 0x93, 0x25, 0x0e, 0xb9,
+    0x46, 0x1c, 0x07, 0x36, 0x23, 0xa2, 0x90, 0x1f, 0x8e, 0xe8, 0x50, 0x88, 0x0d, 0x02, 0x3b, 0x5f,
+    0x7f, 0x8b, 0xd0, 0x57, 0xe2, 0x89, 0x40, 0x0b, 0x0d, 0x36, 0x83, 0x9c, 0xc5, 0x58, 0x63, 0x84,
+    0x38, 0x86, 0x75, 0x5c, 0xd1, 0x39, 0xbe, 0x58, 0xe3, 0xaa, 0xe3, 0x6e, 0xa2, 0x20, 0x89, 0x36,
+    0x7a, 0x77, 0x62, 0x8b, 0xf4, 0x95, 0xd8, 0xa2, 0x8d, 0xcd, 0xbe, 0x18, 0xe3, 0xb3, 0xde, 0xcd,
+    0xf8, 0x02, 0x8d, 0xa9, 0xde, 0x5b, 0x21, 0x78, 0x30, 0x16, 0x0d, 0xc9, 0x58, 0x31, 0x4e, 0xf8,
+    0x62, 0x8d, 0x72, 0xd9, 0x85, 0x21, 0x1d, 0xd4, 0x90, 0xd6, 0x23, 0x85, 0x10, 0xf8, 0x00, 0x84,
+    0x82, 0x3b, 0x52, 0x43, 0x5a, 0x86, 0x70, 0xe0, 0xa1, 0x20, 0x86, 0x1f, 0x3a, 0x14, 0x62, 0x8f,
+    0x1f, 0x8e, 0xe8, 0x50, 0x88, 0xa7, 0xbe, 0x58, 0x63, 0xa9, 0x2a, 0x16, 0xd9, 0x24, 0x16, 0x29,
+    0xce, 0x51, 0xe2, 0x1a, 0x4c, 0x40, 0x41, 0x48, 0x4a, 0x42, 0x62, 0x21, 0x07, 0x20, 0x50, 0x62,
+    0x09, 0x28, 0x05, 0x48, 0xc2, 0x64, 0xd2, 0x94, 0x30, 0x1d, 0x69, 0xd2, 0x94, 0xf5, 0x84, 0x31,
+    0xc8, 0x50, 0x7c, 0x60, 0xc9, 0x27, 0x05, 0x76, 0xc1, 0x25, 0x57, 0x93, 0x2f, 0xe5, 0xf5, 0xd8,
+    0x6a, 0x52, 0x60, 0x01, 0x07, 0x1e, 0x52, 0x52, 0x49, 0xf2, 0x00, 0x72, 0x56, 0x64, 0xa6, 0x9a,
+    0xa1, 0x0d, 0x70, 0x80, 0x03, 0x04, 0x58, 0x10, 0x80, 0x07, 0x4e, 0x52, 0x69, 0xf5, 0x00, 0x57,
+    0x21, 0xc9, 0xa6, 0x9e, 0x4e, 0x52, 0x3c, 0xce, 0x6a, 0x24, 0x88, 0x00, 0x84, 0x10, 0x53, 0x94,
+    0x52, 0xc5, 0x12, 0xa6, 0xfc, 0x98, 0x26, 0x85, 0x14, 0x18, 0xa9, 0x24, 0x00, 0x38, 0xfd, 0x81,
+    0x0b, 0x76, 0x5c, 0x02, 0x2a, 0xef, 0x4b, 0xf6, 0x74, 0x39, 0x26, 0x3e, 0x5a, 0x7e, 0x83, 0xa2,
+    0x94, 0xf8, 0x6d, 0x39, 0xa8, 0x3d, 0x4d, 0x78, 0xb1, 0x04, 0x98, 0xee, 0xbd, 0x5a, 0xe6, 0x19,
+    0x5e, 0x0a, 0x4a, 0xa8, 0xa1, 0x67, 0xd8, 0x02, 0x90, 0x74, 0xf7, 0x68, 0x78, 0x24, 0x92, 0x5b,
+    0xda, 0x43, 0xd4, 0x86, 0x16, 0x78, 0x60, 0x61, 0x94, 0xa6, 0x5d, 0xf8, 0x25, 0x37, 0x68, 0xbe,
+    0xd2, 0x8b, 0xa1, 0x56, 0xa5, 0x79, 0x68, 0x98, 0x66, 0x92, 0x71, 0xca, 0x2b, 0x67, 0x5a, 0x75,
+    0x65, 0x98, 0x5f, 0xc9, 0x39, 0x8c, 0x49, 0x73, 0x26, 0x7a, 0xe6, 0xa1, 0xbb, 0x90, 0x33, 0xa5,
+    0x9b, 0x71, 0xf2, 0x62, 0x4d, 0x9d, 0xd9, 0x90, 0xc3, 0xa6, 0x9e, 0xc9, 0xda, 0x12, 0x66, 0x9a,
+    0xa6, 0x32, 0x20, 0x01, 0x08, 0x6d, 0x2e, 0x6a, 0x0b, 0x2f, 0x4f, 0x56, 0xa4, 0xa6, 0xa2, 0x67,
+    0xae, 0x69, 0x55, 0x9a, 0x55, 0x9e, 0x8b, 0x30, 0x06, 0xd6, 0xf4, 0xd8, 0xe6, 0x9b, 0xc3, 0x8d,
+    0x47, 0x25, 0x9e, 0x22, 0x90, 0x20, 0x84, 0x02, 0x80, 0x52, 0x69, 0x27, 0x9f, 0x81, 0x9e, 0xa0,
+    0x1a, 0x84, 0x2b, 0x93, 0x33, 0x25, 0x9b, 0x7f, 0x9e, 0xf8, 0x66, 0x9d, 0x14, 0x2b, 0x49, 0xa5,
+    0x9d, 0x3d, 0xb6, 0x59, 0xe7, 0x9f, 0xf0, 0xfa, 0xfc, 0xcd, 0x3a, 0x27, 0xee, 0x79, 0x47, 0x9f,
+    0x78, 0x1a, 0x49, 0xa5, 0x96, 0x79, 0x9e, 0xb0, 0x0d, 0x6b, 0xba, 0x81, 0xf9, 0x8b, 0x39, 0x1c,
+    0xb1, 0x57, 0x68, 0x97, 0x58, 0x18, 0x82, 0xc8, 0x94, 0x83, 0x72, 0xc4, 0x5e, 0x98, 0xbb, 0x0c,
+    0x33, 0x25, 0x98, 0x67, 0x5a, 0x95, 0x66, 0xa1, 0xee, 0xce, 0x65, 0x27, 0x9f, 0x67, 0xae, 0x69,
+    0x55, 0x9a, 0x72, 0x36, 0x4a, 0x4a, 0x2f, 0x71, 0xfa, 0xd2, 0xa6, 0x2d, 0x94, 0x5c, 0xf2, 0x4c,
+    0x83, 0x8a, 0x92, 0xd2, 0xcb, 0x32, 0x91, 0x52, 0x8a, 0xa9, 0xa6, 0xa2, 0x2a, 0x6b, 0x44, 0x14,
+    0x93, 0x32, 0x01, 0xc5, 0x31, 0x05, 0x38, 0x6a, 0x29, 0xa7, 0x78, 0xb9, 0xd5, 0xe9, 0x2a, 0x90,
+    0x0a, 0x50, 0xc0, 0x02, 0x8e, 0x5a, 0x5a, 0xc0, 0x27, 0xb8, 0xe9, 0x76, 0xa9, 0x18, 0x05, 0x44,
+    0x4a, 0x29, 0x27, 0xa4, 0xec, 0x32, 0xcc, 0x32, 0x2b, 0x39, 0xaa, 0x29, 0xa7, 0xbc, 0x76, 0x05,
+    0x2b, 0xad, 0x29, 0x39, 0x8a, 0x29, 0x13, 0x4d, 0x78, 0xb1, 0x84, 0x19, 0x91, 0x62, 0x0a, 0x40,
+    0x01, 0x9f, 0x49, 0x6a, 0x2b, 0xb1, 0x2a, 0xb1, 0x84, 0x69, 0x01, 0x6c, 0xb8, 0x40, 0x84, 0x1a,
+    0xed, 0x80, 0x32, 0x49, 0x35, 0xee, 0x1c, 0x3a, 0x6b, 0x97, 0x5c, 0x3c, 0x0a, 0x2c, 0x07, 0x80,
+    0x29, 0x03, 0x50, 0x88, 0xa6, 0x2a, 0xab, 0x73, 0x49, 0x3e, 0x9d, 0xda, 0x2a, 0x50, 0xa4, 0xa2,
+    0x04, 0xa7, 0xce, 0x41, 0x96, 0xda, 0xac, 0x4f, 0x96, 0xa4, 0x32, 0x89, 0xaa, 0x37, 0xde, 0xfb,
+    0xaa, 0x2c, 0xa8, 0x32, 0xeb, 0x2c, 0xb4, 0xb2, 0xf8, 0x83, 0xd4, 0x86, 0x3f, 0x89, 0x29, 0x69,
+    0xbd, 0xa5, 0xfa, 0xc4, 0xd8, 0x98, 0x5e, 0x98, 0xe1, 0xe5, 0xa6, 0xee, 0x7d, 0x99, 0x2a, 0x49,
+    0xb2, 0xde, 0x53, 0x10, 0xb4, 0x9e, 0xcd, 0x1a, 0xed, 0xaa, 0xb0, 0xbe, 0xf2, 0xce, 0x3d, 0xb1,
+    0x7a, 0x16, 0xea, 0xaa, 0xa7, 0xf1, 0xba, 0x90, 0x5b, 0xbd, 0x4e, 0x1b, 0x6b, 0xb4, 0x03, 0x75,
+    0x8a, 0x2b, 0xb1, 0xbb, 0x12, 0xe4, 0xd1, 0xaf, 0x21, 0xd9, 0x4a, 0xec, 0x41, 0x11, 0xfb, 0xb3,
+    0xea, 0xac, 0xef, 0x6a, 0xc0, 0x01, 0x10, 0xb7, 0x56, 0xeb, 0x0f, 0x41, 0x99, 0x76, 0x45, 0x2b,
+    0xb5, 0xb1, 0xd6, 0xea, 0xd9, 0xac, 0x9f, 0xbe, 0x0c, 0x35, 0x02, 0x1e, 0x15, 0x7a, 0x6b, 0xae,
+    0x0d, 0xb2, 0x28, 0xac, 0xb1, 0x6a, 0xb0, 0xa1, 0xc8, 0x14, 0xca, 0x02, 0x6b, 0x2c, 0x0b, 0xcb,
+    0xbe, 0x21, 0x5f, 0x96, 0x9d, 0xda, 0x8a, 0xeb, 0x41, 0xc9, 0xbe, 0x99, 0xeb, 0xaf, 0x5c, 0x53,
+    0x0a, 0xac, 0xb0, 0x85, 0xde, 0xfa, 0x6b, 0xb2, 0x20, 0xe0, 0x8c, 0x12, 0x4d, 0x6f, 0x16, 0x2b,
+    0xcc, 0xb1, 0xc2, 0x3e, 0x6a, 0x44, 0x4a, 0xc3, 0xbe, 0x71, 0xc4, 0x48, 0xaa, 0x1e, 0xb4, 0x60,
+    0xb7, 0x64, 0xd5, 0xf8, 0xec, 0xa9, 0xa4, 0x44, 0x13, 0xc1, 0x34, 0xcd, 0x92, 0x55, 0xe3, 0xaa,
+    0x03, 0x2d, 0xd4, 0xa9, 0xaa, 0xb1, 0x7a, 0x36, 0xeb, 0xb3, 0x36, 0x03, 0x6b, 0x2c, 0x25, 0xb1,
+    0xd6, 0xea, 0xd9, 0xac, 0xbc, 0x5e, 0xfb, 0x6d, 0x41, 0xbb, 0x1a, 0x74, 0xab, 0x3f, 0xe0, 0x90,
+    0x00, 0x84, 0x10, 0xd4, 0x16, 0x34, 0xd1, 0x46, 0xda, 0x8a, 0x5b, 0x18, 0xb8, 0xe3, 0xaa, 0x2b,
+    0xb1, 0x23, 0x85, 0x61, 0xfb, 0x9b, 0xb8, 0xb6, 0x95, 0x3b, 0xcf, 0x5f, 0x0f, 0xa9, 0xeb, 0xb0,
+    0x0f, 0x01, 0x7e, 0x1b, 0x41, 0x2b, 0x28, 0xf8, 0x20, 0xc5, 0x43, 0xe6, 0x0c, 0xb4, 0xd0, 0x44,
+    0x7d, 0x89, 0x4b, 0x2e, 0x5d, 0xe7, 0xfa, 0x20, 0x05, 0x1c, 0xd8, 0x82, 0x5b, 0x49, 0x5f, 0x9b,
+    0xc8, 0x48, 0x87, 0x28, 0xe0, 0xf6, 0xa5, 0xad, 0xb8, 0xe7, 0x6d, 0xeb, 0x2f, 0xc3, 0xab, 0xc5,
+    0x35, 0x17, 0xb9, 0x3e, 0x84, 0xcb, 0x01, 0x0b, 0x35, 0xa1, 0xe3, 0x4d, 0x47, 0x36, 0x45, 0x7b,
+    0x6a, 0xac, 0xa7, 0x64, 0xcb, 0xed, 0xb8, 0xc8, 0x49, 0x84, 0x54, 0x9a, 0x85, 0xfd, 0xa6, 0xad,
+    0xbb, 0xef, 0x72, 0x20, 0xb1, 0x08, 0x73, 0x21, 0x4a, 0xae, 0xb9, 0xed, 0x72, 0x00, 0x97, 0xae,
+    0xdf, 0xf8, 0xe9, 0x73, 0x3a, 0xf1, 0x78, 0x33, 0x2f, 0x3a, 0x8f, 0x51, 0x89, 0xaf, 0xbe, 0xf1,
+    0x56, 0x7c, 0x71, 0xc6, 0x1c, 0xb0, 0x5b, 0xd8, 0x6f, 0x88, 0xb1, 0xba, 0x6d, 0xcf, 0xa9, 0xc4,
+    0x82, 0xaa, 0x25, 0x37, 0xa6, 0xca, 0x16, 0x78, 0xe5, 0xe9, 0x8b, 0x31, 0x14, 0xfb, 0xfe, 0xd4,
+    0x54, 0xc6, 0x50, 0x0c, 0x87, 0x2f, 0x13, 0xf9, 0xde, 0x73, 0xd3, 0x4f, 0x04, 0x6b, 0x4c, 0xc9,
+    0x70, 0xef, 0x15, 0x3c, 0x95, 0x6d, 0x4b, 0x95, 0x0b, 0x30, 0xc3, 0x03, 0x33, 0x65, 0xd6, 0xc1,
+    0x69, 0xf9, 0xcb, 0xf0, 0x53, 0x59, 0x1b, 0x75, 0x70, 0xc3, 0x37, 0x8b, 0x41, 0x06, 0x22, 0xff,
+    0x76, 0x6c, 0x14, 0x53, 0x0d, 0xe2, 0xcb, 0xaf, 0x13, 0xa5, 0xf5, 0xcb, 0x71, 0x53, 0x11, 0xc8,
+    0xb0, 0xca, 0x2d, 0x66, 0x3d, 0xfb, 0x6f, 0xc0, 0x55, 0xd2, 0x79, 0xae, 0xc2, 0xb5, 0xdc, 0x52,
+    0xcd, 0x2b, 0x12, 0x9f, 0x8b, 0xb0, 0xc3, 0x13, 0xeb, 0xb2, 0xe3, 0xa8, 0xe5, 0xfa, 0x0b, 0xf0,
+    0x53, 0x11, 0xe7, 0x1a, 0xf0, 0xc1, 0x3e, 0x00, 0xc1, 0xed, 0xb9, 0xcf, 0xfe, 0x7b, 0x70, 0xc4,
+    0x1a, 0xa0, 0x01, 0xd7, 0xbb, 0xb9, 0x36, 0xac, 0xd0, 0xc3, 0x0a, 0x67, 0xcb, 0x81, 0x23, 0x0b,
+    0xeb, 0xf2, 0xc8, 0x5a, 0xab, 0x51, 0xc9, 0xa7, 0xc5, 0xf3, 0x3e, 0x95, 0xc5, 0x52, 0xeb, 0x50,
+    0x0c, 0xc5, 0x6a, 0x19, 0x65, 0xb1, 0x51, 0xb9, 0xf8, 0x42, 0x31, 0x5c, 0x79, 0x4b, 0x4d, 0x55,
+    0xee, 0xbc, 0x0d, 0xe2, 0xcb, 0xaf, 0x13, 0x18, 0x20, 0xec, 0xb0, 0x05, 0x05, 0x7f, 0xdc, 0xd4,
+    0x58, 0x03, 0x3b, 0xf5, 0xaf, 0x51, 0x6c, 0x20, 0xa2, 0xc8, 0x57, 0x1c, 0x37, 0xb5, 0xd5, 0x58,
+    0x22, 0xab, 0xdc, 0x5c, 0xca, 0x2b, 0xcb, 0xac, 0x75, 0x36, 0xcd, 0x81, 0x9c, 0xa0, 0xca, 0x3b,
+    0x1d, 0x17, 0x73, 0xcf, 0x4e, 0x52, 0x69, 0xf5, 0x00, 0x57, 0xc9, 0x7c, 0xb5, 0x21, 0x33, 0xb1,
+    0x8c, 0x09, 0x82, 0x52, 0xc0, 0x61, 0x48, 0x27, 0x2c, 0xbb, 0x8c, 0xc9, 0x6e, 0xc5, 0xa9, 0xdc,
+    0xb2, 0x04, 0x20, 0xa7, 0x0c, 0x4e, 0x71, 0xe4, 0xe8, 0xf9, 0x8b, 0x3a, 0x98, 0x98, 0x8c, 0xb2,
+    0x24, 0x29, 0x4b, 0x52, 0x9c, 0xc8, 0xbb, 0xcd, 0x87, 0xf2, 0x27, 0x86, 0x90, 0x41, 0x07, 0x22,
+    0x7d, 0xd1, 0x05, 0x2e, 0xc6, 0x7e, 0x95, 0x05, 0xd9, 0xc8, 0xef, 0x84, 0x5c, 0xf2, 0xca, 0x11,
+    0xd6, 0xa0, 0xd5, 0xac, 0xcd, 0x25, 0x28, 0xb2, 0xcd, 0x37, 0x93, 0xa1, 0xb5, 0x1a, 0xd2, 0xb6,
+    0x4c, 0x33, 0xd7, 0x35, 0x93, 0x81, 0x9b, 0xc0, 0x28, 0x81, 0x80, 0xac, 0x4c, 0x39, 0xed, 0x1c,
+    0xc2, 0x4e, 0x8d, 0x5d, 0x07, 0xb4, 0xd0, 0x39, 0x77, 0xfd, 0x75, 0xd8, 0x64, 0xd0, 0xcc, 0x81,
+    0x07, 0xd0, 0x7d, 0x30, 0x42, 0x09, 0x7e, 0xc2, 0xfb, 0x0d, 0xce, 0xf1, 0xe4, 0x13, 0x6f, 0x50,
+    0x2e, 0x0a, 0x0d, 0x76, 0x83, 0x43, 0x23, 0x66, 0x59, 0xd8, 0x0d, 0x02, 0xed, 0x22, 0xcc, 0x41,
+    0xff, 0xf4, 0x17, 0x62, 0x4c, 0x8b, 0xfd, 0x80, 0x04, 0x38, 0x36, 0xbd, 0x19, 0x8c, 0x4a, 0x7b,
+    0x32, 0xce, 0x64, 0x94, 0x25, 0x4d, 0x75, 0xd8, 0x3a, 0xd8, 0xd0, 0x98, 0xce, 0xb2, 0x1d, 0x4d,
+    0xf5, 0x65, 0x46, 0x93, 0x3d, 0xc0, 0x01, 0x19, 0xb4, 0xf2, 0xca, 0x34, 0x55, 0x02, 0x4d, 0xb4,
+    0x04, 0xed, 0x15, 0x5d, 0xb6, 0x65, 0xeb, 0xb4, 0x66, 0xb1, 0xcb, 0x59, 0xe8, 0x31, 0xcf, 0x3f,
+    0x9f, 0xfa, 0xfa, 0xb2, 0xd4, 0xfd, 0xfc, 0xd3, 0xd1, 0x3d, 0x5a, 0xbf, 0x0c, 0xf5, 0xd5, 0x5b,
+    0x0b, 0x34, 0xe8, 0xba, 0x47, 0x27, 0x7d, 0xd9, 0x71, 0x59, 0x07, 0x2c, 0x95, 0x51, 0xc3, 0x39,
+    0x29, 0x25, 0x95, 0x86, 0x20, 0x52, 0xf2, 0xcb, 0x62, 0xcc, 0x82, 0xdb, 0xcd, 0x01, 0x57, 0x2d,
+    0x95, 0x51, 0x52, 0x87, 0x4c, 0x46, 0x36, 0x53, 0x0b, 0xa4, 0x0d, 0x6d, 0xf3, 0x19, 0xeb, 0xf5,
+    0x70, 0x3b, 0x5f, 0x46, 0x99, 0x6c, 0x5c, 0xc3, 0x80, 0x03, 0x25, 0x61, 0x8d, 0xb5, 0x73, 0xd8,
+    0x40, 0x4b, 0xd0, 0xa0, 0x8b, 0x94, 0x6d, 0xb6, 0x73, 0xd0, 0x55, 0x02, 0x4d, 0xb4, 0x04, 0x60,
+    0x40, 0x7d, 0xb5, 0x17, 0x4a, 0x57, 0x66, 0xf4, 0x00, 0x4d, 0x9f, 0x6d, 0x19, 0x6b, 0xb7, 0x4c,
+    0x53, 0xcd, 0x69, 0x65, 0x5b, 0x36, 0x1a, 0x6b
+};
+
+#if CHORD_REVERSE_INDEX
+// The index in ChordReverseVoicings[] of the first voicing of each slot.
+const uint16_t ChordReverseStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM =
+{
+      0,   1,   2,   3,   6,   9,  10,  10,  11,  13,  18,  19,
+     19,  21,  22,  23,  24,  30,  33,  34,  37,  38,  38,  39,
+     41,  44,  45,  45,  46,  52,  53,  54,  55,  56,  58,  60,
+     61,  61,  64,  64,  64,  66,  67,  67,  69,  71,  78,  78,
+     81,  83,  84,  85,  85,  88,  88,  88,  93,  95,  96,  99,
+    100, 101, 102, 103, 106, 107, 107, 109, 109, 112, 114, 117,
+    118, 120, 121, 124, 124, 127, 128, 130, 132, 132, 133, 134,
+    135, 138, 139, 139, 141, 141, 144, 145, 150, 150, 152, 155,
+    156, 157, 158, 159, 159, 159, 162, 165, 166, 169, 170, 171,
+    171, 172, 176, 176, 178, 181, 181, 182, 183, 183, 184, 185,
+    187, 192, 193, 194, 195, 197, 200, 201, 201, 202, 204, 207,
+    208, 214, 216, 217, 219, 221, 223, 223, 224, 228, 230, 231,
+    234, 235, 238, 239, 240, 243, 243, 244, 245, 248, 249, 251,
+    254, 256, 256, 258, 259, 261, 263, 264, 265, 267, 269, 275,
+    276, 281, 284, 284, 284, 294, 295, 295, 297, 304, 305, 306,
+    309, 310, 310, 310, 311, 314, 315, 315, 317, 317, 321, 321,
+    325, 328, 330, 330, 330, 331, 333, 334, 337, 339, 340, 340,
+    341, 346, 350, 350, 351, 353, 353, 355, 355, 363, 363, 364,
+    367, 368, 369, 370, 374, 375, 375, 376, 376, 377, 380, 381,
+    382, 383, 384, 387, 387, 388, 391, 391, 391, 393, 394, 395,
+    398, 401, 405, 406, 408, 410, 412, 413, 414, 415, 416, 418,
+    421, 425, 431, 431, 432, 434, 435, 437, 437, 438, 441, 442,
+    443, 445, 448, 448, 449, 452, 455, 455, 456, 459, 462, 463,
+    464, 465, 467, 467, 469, 470, 471, 472, 473, 475, 477, 477,
+    482, 483, 486, 488, 488, 490, 492, 495, 495, 499, 505, 505,
+    509, 510, 511, 511, 512, 513, 516, 519, 519, 521, 521, 524,
+    524, 528, 531, 533, 533, 533, 534, 536, 538, 541, 542, 543,
+    544, 544, 548, 550, 550, 556, 558, 558, 560, 561, 565, 565,
+    568, 571, 572, 573, 575, 579, 580, 580, 581, 585, 585, 585,
+    586, 589, 592, 592, 595, 596, 596, 598, 599, 602, 604, 605,
+    607, 609, 612, 615, 617, 623, 624, 624, 624, 627, 627, 627,
+    631, 635, 636, 640, 641, 641, 642, 643, 646, 646, 647, 648,
+    649, 652, 653, 657, 658, 659, 661, 662, 662, 666, 668, 671,
+    672, 673, 675, 676, 676, 683, 684, 684, 685, 687, 688, 689,
+    691, 695, 696, 698, 700, 700, 701, 702, 706, 707, 707, 710,
+    710, 714, 715, 716, 716, 720, 722, 723, 725, 727, 729, 729,
+    731, 732, 732, 734, 736, 743, 743, 745, 747, 751, 752, 752,
+    753, 754, 754, 759, 760, 761, 766, 767, 768, 770, 771, 773,
+    773, 776, 780, 780, 781, 783, 787, 788, 788, 789, 793, 793,
+    794, 794, 797, 800, 800, 804, 805, 805, 807, 809, 811, 813,
+    813, 817, 817, 819, 822, 824, 828, 829, 829, 830, 832, 832,
+    832, 837, 840, 840, 844, 846, 846, 846, 847, 853, 853, 855,
+    856, 861, 863, 864, 867, 869, 870, 872, 872
+};
+
+// The voicings sorted by the slot of their key.
+const uint16_t ChordReverseVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+    722, 634, 173, 242, 244, 362, 174, 300, 377,  28, 426, 706,
+    714,  61,  83, 104, 120, 727, 123, 210, 539, 698, 487, 827,
+    146, 152, 258, 266, 444, 453, 693, 701, 723, 601,  41,  43,
+    502, 109, 720, 350, 829, 114, 201, 205,  24, 382, 293, 297,
+    301, 307, 666, 806, 565, 283, 650, 461, 743, 831, 470, 472,
+    419, 291, 351, 515, 497, 592, 828,  65, 313, 268, 413, 110,
+    118, 140, 519, 546, 554, 671,  20, 127, 216, 535, 792, 399,
+    741, 236, 392, 638, 200, 208, 220, 468, 484,  12,  16, 855,
+    259, 263, 289, 192, 851, 320, 151, 760, 762, 817, 660, 580,
+    688,  84, 214, 367,  21, 322, 478, 563, 566, 387, 556, 704,
+    745, 513, 523, 733, 417, 645, 824, 143,  23,  25, 324, 825,
+    783, 209, 715, 507, 736, 740, 777, 321, 861, 271, 608, 677,
+    148,  39,  47, 474, 482, 503, 383, 577, 285, 694, 696, 763,
+    501, 610, 131, 165, 561, 569, 147, 150, 160, 348, 621, 625,
+    651,  64, 433, 612, 203, 253, 255, 310, 157, 807,  72, 132,
+    182, 731, 384,  94, 718,  49, 197,  80, 451, 764, 772, 794,
+    867, 780, 317, 386, 388, 318, 442, 522, 175, 571, 850, 858,
+    251, 267, 871, 270,  40,  44,  70,  81,  87, 636, 354, 685,
+    843, 101, 633, 654, 655, 294, 598, 747, 188, 190, 521, 647,
+    256, 469, 371, 103, 674, 865, 494, 261, 345, 349, 171, 527,
+    296, 306, 588, 590, 428, 676, 678, 796, 606,  17, 105, 564,
+    615, 617,  78, 860, 436, 495, 558, 437, 448, 642, 739, 102,
+    457, 212, 391, 412, 559, 257, 265, 287, 665, 692, 700, 360,
+    167, 274, 452, 475, 477,  66, 544, 681,   0,   5,   9, 156,
+    163, 393, 537, 657, 662, 668, 784, 344, 352, 364, 613, 629,
+    800, 802, 810, 816, 164, 129, 404, 407, 434, 336,  91,  34,
+     36, 854, 805, 726, 833, 168, 231, 358, 512, 589, 623, 709,
+    713, 499, 532, 748, 702, 848, 648,  98, 562, 290,  99, 170,
+    172, 225, 227, 826, 353,  32,  48, 632, 640, 859,  10,  15,
+     51, 653, 135, 466, 624, 415, 755,  74, 186, 194, 372, 381,
+    619, 627, 649, 528, 430, 839, 841,  37, 646, 757,  42, 126,
+    130, 278, 822, 309, 492, 767, 771, 797, 211, 578, 389, 758,
+    347, 398, 400, 445, 219, 279, 326, 425, 529, 756, 241, 196,
+    341, 863, 446, 473, 481,  38,  46,  68, 597, 141,  55, 462,
+    518, 524, 531, 533, 669, 319,  86, 717, 125, 133, 145, 395,
+    411, 414, 443, 808, 814, 187, 191, 217, 228, 234, 782, 117,
+    248, 779, 801, 438, 744, 586, 332, 334, 667, 614, 139, 250,
+    818, 406, 490, 493, 315, 483, 630, 673, 440, 450, 661, 737,
+    235, 573, 752,  71, 821, 823, 753, 252, 711, 134, 226, 435,
+    641, 705, 583, 789, 249, 199, 603, 356, 536, 402, 410, 431,
+    837, 845, 504, 311, 620, 622, 213, 690, 379, 429, 538, 683,
+     59, 594, 804, 298, 299, 488, 496,  75,  77,  85,  90, 759,
+    775, 276, 549, 553, 579, 862, 480, 540, 238, 128, 181, 183,
+     79,  82, 734, 107, 870, 312, 376, 658, 735, 769, 853, 857,
+     22, 644, 679, 122, 847, 795, 245, 708, 314, 316, 161, 246,
+    449, 370, 100, 498, 179, 195, 778, 786, 198, 799,   7,  14,
+    282, 838, 842, 868, 611, 770,  29, 560, 582, 221, 330, 338,
+    526, 113, 115, 675, 184, 447, 575, 397, 793,  31, 600, 189,
+    273, 277, 422,  96, 454, 223, 229, 233, 441, 355, 602, 604,
+    724,  33, 534, 815, 491, 543, 545, 788, 363, 423, 485, 365,
+    369, 656,  30, 570,  76, 137, 385, 340, 486, 591, 618, 626,
+    185, 193, 215,  92, 288, 202, 380, 403, 405, 607, 864, 471,
+    308, 464, 712, 272, 280, 541, 557, 292, 728, 730, 738,  88,
+     57, 331, 335, 361, 264,  53, 224,  19, 832, 834, 732, 652,
+    761, 159, 286, 439,  93, 517, 551, 635, 639, 459, 427, 628,
+    776, 585,   2,  11, 489, 659,  26, 719,  95,  97, 218,  27,
+    396, 663, 754, 281, 581, 787, 809, 812, 813, 830, 846, 849,
+     63, 394, 552, 343, 682, 111, 119, 516, 547, 555, 576, 455,
+    766, 768, 357, 835, 574, 684,  54,  58, 206, 840, 750, 222,
+    232, 237, 420, 695, 699, 725, 136, 505, 596, 664, 670, 686,
+    325, 327, 275,   8, 230, 207, 375, 144, 254, 456, 803, 520,
+    169, 791, 121, 269, 373, 401, 409, 525, 836, 844, 866,   3,
+     69, 390, 852, 295, 302, 458, 460, 595, 247, 643,  52,  60,
+     73, 323, 339, 342, 710, 112, 116, 142, 155, 162,  45, 707,
+    176, 742, 729, 366, 672, 260, 262, 819, 328, 542, 593, 721,
+     67, 178, 746, 333, 418, 421, 567, 243, 599, 368, 374, 378,
+    587, 500, 749, 751, 869,  89, 180, 680, 153, 637, 689, 691,
+     62, 508, 568, 303, 631, 510, 811, 177, 716, 124, 284, 463,
+    530, 765, 773, 329, 337, 359, 239, 432, 138, 346, 548, 550,
+    616, 465, 609, 856,  18, 416, 424, 687, 703,   1,   4,  13,
+    204, 476, 479, 506, 408, 790, 467,  56, 106, 108, 149, 154,
+    166,   6, 158, 798,  35, 305, 509, 511, 514, 304, 584, 240,
+    697, 781, 785, 605, 820, 572,  50, 774
+};
+#endif
+
+#if CHORD_TRANSPOSE_INDEX
+// The index in ChordTransposeVoicings[] of the first voicing of each slot.
+const uint16_t ChordTransposeStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM =
+{
+      0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,
+      1,  45,  45,  45,  45,  50,  50,  50,  50,  66,  66,  78,
+     78,  78,  78,  78,  78,  95,  95,  95,  95, 119, 119, 119,
+    119, 131, 131, 143, 143, 149, 149, 150, 150, 150, 150, 150,
+    150, 176, 176, 176, 176, 176, 176, 176, 176, 193, 193, 193,
+    193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+    193, 205, 205, 205, 205, 208, 208, 208, 208, 220, 220, 220,
+    220, 244, 244, 244, 244, 256, 256, 256, 256, 257, 257, 257,
+    257, 257, 257, 293, 293, 305, 305, 305, 305, 305, 305, 305,
+    305, 310, 310, 310, 310, 313, 313, 313, 313, 313, 313, 313,
+    313, 342, 342, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+    343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344,
+    344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344, 344,
+    344, 345, 345, 345, 345, 346, 346, 346, 346, 358, 358, 358,
+    358, 358, 358, 358, 358, 358, 358, 358, 358, 360, 360, 360,
+    360, 372, 372, 384, 384, 386, 386, 393, 393, 393, 393, 393,
+    393, 393, 393, 393, 393, 393, 393, 393, 393, 399, 399, 399,
+    399, 399, 399, 399, 399, 399, 399, 399, 399, 399, 399, 399,
+    399, 399, 399, 399, 399, 399, 399, 399, 399, 405, 405, 405,
+    405, 405, 405, 405, 405, 405, 405, 405, 405, 409, 409, 409,
+    409, 409, 409, 421, 421, 445, 445, 445, 445, 459, 459, 459,
+    459, 459, 459, 459, 459, 459, 459, 485, 485, 485, 485, 497,
+    497, 509, 509, 512, 512, 512, 512, 512, 512, 524, 524, 524,
+    524, 524, 524, 524, 524, 532, 532, 532, 532, 532, 532, 532,
+    532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532,
+    532, 532, 532, 544, 544, 546, 546, 546, 546, 558, 558, 558,
+    558, 559, 559, 559, 559, 600, 600, 600, 600, 602, 602, 602,
+    602, 602, 602, 602, 602, 614, 614, 614, 614, 614, 614, 614,
+    614, 614, 614, 615, 615, 615, 615, 615, 615, 616, 616, 618,
+    618, 618, 618, 618, 618, 621, 621, 621, 621, 621, 621, 621,
+    621, 633, 633, 633, 633, 633, 633, 633, 633, 653, 653, 653,
+    653, 665, 665, 665, 665, 665, 665, 665, 665, 677, 677, 677,
+    677, 681, 681, 681, 681, 693, 693, 693, 693, 705, 705, 705,
+    705, 710, 710, 710, 710, 734, 734, 734, 734, 734, 734, 734,
+    734, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755,
+    755, 755, 755, 755, 755, 767, 767, 767, 767, 767, 767, 767,
+    767, 791, 791, 791, 791, 791, 791, 791, 791, 793, 793, 793,
+    793, 794, 794, 794, 794, 801, 801, 801, 801, 801, 801, 801,
+    801, 807, 807, 807, 807, 807, 807, 807, 807, 831, 831, 831,
+    831, 844, 844, 844, 844, 844, 844, 844, 856, 856, 856, 856,
+    856, 856, 856, 857, 857, 857, 857, 857, 857, 870, 870, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872
+};
+
+// The voicings sorted by the slot of their key without the starting fret.
+const uint16_t ChordTransposeVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+    161,   7,  14,  40,  44,  70,  81,  87, 112, 116, 142, 155,
+    162, 187, 191, 217, 228, 234, 259, 263, 289, 331, 335, 361,
+    404, 407, 434, 476, 479, 506, 549, 553, 579, 621, 625, 651,
+    695, 699, 725, 767, 771, 797, 838, 842, 868, 582, 654, 655,
+    729, 801,  35, 107, 182, 254, 326, 397, 447, 469, 521, 542,
+    593, 614, 667, 688, 761, 833,  21,  93, 168, 240, 312, 384,
+    456, 529, 600, 674, 746, 818, 223, 229, 233, 296, 306, 368,
+    374, 378, 440, 441, 450, 513, 523, 585, 587, 661, 733,  23,
+     25,  95,  97, 170, 172, 242, 244, 314, 316, 386, 388, 458,
+    460, 531, 533, 602, 604, 676, 678, 749, 751, 821, 823,  62,
+    134, 209, 281, 353, 426, 498, 571, 643, 717, 788, 860,  51,
+    123, 198, 270, 342, 414, 485, 558, 631, 705, 777, 849, 365,
+    369, 437, 448, 510, 583,  76,  41,  43, 113, 115, 188, 190,
+    260, 262, 332, 334, 380, 403, 405, 452, 475, 477, 548, 550,
+    620, 622, 694, 696, 766, 768, 839, 841,   1,   4,  13,  75,
+     77,  85, 147, 150, 160, 222, 232, 728, 730, 738, 800, 802,
+    810,  65, 137, 212, 284, 356, 427, 499, 572, 644, 718, 791,
+    863,   2,  11, 659,  28, 100, 175, 247, 319, 392, 464, 537,
+    609, 683, 754, 826,  32,  48, 104, 120, 179, 195, 251, 267,
+    323, 339, 395, 411, 468, 484, 541, 557, 613, 629, 687, 703,
+    759, 775, 830, 846,  45, 117, 192, 264, 336, 408, 480, 552,
+    624, 698, 770, 843, 516,  42,  54,  58, 114, 126, 130, 189,
+    201, 205, 261, 273, 277, 333, 345, 349, 406, 418, 421, 478,
+    490, 493, 551, 563, 566, 623, 635, 639, 697, 709, 713, 769,
+    781, 785, 840, 853, 857,  24,  96, 171, 243, 315, 387, 459,
+    532, 605, 679, 750, 822,  17,  89, 596, 743, 815, 375, 445,
+    515,  39,  47, 111, 119, 186, 194, 258, 266, 330, 338, 373,
+    401, 409, 446, 473, 481, 519, 546, 554, 591, 618, 626, 665,
+    692, 700, 765, 773, 837, 845,   3, 742, 663, 303,  53, 124,
+    199, 271, 343, 415, 487, 560, 633, 707, 779, 851, 298, 299,
+     64, 136, 211, 283, 355, 428, 500, 573, 645, 719, 790, 862,
+     33, 105, 180, 252, 324, 396, 467, 540, 612, 686, 758, 831,
+    149, 154,   8,  82, 157, 158, 230, 734, 807, 377, 449, 522,
+    595, 669, 741, 293, 297, 301, 307, 666, 806, 592, 656, 739,
+    811,  20,  92, 167, 239, 311, 383, 455, 528, 601, 675, 747,
+    819,  37,  66, 109, 138, 184, 213, 256, 285, 328, 357, 399,
+    430, 471, 502, 544, 575, 616, 647, 690, 721, 763, 792, 835,
+    864,  59, 131, 206, 236, 278, 308, 350, 422, 494, 567, 638,
+    712, 784, 856,  34,  36, 106, 108, 151, 181, 183, 224, 253,
+    255, 325, 327, 398, 400, 470, 472, 543, 545, 615, 617, 689,
+    691, 760, 762, 832, 834,  72, 144, 219, 291, 363, 436, 508,
+    580, 652, 726, 798, 870,  84, 159, 231, 304, 367, 376, 439,
+    512, 584, 658, 731, 803, 517, 589, 735,  55, 127, 202, 274,
+    346, 417, 489, 562, 634, 708, 780, 852,  10,  15,  83, 736,
+    740, 809, 812, 813,  71, 143, 218, 290, 362, 433, 505, 578,
+    650, 724, 796, 869, 664, 670,  61, 132, 207, 279, 351, 423,
+    495, 568, 641, 715, 787, 859, 520,  38,  46,  68,  80, 110,
+    118, 140, 185, 193, 215, 257, 265, 287, 329, 337, 359, 402,
+    410, 431, 451, 474, 482, 503, 525, 547, 555, 576, 597, 619,
+    627, 649, 671, 693, 701, 723, 764, 772, 794, 836, 844, 866,
+    295, 302,  57, 129, 204, 276, 348, 420, 492, 565, 636, 710,
+    782, 855, 371, 588, 590, 737,  78, 153, 226,  29, 101, 176,
+    248, 320, 391, 463, 536, 608, 682, 755, 827,   0,   5,   9,
+     31, 103, 156, 163, 178, 250, 322, 393, 465, 538, 610, 657,
+    662, 668, 684, 757, 829,  18,  90, 165, 237, 309, 382, 454,
+    527, 599, 673, 745, 816,  56, 128, 203, 275, 347, 419, 491,
+    564, 637, 711, 783, 854, 305, 509, 511, 514,  22,  94, 169,
+    241, 313, 385, 457, 530, 603, 677, 748, 820,  69, 141, 216,
+    288, 360, 432, 504, 577, 648, 722, 795, 867, 225, 227, 300,
+    370, 442,  52,  60, 125, 133, 200, 208, 272, 280, 344, 352,
+    416, 424, 488, 496, 561, 569, 632, 640, 706, 714, 778, 786,
+    850, 858,  19,  74,  91, 146, 152, 166, 221, 238, 294, 310,
+    366, 372, 381, 438, 444, 453, 526, 598, 672, 744, 817,  27,
+     99, 174, 246, 318, 389, 461, 534, 606, 680, 753, 825,  30,
+     63, 102, 135, 177, 210, 249, 282, 321, 354, 394, 425, 466,
+    497, 539, 570, 611, 642, 685, 716, 756, 789, 828, 861, 518,
+    524,  86,  12,  16,  88, 164, 443, 808, 814,   6,  79, 586,
+    660, 732, 805,  49,  50, 121, 122, 196, 197, 268, 269, 340,
+    341, 412, 413, 483, 486, 556, 559, 628, 630, 702, 704, 774,
+    776, 847, 848,  26,  98, 173, 235, 245, 317, 390, 462, 535,
+    607, 681, 752, 824,  73, 145, 220, 292, 364, 435, 507, 581,
+    653, 727, 799, 871, 148,  67, 139, 214, 286, 358, 379, 429,
+    501, 574, 646, 720, 793, 865, 594, 804
+};
+#endif
+
+// The posting lists.  Strings are numbered high E first.
+const uint8_t ChordPostings[CHORD_POSTING_LISTS * CHORD_POSTING_BYTES] CHORD_PROGMEM =
+{
+    // String 0 on fret 1
+    0x52, 0xa4, 0x4c, 0x2d, 0x81, 0xa0, 0x21, 0x6a, 0x2f, 0xad, 0x38, 0x4c, 0x2d, 0x81, 0xa0, 0x11,
+    0x5a, 0x2f, 0xfd, 0x85, 0x63, 0x6a, 0x09, 0x04, 0x8d, 0xd0, 0x7a, 0x69, 0x81, 0x79, 0x6a, 0x09,
+    0x04, 0x8d, 0xd0, 0x7a, 0x49, 0x00, 0x71, 0x6a, 0x09, 0x04, 0x8d, 0xd0, 0x7a, 0xe9, 0x3a, 0x6b,
+    0xea, 0x08, 0x02, 0x8b, 0xd0, 0x7c, 0xf1, 0xd0, 0x63, 0xea, 0x10, 0x02, 0x93, 0xd0, 0x7c, 0x51,
+    0xc1, 0xd7, 0xd4, 0x21, 0x04, 0x25, 0xa1, 0xf9, 0x92, 0x95, 0xca, 0xe8, 0x21, 0x04, 0x25, 0x52,
+    0xfa, 0x11, 0x14, 0x2a, 0xa3, 0x87, 0x10, 0x94, 0x48, 0xe9, 0x47, 0x1d, 0x75, 0x53, 0x8b, 0x20,
+    0xa4, 0x48, 0xd9, 0x4b, 0x2d, 0x36, 0x53, 0x4b, 0x20, 0x68, 0x88, 0xd9, 0x4b,
+    // String 1 on fret 1
+    0xed, 0x4b, 0x72, 0x29, 0x02, 0x1b, 0xb6, 0xd2, 0x6a, 0x80, 0x96, 0x72, 0x29, 0x02, 0x1b, 0xb6,
+    0xe2, 0x6a, 0x00, 0xf8, 0x8e, 0x4b, 0x11, 0xd8, 0xb0, 0x15, 0x57, 0x03, 0xda, 0x84, 0x4b, 0x11,
+    0xd8, 0xb0, 0x15, 0x57, 0x03, 0x1c, 0x81, 0x4b, 0x11, 0xd8, 0xb0, 0x15, 0x57, 0xa3, 0x8e, 0x9b,
+    0xab, 0x10, 0xb8, 0xb0, 0x13, 0x2f, 0xa5, 0x24, 0x93, 0xab, 0x08, 0xb8, 0xc8, 0x13, 0x2f, 0x45,
+    0x09, 0x04, 0x57, 0x11, 0x70, 0x92, 0x27, 0x5e, 0xca, 0x45, 0x19, 0x6b, 0x11, 0x70, 0x52, 0x17,
+    0x5d, 0xc9, 0x5f, 0x71, 0xac, 0x45, 0xc0, 0x49, 0x5d, 0x74, 0x25, 0x5a, 0xea, 0x5c, 0x4a, 0xc0,
+    0x49, 0x5d, 0xb4, 0x2a, 0xaa, 0x88, 0x5c, 0x8a, 0xc0, 0x86, 0x9d, 0xb4, 0x1a,
+    // String 2 on fret 1
+    0x40, 0x84, 0xbe, 0x13, 0x74, 0x60, 0xbe, 0x73, 0x37, 0xd5, 0x59, 0xbe, 0x13, 0x74, 0x60, 0xbe,
+    0x73, 0x37, 0x15, 0x83, 0xe0, 0x9d, 0xa0, 0x03, 0xf3, 0x9d, 0xbb, 0x29, 0x84, 0xe0, 0x9d, 0xa0,
+    0x03, 0xf3, 0x9d, 0xbb, 0x69, 0xa2, 0xe9, 0x9d, 0xa0, 0x03, 0xf3, 0x9d, 0xbb, 0xc9, 0x18, 0xe3,
+    0x1d, 0xc1, 0x05, 0xf5, 0x9b, 0xdd, 0xd1, 0x10, 0xea, 0x1d, 0xc1, 0x05, 0xed, 0x9b, 0xdd, 0x11,
+    0x01, 0xe4, 0x3b, 0x82, 0x0b, 0xd9, 0x37, 0xbb, 0x53, 0x55, 0xfd, 0x37, 0x82, 0x0b, 0xd9, 0x37,
+    0xbb, 0xd3, 0x15, 0xa4, 0xdf, 0x08, 0x2e, 0x64, 0xdf, 0xec, 0x4e, 0x1a, 0xfb, 0xef, 0x04, 0x1d,
+    0x54, 0xdf, 0xdc, 0x4d, 0x7a, 0xba, 0xef, 0x04, 0x1d, 0x98, 0xdf, 0xdc, 0x4d,
+    // String 3 on fret 1
+    0xc8, 0x50, 0x83, 0x36, 0xa9, 0xbf, 0xf1, 0xff, 0xcb, 0x82, 0x82, 0x83, 0x36, 0xa9, 0xbf, 0xf1,
+    0xff, 0xcb, 0x02, 0x08, 0x14, 0xb4, 0x49, 0xfd, 0x8d, 0xff, 0x5f, 0x96, 0x3a, 0x1e, 0xb4, 0x49,
+    0xfd, 0x8d, 0xff, 0x5f, 0x96, 0xdd, 0x14, 0xb4, 0x49, 0xfd, 0x8d, 0xff, 0x5f, 0x16, 0x65, 0x1e,
+    0xd4, 0xa9, 0xfa, 0x8b, 0xff, 0x3f, 0x0e, 0x4f, 0x16, 0xd4, 0xb1, 0xfa, 0x93, 0xff, 0x3f, 0x0e,
+    0xa2, 0x0c, 0xa8, 0x63, 0xf5, 0x27, 0xff, 0x7f, 0x6c, 0xfe, 0x1d, 0x94, 0x63, 0xf5, 0x27, 0xff,
+    0x7f, 0xec, 0xb1, 0x63, 0x50, 0x8e, 0xd5, 0x9f, 0xfc, 0xff, 0xb1, 0xb2, 0xaa, 0xa0, 0x8d, 0xea,
+    0xaf, 0xfc, 0xff, 0xb2, 0x32, 0xc9, 0xa0, 0x4d, 0xea, 0x6f, 0xfc, 0xff, 0xb2,
+    // String 4 on fret 1
+    0x12, 0xa4, 0xc2, 0x7f, 0x56, 0x40, 0x1e, 0xda, 0x37, 0x68, 0x29, 0xc2, 0x7f, 0x56, 0x40, 0x2e,
+    0xea, 0x37, 0x48, 0x02, 0x01, 0xfe, 0xb3, 0x02, 0x72, 0x51, 0xbf, 0xc1, 0x2e, 0x1b, 0xfe, 0xb3,
+    0x02, 0x72, 0x51, 0xbf, 0x81, 0x5d, 0x16, 0xfe, 0xb3, 0x02, 0x72, 0x51, 0xbf, 0x01, 0x45, 0x04,
+    0xfe, 0x55, 0x05, 0x74, 0x51, 0xdf, 0x01, 0x87, 0x0c, 0xfe, 0x4d, 0x05, 0x6c, 0x51, 0xdf, 0xa1,
+    0x16, 0x2b, 0xfc, 0x9b, 0x0a, 0xd8, 0xa2, 0xbe, 0x03, 0x0a, 0x32, 0xfc, 0x9b, 0x0a, 0xd8, 0x51,
+    0xbd, 0x03, 0x20, 0x88, 0xf0, 0x6f, 0x2a, 0x60, 0x47, 0xf5, 0x0e, 0x25, 0xd5, 0xf0, 0x5f, 0x15,
+    0x50, 0x47, 0xf5, 0x0d, 0x05, 0xb6, 0xf0, 0x9f, 0x15, 0x90, 0x87, 0xf5, 0x0d,
+    // String 5 on fret 1
+    0x12, 0xa4, 0x08, 0xa8, 0xa8, 0x8a, 0x80, 0x80, 0x8a, 0x6e, 0x38, 0x08, 0xa8, 0xa8, 0x8a, 0x80,
+    0x80, 0x8a, 0x6e, 0x87, 0x41, 0x40, 0x45, 0x55, 0x04, 0x04, 0x54, 0x74, 0x84, 0x41, 0x40, 0x45,
+    0x55, 0x04, 0x04, 0x54, 0x54, 0x00, 0x41, 0x40, 0x45, 0x55, 0x04, 0x04, 0x54, 0xf4, 0xb2, 0x3b,
+    0xa0, 0xa2, 0x2a, 0x02, 0x02, 0x2a, 0xea, 0x70, 0x33, 0xa0, 0xa2, 0x2a, 0x02, 0x02, 0x2a, 0x4a,
+    0x89, 0x44, 0x40, 0x45, 0x55, 0x04, 0x04, 0x54, 0xa4, 0x91, 0x48, 0x40, 0x45, 0x55, 0x04, 0x04,
+    0x54, 0x24, 0x04, 0x22, 0x01, 0x15, 0x55, 0x11, 0x10, 0x50, 0x91, 0x0d, 0x75, 0x01, 0x2a, 0x6a,
+    0x21, 0x10, 0xa0, 0x92, 0x0d, 0x36, 0x02, 0x2a, 0xaa, 0x22, 0x10, 0xa0, 0xa2,
+    // String 0 on fret 2
+    0x00, 0x01, 0x03, 0x02, 0x40, 0x03, 0x06, 0x01, 0x80, 0x02, 0x00, 0x03, 0x02, 0x40, 0x03, 0x06,
+    0x01, 0x80, 0x02, 0x50, 0x10, 0x10, 0x00, 0x1a, 0x30, 0x08, 0x00, 0x94, 0x08, 0x02, 0x10, 0x00,
+    0x1a, 0x30, 0x08, 0x00, 0x14, 0x11, 0x0c, 0x10, 0x00, 0x1a, 0x30, 0x08, 0x00, 0x14, 0x01, 0x04,
+    0x10, 0x00, 0x1c, 0x30, 0x08, 0x00, 0x0a, 0x0b, 0x0c, 0x10, 0x00, 0x1c, 0x48, 0x08, 0x00, 0xaa,
+    0x22, 0x28, 0x20, 0x00, 0x38, 0x90, 0x10, 0x00, 0x24, 0x6a, 0x34, 0x10, 0x00, 0x38, 0x50, 0x20,
+    0x00, 0x24, 0xe0, 0xc0, 0x40, 0x00, 0xe0, 0x40, 0x81, 0x00, 0x90, 0xe0, 0x82, 0x80, 0x00, 0xd0,
+    0x40, 0x81, 0x00, 0x90, 0xd0, 0xc1, 0x80, 0x00, 0xd0, 0x80, 0x41, 0x00, 0xa0,
+    // String 1 on fret 2
+    0x10, 0x80, 0x01, 0x00, 0x90, 0x00, 0x01, 0x21, 0x01, 0x75, 0x01, 0x01, 0x00, 0x90, 0x00, 0x01,
+    0x11, 0x01, 0x55, 0x02, 0x10, 0x00, 0x80, 0x04, 0x08, 0x88, 0x08, 0x28, 0x24, 0x1a, 0x00, 0x80,
+    0x04, 0x08, 0x88, 0x08, 0x48, 0x42, 0x14, 0x00, 0x80, 0x04, 0x08, 0x88, 0x08, 0x48, 0x40, 0x04,
+    0x00, 0x00, 0x03, 0x08, 0x88, 0x10, 0x50, 0x8a, 0x0c, 0x00, 0x00, 0x03, 0x10, 0x88, 0x10, 0x90,
+    0x20, 0x2a, 0x00, 0x00, 0x06, 0x20, 0x10, 0x21, 0x10, 0x28, 0x22, 0x00, 0x00, 0x06, 0x20, 0x20,
+    0x22, 0x10, 0xa0, 0x8c, 0x00, 0x00, 0x18, 0x80, 0x80, 0x88, 0x40, 0xa4, 0x10, 0x00, 0x00, 0x24,
+    0x80, 0x80, 0x48, 0x40, 0x04, 0x60, 0x00, 0x00, 0x24, 0x40, 0x40, 0x48, 0x40,
+    // String 2 on fret 2
+    0x20, 0x21, 0x01, 0x00, 0x88, 0x9f, 0x01, 0x04, 0xc8, 0x00, 0x22, 0x01, 0x00, 0x88, 0x9f, 0x01,
+    0x04, 0xc8, 0xa0, 0x5c, 0x1b, 0x00, 0x40, 0xfc, 0x0c, 0x20, 0x40, 0x06, 0x11, 0x01, 0x00, 0x40,
+    0xfc, 0x0c, 0x20, 0x40, 0x06, 0x00, 0x00, 0x00, 0x40, 0xfc, 0x0c, 0x20, 0x40, 0x26, 0xa2, 0x10,
+    0x00, 0x20, 0xfa, 0x0a, 0x20, 0x20, 0x26, 0x68, 0x11, 0x00, 0x20, 0xfa, 0x12, 0x20, 0x20, 0x46,
+    0xa8, 0x10, 0x00, 0x40, 0xf4, 0x26, 0x40, 0x40, 0x8c, 0xa0, 0x00, 0x00, 0x40, 0xf4, 0x26, 0x80,
+    0x40, 0x0c, 0xca, 0x02, 0x00, 0x00, 0xd1, 0x9b, 0x00, 0x02, 0x31, 0xc0, 0x04, 0x00, 0x00, 0xe2,
+    0xab, 0x00, 0x02, 0x32, 0x80, 0x45, 0x00, 0x00, 0xe2, 0x67, 0x00, 0x02, 0x32,
+    // String 3 on fret 2
+    0x25, 0x0b, 0x30, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x04, 0x11, 0x45, 0x30, 0x00, 0x14, 0x00, 0x0e,
+    0x00, 0x04, 0x01, 0x20, 0x80, 0x01, 0xa0, 0x00, 0x70, 0x00, 0x20, 0x08, 0x40, 0x80, 0x01, 0xa0,
+    0x00, 0x70, 0x00, 0x20, 0x28, 0x22, 0x80, 0x01, 0xa0, 0x00, 0x70, 0x00, 0x20, 0x08, 0x00, 0x80,
+    0x01, 0x40, 0x01, 0x70, 0x00, 0x40, 0x10, 0x00, 0x89, 0x01, 0x40, 0x01, 0x68, 0x00, 0x40, 0x10,
+    0x10, 0x20, 0x03, 0x80, 0x02, 0xd0, 0x00, 0x80, 0x10, 0x00, 0x20, 0x03, 0x80, 0x02, 0xd0, 0x00,
+    0x80, 0x10, 0x4a, 0x94, 0x0c, 0x00, 0x0a, 0x40, 0x03, 0x00, 0x42, 0x40, 0x00, 0x0c, 0x00, 0x05,
+    0x40, 0x03, 0x00, 0x41, 0x80, 0x00, 0x0c, 0x00, 0x05, 0x80, 0x03, 0x00, 0x41,
+    // String 4 on fret 2
+    0x00, 0x10, 0x0d, 0x00, 0x29, 0x35, 0x01, 0x01, 0x48, 0x02, 0x00, 0x0d, 0x00, 0x29, 0x35, 0x01,
+    0x01, 0x48, 0x02, 0x00, 0x70, 0x00, 0x48, 0xa9, 0x09, 0x08, 0x40, 0x12, 0x00, 0x60, 0x00, 0x48,
+    0xa9, 0x09, 0x08, 0x40, 0x32, 0xa2, 0x68, 0x00, 0x48, 0xa9, 0x09, 0x08, 0x40, 0x12, 0x00, 0x60,
+    0x00, 0xa8, 0xd0, 0x09, 0x08, 0x20, 0x0c, 0x00, 0x60, 0x00, 0xb0, 0xd0, 0x11, 0x08, 0x20, 0x0c,
+    0x40, 0xd0, 0x00, 0x60, 0xa1, 0x23, 0x10, 0x40, 0x28, 0x10, 0xc0, 0x00, 0x60, 0xa1, 0x23, 0x20,
+    0x40, 0x28, 0x00, 0x00, 0x03, 0x80, 0x85, 0x8e, 0x80, 0x00, 0xa1, 0x00, 0x00, 0x03, 0x80, 0x8a,
+    0x8e, 0x80, 0x00, 0xa2, 0x40, 0x41, 0x03, 0x40, 0x4a, 0x4d, 0x40, 0x00, 0x92,
+    // String 5 on fret 2
+    0x00, 0x10, 0x01, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x28, 0x00, 0x00, 0xa0,
+    0x04, 0x01, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x90, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x40, 0x02, 0x00, 0x00, 0x40, 0x41, 0x00, 0x80, 0x00, 0x80, 0x02, 0x00, 0x00,
+    // String 0 on fret 3
+    0xa8, 0x40, 0x00, 0x00, 0x00, 0x50, 0x90, 0x80, 0x10, 0x00, 0x86, 0x00, 0x00, 0x00, 0x50, 0xa0,
+    0x80, 0x10, 0x00, 0x28, 0x04, 0x00, 0x00, 0x80, 0x02, 0x05, 0x84, 0x00, 0x72, 0x04, 0x00, 0x00,
+    0x80, 0x02, 0x05, 0x84, 0x00, 0x44, 0x00, 0x00, 0x00, 0x80, 0x02, 0x05, 0x84, 0x00, 0x44, 0x10,
+    0x00, 0x00, 0x80, 0x04, 0x03, 0x82, 0x00, 0x04, 0x10, 0x00, 0x00, 0x80, 0x04, 0x03, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0x04, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x05,
+    0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x14, 0x10, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x18, 0x14, 0x20, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x14, 0x14, 0x20, 0x04,
+    // String 1 on fret 3
+    0x02, 0x24, 0x0c, 0x00, 0x44, 0xc4, 0x48, 0x04, 0x94, 0x0a, 0x28, 0x0c, 0x00, 0x44, 0xc4, 0x48,
+    0x04, 0x94, 0xaa, 0x00, 0x61, 0x00, 0x20, 0x22, 0x46, 0x22, 0xa0, 0x54, 0x01, 0x61, 0x00, 0x20,
+    0x22, 0x46, 0x22, 0xa0, 0x14, 0x20, 0x60, 0x00, 0x20, 0x22, 0x46, 0x22, 0xa0, 0x14, 0x10, 0x60,
+    0x00, 0x40, 0x44, 0x46, 0x24, 0xc0, 0x0a, 0x10, 0x60, 0x00, 0x40, 0x44, 0x26, 0x24, 0xc0, 0x0a,
+    0x10, 0xc0, 0x00, 0x80, 0x88, 0x4c, 0x48, 0x80, 0x25, 0x00, 0xc0, 0x00, 0x80, 0x88, 0x8c, 0x88,
+    0x80, 0x26, 0x00, 0x00, 0x03, 0x00, 0x22, 0x32, 0x22, 0x02, 0x9a, 0x01, 0x05, 0x03, 0x00, 0x11,
+    0x32, 0x22, 0x02, 0x95, 0x01, 0x06, 0x03, 0x00, 0x11, 0x31, 0x22, 0x02, 0xa5,
+    // String 2 on fret 3
+    0x12, 0x4a, 0x40, 0x6c, 0x02, 0x00, 0x40, 0x80, 0x00, 0x28, 0x84, 0x40, 0x6c, 0x02, 0x00, 0x40,
+    0x80, 0x00, 0x48, 0x20, 0x04, 0x62, 0x13, 0x00, 0x00, 0x02, 0x04, 0xc0, 0x6a, 0x16, 0x62, 0x13,
+    0x00, 0x00, 0x02, 0x04, 0x00, 0x55, 0x14, 0x62, 0x13, 0x00, 0x00, 0x02, 0x04, 0x00, 0x45, 0x04,
+    0xe2, 0x14, 0x00, 0x00, 0x04, 0x02, 0x00, 0x87, 0x04, 0xe2, 0x0c, 0x00, 0x00, 0x04, 0x02, 0x00,
+    0x02, 0x0a, 0xc4, 0x19, 0x00, 0x00, 0x08, 0x04, 0x00, 0x0a, 0x02, 0xc8, 0x19, 0x00, 0x00, 0x08,
+    0x04, 0x00, 0x20, 0x48, 0x20, 0x67, 0x00, 0x00, 0x20, 0x10, 0x00, 0x25, 0x00, 0x10, 0x5b, 0x00,
+    0x00, 0x20, 0x20, 0x00, 0x05, 0x00, 0x10, 0x9b, 0x00, 0x00, 0x20, 0x20, 0x00,
+    // String 3 on fret 3
+    0x12, 0xa4, 0x4c, 0xc9, 0x00, 0x40, 0x00, 0x00, 0x10, 0x6c, 0x38, 0x4c, 0xc9, 0x00, 0x40, 0x00,
+    0x00, 0x10, 0x48, 0x02, 0x61, 0x4a, 0x06, 0x00, 0x02, 0x00, 0x80, 0x60, 0x85, 0x61, 0x4a, 0x06,
+    0x00, 0x02, 0x00, 0x80, 0x40, 0x00, 0x61, 0x4a, 0x06, 0x00, 0x02, 0x00, 0x80, 0xe0, 0x90, 0x61,
+    0x2a, 0x06, 0x00, 0x04, 0x00, 0x80, 0xe0, 0x30, 0x60, 0x2a, 0x06, 0x00, 0x04, 0x00, 0x80, 0x40,
+    0x09, 0xc0, 0x54, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x81, 0x01, 0xc0, 0x68, 0x0c, 0x00, 0x08, 0x00,
+    0x00, 0x02, 0x04, 0x00, 0xa3, 0x31, 0x00, 0x20, 0x00, 0x00, 0x08, 0x0d, 0x15, 0x53, 0x32, 0x00,
+    0x10, 0x00, 0x00, 0x04, 0x0d, 0x26, 0x53, 0x32, 0x00, 0x10, 0x00, 0x00, 0x04,
+    // String 4 on fret 3
+    0x45, 0x4a, 0x30, 0x80, 0x00, 0x8a, 0xc0, 0x04, 0x00, 0x80, 0x82, 0x30, 0x80, 0x00, 0x8a, 0xc0,
+    0x04, 0x00, 0x00, 0x08, 0x84, 0x01, 0x04, 0x50, 0x04, 0x26, 0x00, 0x00, 0x10, 0x84, 0x01, 0x04,
+    0x50, 0x04, 0x26, 0x00, 0x00, 0x00, 0x80, 0x01, 0x04, 0x50, 0x04, 0x26, 0x00, 0xa0, 0xb0, 0x92,
+    0x01, 0x02, 0x28, 0x02, 0x26, 0x00, 0xa0, 0x70, 0x93, 0x01, 0x02, 0x28, 0x02, 0x26, 0x00, 0x40,
+    0x89, 0x04, 0x03, 0x04, 0x50, 0x04, 0x4c, 0x00, 0xc0, 0x85, 0x09, 0x03, 0x04, 0x50, 0x04, 0x8c,
+    0x00, 0x80, 0x04, 0x22, 0x0c, 0x10, 0x40, 0x11, 0x30, 0x02, 0x00, 0x1a, 0x28, 0x0c, 0x20, 0x40,
+    0x21, 0x30, 0x02, 0x00, 0x2a, 0x08, 0x0c, 0x20, 0x80, 0x22, 0x30, 0x02, 0x00,
+    // String 5 on fret 3
+    0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10,
+    0x40, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40,
+    // String 0 on fret 4
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00, 0x10, 0x40, 0x40, 0x00, 0x80, 0x00, 0x00, 0x08, 0x00,
+    0x20, 0x40, 0x00, 0x02, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x04, 0x00,
+    0x40, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+    0x04, 0x00, 0x20, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x01, 0x04,
+    0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x02, 0x48, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00,
+    0x01, 0x88, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x04, 0x20, 0x02, 0x00, 0x20, 0x00, 0x00,
+    0x01, 0x00, 0x04, 0x20, 0x02, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x04, 0x10,
+    // String 1 on fret 4
+    0x00, 0x00, 0x80, 0x06, 0x01, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x06, 0x01, 0x20, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x34, 0x08, 0x00, 0x01, 0x40, 0x00, 0x80, 0x00, 0x00, 0x34, 0x08,
+    0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x34, 0x08, 0x00, 0x01, 0x40, 0x00, 0x00, 0x21, 0x00,
+    0x54, 0x08, 0x00, 0x01, 0x40, 0x00, 0x00, 0x41, 0x00, 0x54, 0x10, 0x00, 0x01, 0x40, 0x00, 0x00,
+    0x82, 0x00, 0xa8, 0x20, 0x00, 0x01, 0x80, 0x00, 0x00, 0x82, 0x00, 0x94, 0x20, 0x00, 0x01, 0x40,
+    0x00, 0x00, 0x00, 0x02, 0x50, 0x82, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x81, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x41, 0x00, 0x08, 0x00, 0x01, 0x00,
+    // String 2 on fret 4
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00,
+    // String 3 on fret 4
+    0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x10, 0x08, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x10,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x08,
+    // String 4 on fret 4
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x20, 0x20, 0x00, 0x04, 0x50, 0x00, 0x00, 0x80, 0x00, 0x10,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x80, 0x00, 0x20, 0x80, 0x00, 0x00, 0x00,
+    0x04, 0x80, 0x80, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x04, 0x80, 0x80, 0x00, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x02, 0x80, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x08, 0x00,
+    // String 5 on fret 4
+    0x40, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x14, 0x1a, 0x20, 0x80, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x24,
+    0x2a, 0x20, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x20, 0x51, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00,
+    0x00, 0x20, 0x51, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x20, 0x51, 0x01, 0x01, 0x00, 0x00,
+    0x15, 0x00, 0x00, 0x20, 0x51, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00, 0x00, 0x40, 0x51, 0x01, 0x01,
+    0x00, 0x00, 0x2a, 0x00, 0x00, 0x80, 0xa2, 0x02, 0x42, 0x04, 0x00, 0x15, 0x00, 0x00, 0x40, 0x51,
+    0x01, 0x81, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x45, 0x05, 0x04, 0x12, 0x00, 0xa4, 0x00, 0x00,
+    0x00, 0x45, 0x05, 0x08, 0x22, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x85, 0x05, 0x08,
+    // String 0 unplayed
+    0x00, 0x00, 0x30, 0xd0, 0x3e, 0x04, 0x48, 0x04, 0x00, 0x00, 0x00, 0x30, 0xd0, 0x3e, 0x04, 0x48,
+    0x04, 0x00, 0x00, 0x00, 0x80, 0x81, 0xf6, 0x21, 0x40, 0x22, 0x00, 0x00, 0x00, 0x80, 0x81, 0xf6,
+    0x21, 0x40, 0x22, 0x00, 0x00, 0x00, 0x80, 0x81, 0xf6, 0x21, 0x40, 0x22, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0xf7, 0x41, 0x40, 0x24, 0x00, 0x00, 0x00, 0x80, 0x01, 0xef, 0x41, 0x20, 0x24, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xde, 0x83, 0x40, 0x48, 0x00, 0x00, 0x00, 0x00, 0x03, 0xde, 0x83, 0x80, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x78, 0x0f, 0x02, 0x22, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x74, 0x0f,
+    0x02, 0x22, 0x02, 0x00, 0x00, 0x00, 0x0c, 0xb4, 0x0f, 0x01, 0x22, 0x02, 0x00,
+    // String 1 unplayed
+    0x00, 0x00, 0x00, 0xd0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x46, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x46,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x46, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    // String 2 unplayed
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x80,
+    // String 3 unplayed
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 4 unplayed
+    0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x91, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xc0, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    // String 5 unplayed
+    0x8c, 0x49, 0x56, 0x55, 0x55, 0x55, 0x61, 0x65, 0x55, 0x10, 0xc7, 0x56, 0x55, 0x55, 0x55, 0x51,
+    0x55, 0x55, 0x90, 0x68, 0xa6, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0xaa, 0x82, 0x7b, 0xae, 0xaa, 0xaa,
+    0xaa, 0x8a, 0xaa, 0xaa, 0x02, 0x11, 0xa4, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0xaa, 0x02, 0x4d, 0xc4,
+    0x4a, 0x4d, 0xd5, 0x8c, 0xac, 0xd4, 0x04, 0x87, 0xcc, 0x4a, 0x55, 0xd5, 0x94, 0xac, 0xd4, 0x04,
+    0x32, 0xaa, 0x95, 0xaa, 0xaa, 0x2a, 0x59, 0xa9, 0x09, 0x6a, 0xb7, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa,
+    0xaa, 0x0a, 0xa9, 0x88, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0x2a, 0xe0, 0x8a, 0x5a, 0x95, 0x95,
+    0x9a, 0xa8, 0x5a, 0x25, 0x90, 0x88, 0x59, 0x55, 0x55, 0x55, 0x68, 0x5a, 0x15,
+    // Starting fret bit 0
+    0xff, 0xee, 0xf2, 0x57, 0x56, 0x40, 0x5e, 0x5e, 0x35, 0x54, 0x51, 0x0d, 0xa8, 0xa9, 0xbf, 0x91,
+    0x91, 0xca, 0xeb, 0x7c, 0x8f, 0xbf, 0xb2, 0x02, 0x72, 0x73, 0xab, 0xa1, 0xae, 0x7a, 0x40, 0x4d,
+    0xfd, 0x8d, 0x8c, 0x54, 0x3e, 0xa2, 0x88, 0xbf, 0xb2, 0x02, 0x72, 0x73, 0xab, 0xe1, 0xff, 0x7f,
+    0xa0, 0xaa, 0xfa, 0x8b, 0x8a, 0x2a, 0x1e, 0x8a, 0x88, 0x5f, 0x4d, 0x05, 0x6c, 0x75, 0xd5, 0x41,
+    0xdb, 0xdc, 0x40, 0x65, 0xf5, 0x27, 0x15, 0x55, 0x7c, 0x7c, 0x37, 0xbf, 0x9a, 0x0a, 0xd8, 0xd9,
+    0xa9, 0x03, 0x4e, 0x36, 0x03, 0x95, 0xd5, 0x9f, 0x98, 0x58, 0xf1, 0xb7, 0xdf, 0xfc, 0x55, 0x15,
+    0x50, 0x67, 0x57, 0x0d, 0xd8, 0x41, 0x03, 0x6a, 0xea, 0x6f, 0x58, 0xa8, 0xf2,
+    // Starting fret bit 1
+    0x12, 0xb4, 0x45, 0x55, 0x57, 0x75, 0x0b, 0x41, 0x55, 0x81, 0x86, 0xb7, 0x02, 0x01, 0x35, 0x65,
+    0x2f, 0x60, 0x15, 0xab, 0xc4, 0x55, 0x45, 0x55, 0xa4, 0xf7, 0x55, 0x75, 0x85, 0x41, 0xea, 0xf7,
+    0x57, 0xd6, 0x84, 0xfe, 0x94, 0x5d, 0x36, 0xaa, 0xba, 0xaa, 0x5b, 0x08, 0xaa, 0x0a, 0x45, 0xc4,
+    0x15, 0x08, 0xd0, 0x29, 0x7d, 0x01, 0xf5, 0x70, 0xb3, 0xb5, 0xa2, 0x2a, 0xc2, 0xf7, 0x2b, 0xeb,
+    0xad, 0x67, 0xd4, 0xdf, 0x5f, 0x5c, 0x05, 0xfd, 0x25, 0x2a, 0xa2, 0xa8, 0xba, 0xaa, 0xbb, 0x20,
+    0xa8, 0xda, 0x11, 0x41, 0x5e, 0x80, 0x80, 0x8e, 0xe5, 0x07, 0x64, 0x5a, 0xaa, 0xad, 0x2a, 0x6a,
+    0x21, 0x7d, 0xaf, 0x9a, 0x8d, 0x36, 0x52, 0xbf, 0xbf, 0xb2, 0x1a, 0xf8, 0xa7,
+    // Starting fret bit 2
+    0x40, 0x01, 0xa2, 0x02, 0x02, 0x20, 0x3e, 0x3a, 0x20, 0xa9, 0x28, 0xe2, 0x57, 0x54, 0x60, 0x24,
+    0x6a, 0x35, 0x49, 0x00, 0x31, 0xbf, 0xaa, 0xaa, 0x2a, 0x59, 0xab, 0x43, 0x50, 0xa5, 0xaa, 0xaa,
+    0xaa, 0x0a, 0x2a, 0xaa, 0x42, 0x00, 0xe1, 0xea, 0xef, 0xff, 0x8e, 0xae, 0xfe, 0x56, 0x00, 0xc1,
+    0x00, 0x18, 0xd0, 0xd8, 0xac, 0x00, 0x44, 0x05, 0x84, 0x00, 0x00, 0x00, 0x81, 0xa4, 0x00, 0x10,
+    0x02, 0x08, 0x2a, 0x00, 0x00, 0x80, 0xa3, 0x03, 0x82, 0x83, 0x48, 0x40, 0x45, 0x55, 0x04, 0x04,
+    0x54, 0x24, 0xa4, 0xaa, 0xa1, 0x7f, 0x7f, 0x71, 0x12, 0xf0, 0x9b, 0xa8, 0x20, 0x03, 0xea, 0xea,
+    0xef, 0x92, 0xa0, 0xf2, 0x2a, 0x88, 0xae, 0xaa, 0xaa, 0xaa, 0xb7, 0xa7, 0xea,
+    // Starting fret bit 3
+    0x00, 0x00, 0x08, 0xa8, 0xa8, 0x8a, 0xa0, 0xa0, 0x8a, 0x02, 0x00, 0x08, 0xa8, 0xaa, 0x8a, 0x8a,
+    0x80, 0x8a, 0x02, 0x00, 0x40, 0x40, 0x55, 0x55, 0x55, 0x04, 0x54, 0x1c, 0x00, 0x40, 0x55, 0x55,
+    0x55, 0x75, 0x55, 0x55, 0x1d, 0x00, 0x40, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55, 0x1d, 0x00, 0x00,
+    0x5f, 0x55, 0x05, 0x75, 0x51, 0xd5, 0x11, 0x00, 0x40, 0x5f, 0x55, 0xd5, 0x55, 0x59, 0xd5, 0x15,
+    0x00, 0x80, 0xbf, 0xaa, 0xaa, 0xaa, 0xfa, 0xaa, 0x0b, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa,
+    0xaa, 0x0a, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0x2a, 0x00, 0x00, 0x0a, 0x80, 0x80,
+    0x8a, 0xa8, 0x0a, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x0a, 0x00
+};
+#else
+
+#if CHORD_DELTA_STREAM
+
+// The delta encoded voicings of the reduced chord library.
+const uint8_t ChordStream[CHORD_STREAM_SIZE] CHORD_PROGMEM =
+{
+    0x08, 0xb4, 0x05, 0xff, 0xc9, 0xb6, 0x24, 0xd0, 0xc9, 0x2c, 0x57, 0xa0, 0x78, 0x12, 0x60, 0xbd,
+    0x92, 0x71, 0x08, 0x8c, 0x93, 0xfe, 0x6b, 0xd8, 0xb6, 0x7e, 0xb6, 0x24, 0xd0, 0xf1, 0x0b, 0x10,
+    0x49, 0x82, 0x4c, 0x2c, 0x19, 0x14, 0x92, 0x22, 0x09, 0xf6, 0x4a, 0x72, 0xf6, 0x11, 0x8d, 0xc1,
+    0x4a, 0x5b, 0xca, 0x41, 0x7f, 0x02, 0x1d, 0x61, 0xd8, 0x5b, 0x92, 0x71, 0x48, 0x2a, 0xcb, 0x74,
+    0x38, 0xd3, 0x5d, 0x53, 0xb6, 0x20, 0x8d, 0x30, 0x82, 0x5a, 0x01, 0x3a, 0x5f, 0x59, 0x96, 0x01,
+    0x92, 0x22, 0x0d, 0x76, 0x4b, 0x72, 0xf6, 0x12, 0x01, 0xc1, 0x5b, 0xdb, 0x12, 0xec, 0xd7, 0x18,
+    0x93, 0x02, 0x05, 0xfb, 0x97, 0x01, 0xb1, 0x28, 0x4c, 0xc4, 0xd0, 0xdb, 0x59, 0xb2, 0x46, 0x8a,
+    0xe2, 0x4c, 0x0f, 0xf6, 0x5b, 0x96, 0x24, 0x99, 0x96, 0x14, 0xfa, 0x08, 0x70, 0xba, 0xb3, 0x65,
+    0x85, 0x20, 0xb6, 0x24, 0x45, 0xfe, 0xa2, 0x8c, 0xc1, 0x6a, 0x5b, 0x58, 0x87, 0x98, 0x47, 0x17,
+    0xfd, 0x0d, 0x96, 0x8f, 0x43, 0xa5, 0x80, 0xa4, 0x92, 0xb6, 0x40, 0x71, 0xa6, 0xd3, 0x9f, 0x64,
+    0x0c, 0x99, 0x96, 0x18, 0xef, 0x90, 0x96, 0x33, 0xa5, 0x65, 0x15, 0x02, 0x48, 0x1b, 0x3f, 0x20,
+    0x12, 0xe2, 0x53, 0xc6, 0xc4, 0x15, 0x24, 0x9c, 0xc4, 0x7d, 0x81, 0x1a, 0x2d, 0x58, 0x90, 0x05,
+    0x59, 0xb0, 0x05, 0x4a, 0x81, 0x00, 0x49, 0xc6, 0x10, 0x7f, 0x01, 0x80, 0x80, 0x97, 0xb4, 0xbc,
+    0x6a, 0x28, 0x2a, 0x94, 0xf5, 0x4b, 0xb4, 0x05, 0x6b, 0x29, 0x8c, 0x90, 0xc7, 0x23, 0x7e, 0x0c,
+    0xd0, 0x60, 0x89, 0x96, 0x1f, 0xdd, 0xb6, 0xe0, 0xa0, 0xb2, 0x40, 0x2d, 0x90, 0x01, 0x49, 0xc6,
+    0x14, 0xd8, 0xc8, 0xb8, 0x8f, 0xb4, 0x3c, 0x0a, 0x60, 0x61, 0x22, 0x29, 0x19, 0x56, 0x53, 0x18,
+    0x21, 0xdf, 0x49, 0x5c, 0x8e, 0x30, 0xd4, 0x60, 0x89, 0x26, 0x88, 0xbf, 0x64, 0xd9, 0xc2, 0x01,
+    0x11, 0x8b, 0x30, 0xf7, 0x32, 0xe6, 0x89, 0xb4, 0x08, 0x8c, 0x84, 0x3b, 0x49, 0xcb, 0x61, 0x46,
+    0x64, 0x61, 0xca, 0x2d, 0x00, 0x54, 0x72, 0xb2, 0x04, 0x8a, 0x90, 0xdc, 0xc5, 0xe5, 0x0e, 0x00,
+    0x0b, 0x50, 0xea, 0x98, 0xbe, 0x55, 0xa4, 0x1f, 0x8f, 0x68, 0x2f, 0xc2, 0x00, 0x01, 0x10, 0x09,
+    0x2e, 0x8d, 0xc7, 0x3f, 0x49, 0x96, 0x92, 0xa5, 0x4c, 0x0f, 0x69, 0x37, 0x14, 0x1d, 0x0e, 0x92,
+    0x36, 0x45, 0x0b, 0x84, 0xec, 0x34, 0x2e, 0x07, 0x92, 0x70, 0x94, 0x0c, 0x4a, 0x14, 0xfd, 0x98,
+    0x7e, 0xad, 0x44, 0x0d, 0x4b, 0xb2, 0x07, 0xdf, 0x89, 0xc6, 0x34, 0x11, 0x6e, 0x98, 0x92, 0x24,
+    0xc9, 0x0d, 0x45, 0xc5, 0x05, 0x00, 0x31, 0x8e, 0x81, 0x2e, 0x33, 0x24, 0xd3, 0x95, 0x25, 0xd0,
+    0x0f, 0x05, 0xdc, 0x49, 0x5a, 0x6e, 0x48, 0x88, 0x22, 0x00, 0x08, 0x02, 0x08, 0xf7, 0x0a, 0xb5,
+    0xe4, 0x0c, 0x45, 0xf4, 0x29, 0x63, 0x9e, 0x21, 0xd8, 0x90, 0xd4, 0x14, 0x2d, 0x37, 0x14, 0xe9,
+    0x8d, 0x6d, 0x39, 0x3c, 0x64, 0x02, 0x61, 0xb5, 0x64, 0x06, 0x62, 0xba, 0x94, 0xe3, 0x95, 0x48,
+    0x8f, 0xa2, 0x03, 0x59, 0x96, 0x04, 0xfb, 0x51, 0xf2, 0x47, 0x50, 0x91, 0x6d, 0x81, 0x0a, 0x5b,
+    0x92, 0x22, 0x38, 0xa2, 0x6c, 0x94, 0xed, 0x30, 0x91, 0x09, 0x84, 0xf5, 0x92, 0x39, 0x0f, 0xe1,
+    0x3f, 0x90, 0x70, 0x90, 0x74, 0x4e, 0x24, 0x82, 0x22, 0x05, 0x7f, 0xc9, 0xb2, 0x04, 0x82, 0xda,
+    0xd3, 0x92, 0x5d, 0x05, 0xb0, 0x40, 0xf4, 0x43, 0x8a, 0x74, 0x44, 0x01
+};
+
+// The byte offset in ChordStream[] of every CHORD_KEYFRAME_INTERVAL'th voicing.
+const uint16_t ChordStreamKeyframes[(NUM_CHORD_VOICINGS + CHORD_KEYFRAME_INTERVAL - 1) /
+                                    CHORD_KEYFRAME_INTERVAL] CHORD_PROGMEM =
+{
+       0,   38,   80,  119,  161,  198,  238,  278,  317,  356,  394,  435,
+     471
+};
+
+#else
+
+// The shape dictionary of the reduced chord library.
+const uint8_t ChordShapes[NUM_CHORD_SHAPES * CHORD_SHAPE_SIZE] CHORD_PROGMEM =
+{
+    PACK_SHAPE(3, 3, 2, 0, 1, 0),   //   0: C Major 1
+    PACK_SHAPE(1, 1, 3, 3, 3, 1),   //   1: C Major 2
+    PACK_SHAPE(X, 3, 2, 0, 1, 0),   //   2: C Major 3
+    PACK_SHAPE(X, X, 1, 0, 1, 3),   //   3: C Minor 1
+    PACK_SHAPE(1, 1, 3, 3, 2, 1),   //   4: C Minor 2
+    PACK_SHAPE(0, 0, 2, 2, 1, 3),   //   5: C 6th 1
+    PACK_SHAPE(4, 3, 1, 1, 1, 1),   //   6: C 6th 2
+    PACK_SHAPE(X, 0, 1, 0, 1, 3),   //   7: C Minor 6th 1
+    PACK_SHAPE(X, X, 2, 2, 1, 2),   //   8: C Minor 6th 2
+    PACK_SHAPE(3, 3, 2, 3, 1, 0),   //   9: C 7th 1
+    PACK_SHAPE(1, 1, 3, 1, 3, 1),   //  10: C 7th 2
+    PACK_SHAPE(X, 3, 2, 3, 1, 0),   //  11: C 7th 3
+    PACK_SHAPE(2, 2, 1, 0, 0, 0),   //  12: C Major 7th 1
+    PACK_SHAPE(1, 1, 3, 2, 3, 1),   //  13: C Major 7th 2
+    PACK_SHAPE(X, 3, 1, 3, 1, 3),   //  14: C Minor 7th 1
+    PACK_SHAPE(1, 1, 3, 1, 2, 1),   //  15: C Minor 7th 2
+    PACK_SHAPE(2, 2, 1, 2, 2, 2),   //  16: C 9th 1
+    PACK_SHAPE(X, 1, 1, 1, 1, 2),   //  17: C 9th 2
+    PACK_SHAPE(1, 4, 3, 1, 2, 1),   //  18: C# Major 1
+    PACK_SHAPE(X, X, 2, 1, 2, 0),   //  19: C# Minor 1
+    PACK_SHAPE(1, 1, 3, 1, 2, 4),   //  20: C# 6th 1
+    PACK_SHAPE(X, 1, 2, 1, 2, 0),   //  21: C# Minor 6th 1
+    PACK_SHAPE(X, 3, 1, 2, 1, 3),   //  22: C# Minor 6th 2
+    PACK_SHAPE(X, X, 2, 3, 1, 3),   //  23: C# 7th 1
+    PACK_SHAPE(1, 4, 3, 1, 1, 1),   //  24: C# Major 7th 1
+    PACK_SHAPE(X, 4, 2, 1, 0, 0),   //  25: C# Minor 7th 1
+    PACK_SHAPE(1, 0, 0, 1, 2, 1),   //  26: D Major 1
+    PACK_SHAPE(X, X, 0, 1, 2, 1),   //  27: D Major 3
+    PACK_SHAPE(1, 0, 0, 2, 3, 1),   //  28: D Minor 1
+    PACK_SHAPE(X, X, 0, 2, 3, 1),   //  29: D Minor 3
+    PACK_SHAPE(1, 0, 0, 1, 0, 1),   //  30: D 6th 1
+    PACK_SHAPE(1, 0, 0, 2, 0, 1),   //  31: D Minor 6th 1
+    PACK_SHAPE(2, 0, 0, 2, 1, 2),   //  32: D 7th 1
+    PACK_SHAPE(X, X, 0, 2, 1, 2),   //  33: D 7th 3
+    PACK_SHAPE(1, 0, 0, 1, 1, 1),   //  34: D Major 7th 1
+    PACK_SHAPE(X, 0, 0, 2, 1, 1),   //  35: D Minor 7th 1
+    PACK_SHAPE(2, 0, 0, 2, 1, 0),   //  36: D 9th 1
+    PACK_SHAPE(X, 1, 1, 3, 4, 2),   //  37: Eb Minor 1
+    PACK_SHAPE(X, X, 3, 2, 3, 1),   //  38: Eb Minor 2
+    PACK_SHAPE(X, 1, 1, 3, 1, 3),   //  39: Eb 6th 1
+    PACK_SHAPE(X, 1, 1, 3, 1, 2),   //  40: Eb Minor 6th 1
+    PACK_SHAPE(X, 1, 1, 3, 2, 3),   //  41: Eb 7th 1
+    PACK_SHAPE(X, 1, 1, 3, 2, 2),   //  42: Eb Minor 7th 1
+    PACK_SHAPE(X, 1, 1, 0, 2, 1),   //  43: Eb 9th 1
+    PACK_SHAPE(3, 1, 1, 3, 2, 1),   //  44: Eb 9th 2
+    PACK_SHAPE(0, 2, 2, 1, 0, 0),   //  45: E Major 1
+    PACK_SHAPE(0, 1, 1, 0, 0, 0),   //  46: E Minor 1
+    PACK_SHAPE(0, 2, 2, 1, 2, 0),   //  47: E 6th 1
+    PACK_SHAPE(0, 1, 1, 3, 1, 3),   //  48: E 6th 2
+    PACK_SHAPE(0, 1, 1, 0, 1, 0),   //  49: E Minor 6th 1
+    PACK_SHAPE(0, 2, 2, 1, 3, 0),   //  50: E 7th 1
+    PACK_SHAPE(0, 1, 1, 3, 2, 3),   //  51: E 7th 2
+    PACK_SHAPE(0, 2, 1, 1, 0, 0),   //  52: E Major 7th 1
+    PACK_SHAPE(0, 1, 0, 0, 0, 0),   //  53: E Minor 7th 1
+    PACK_SHAPE(0, 2, 0, 1, 0, 2),   //  54: E 9th 1
+    PACK_SHAPE(1, 3, 3, 2, 1, 1),   //  55: F Major 1
+    PACK_SHAPE(1, 3, 3, 1, 1, 1),   //  56: F Minor 1
+    PACK_SHAPE(1, 0, 0, 2, 1, 1),   //  57: F 6th 1
+    PACK_SHAPE(X, X, 0, 1, 1, 1),   //  58: F Minor 6th 1
+    PACK_SHAPE(1, 3, 3, 1, 3, 1),   //  59: F Minor 6th 2
+    PACK_SHAPE(1, 3, 1, 2, 4, 1),   //  60: F 7th 1
+    PACK_SHAPE(1, 3, 3, 2, 1, 0),   //  61: F Major 7th 1
+    PACK_SHAPE(1, 3, 1, 1, 1, 1),   //  62: F Minor 7th 1
+    PACK_SHAPE(1, 0, 1, 0, 1, 1),   //  63: F 9th 1
+    PACK_SHAPE(1, 3, 1, 2, 1, 3),   //  64: F 9th 2
+    PACK_SHAPE(2, 0, 1, 2, 2, 2),   //  65: F# Minor 6th 1
+    PACK_SHAPE(X, 1, 4, 3, 2, 1),   //  66: F# Major 7th 1
+    PACK_SHAPE(1, 3, 2, 2, 1, 1),   //  67: F# Major 7th 2
+    PACK_SHAPE(X, 1, 2, 1, 2, 2),   //  68: F# 9th 1
+    PACK_SHAPE(2, 1, 0, 0, 0, 2),   //  69: G Major 1
+    PACK_SHAPE(2, 1, 0, 0, 2, 2),   //  70: G Major 3
+    PACK_SHAPE(2, 1, 0, 0, 0, 0),   //  71: G 6th 1
+    PACK_SHAPE(X, 1, 2, 0, 3, 0),   //  72: G Minor 6th 1
+    PACK_SHAPE(X, X, 1, 2, 2, 2),   //  73: G Minor 6th 2
+    PACK_SHAPE(3, 2, 0, 0, 0, 1),   //  74: G 7th 1
+    PACK_SHAPE(2, 1, 0, 0, 0, 1),   //  75: G Major 7th 1
+    PACK_SHAPE(3, 2, 0, 2, 0, 1),   //  76: G 9th 1
+    PACK_SHAPE(4, 3, 1, 1, 1, 4),   //  77: Ab Major 1
+    PACK_SHAPE(1, 2, 1, 1, 0, 1),   //  78: Ab Minor 6th 1
+    PACK_SHAPE(X, X, 1, 1, 1, 2),   //  79: Ab 7th 1
+    PACK_SHAPE(X, 3, 1, 1, 1, 3),   //  80: Ab Major 7th 1
+    PACK_SHAPE(X, X, 1, 1, 0, 2),   //  81: Ab Minor 7th 1
+    PACK_SHAPE(0, 0, 1, 1, 1, 0),   //  82: A Major 1
+    PACK_SHAPE(X, 0, 1, 1, 1, 0),   //  83: A Major 3
+    PACK_SHAPE(0, 0, 2, 2, 1, 0),   //  84: A Minor 1
+    PACK_SHAPE(X, 0, 2, 2, 1, 0),   //  85: A Minor 3
+    PACK_SHAPE(0, 0, 1, 1, 1, 1),   //  86: A 6th 1
+    PACK_SHAPE(0, 0, 2, 2, 1, 2),   //  87: A Minor 6th 1
+    PACK_SHAPE(X, 0, 1, 2, 2, 2),   //  88: A Minor 6th 2
+    PACK_SHAPE(0, 0, 1, 0, 1, 0),   //  89: A 7th 1
+    PACK_SHAPE(0, 0, 2, 1, 2, 0),   //  90: A Major 7th 1
+    PACK_SHAPE(0, 0, 2, 0, 1, 0),   //  91: A Minor 7th 1
+    PACK_SHAPE(0, 0, 1, 3, 1, 2),   //  92: A 9th 1
+    PACK_SHAPE(1, 1, 0, 1, 1, 1),   //  93: Bb 9th 1
+    PACK_SHAPE(2, 2, 0, 1, 0, 2),   //  94: B Minor 6th 1
+    PACK_SHAPE(2, 2, 1, 2, 0, 2),   //  95: B 7th 1
+    PACK_SHAPE(1, 1, 0, 1, 0, 1)    //  96: B Minor 7th 1
+};
+
+// The shape id of each voicing, in key, type, variation order.
+const uint8_t ChordShapeIds[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+      0,   1,   2,    // C Major
+      3,   4,    // C Minor
+      5,   6,    // C 6th
+      7,   8,    // C Minor 6th
+      9,  10,  11,    // C 7th
+     12,  13,    // C Major 7th
+     14,  15,    // C Minor 7th
+     16,  17,    // C 9th
+     18,   1,    // C# Major
+     19,   4,    // C# Minor
+     20,   6,    // C# 6th
+     21,  22,    // C# Minor 6th
+     23,  10,    // C# 7th
+     24,  13,    // C# Major 7th
+     25,  14,    // C# Minor 7th
+     16,  17,    // C# 9th
+     26,   1,  27,    // D Major
+     28,   4,  29,    // D Minor
+     30,  20,    // D 6th
+     31,  22,    // D Minor 6th
+     32,  23,  33,    // D 7th
+     34,  13,    // D Major 7th
+     35,  14,    // D Minor 7th
+     36,  16,    // D 9th
+     18,   1,    // Eb Major
+     37,  38,    // Eb Minor
+     39,  20,    // Eb 6th
+     40,  22,    // Eb Minor 6th
+     41,  23,    // Eb 7th
+     24,  13,    // Eb Major 7th
+     42,  14,    // Eb Minor 7th
+     43,  44,    // Eb 9th
+     45,  18,    // E Major
+     46,  37,    // E Minor
+     47,  48,    // E 6th
+     49,  40,    // E Minor 6th
+     50,  51,    // E 7th
+     52,  24,    // E Major 7th
+     53,  42,    // E Minor 7th
+     54,  44,    // E 9th
+     55,  18,    // F Major
+     56,  37,    // F Minor
+     57,  39,    // F 6th
+     58,  59,    // F Minor 6th
+     60,  41,    // F 7th
+     61,  24,    // F Major 7th
+     62,  42,    // F Minor 7th
+     63,  64,    // F 9th
+     55,  18,    // F# Major
+     56,  37,    // F# Minor
+     42,  39,    // F# 6th
+     65,  59,    // F# Minor 6th
+     61,  60,    // F# 7th
+     66,  67,    // F# Major 7th
+     62,  42,    // F# Minor 7th
+     68,  64,    // F# 9th
+     69,  55,  70,    // G Major
+     56,  37,    // G Minor
+     71,  61,    // G 6th
+     72,  73,    // G Minor 6th
+     74,  60,    // G 7th
+     75,  66,    // G Major 7th
+     62,  42,    // G Minor 7th
+     76,  68,    // G 9th
+     77,  55,    // Ab Major
+     56,  37,    // Ab Minor
+      6,  42,    // Ab 6th
+     78,  73,    // Ab Minor 6th
+     79,  60,    // Ab 7th
+     80,  66,    // Ab Major 7th
+     81,  62,    // Ab Minor 7th
+     17,  68,    // Ab 9th
+     82,  77,  83,    // A Major
+     84,  56,  85,    // A Minor
+     86,  42,    // A 6th
+     87,  88,    // A Minor 6th
+     89,  60,    // A 7th
+     90,  66,    // A Major 7th
+     91,  62,    // A Minor 7th
+     92,  68,    // A 9th
+      1,  77,    // Bb Major
+      4,  56,    // Bb Minor
+      6,  42,    // Bb 6th
+      8,  73,    // Bb Minor 6th
+     10,  79,    // Bb 7th
+     13,  80,    // Bb Major 7th
+     15,  62,    // Bb Minor 7th
+     93,  17,    // Bb 9th
+      1,  77,    // B Major
+      4,  56,    // B Minor
+     81,   6,    // B 6th
+     94,   8,    // B Minor 6th
+     95,  10,    // B 7th
+     13,  80,    // B Major 7th
+     96,  15,    // B Minor 7th
+     16,  17    // B 9th
+};
+
+// The starting fret of each voicing.  Each PACK_FRETS() holds two voicings,
+// one key per line.
+const uint8_t ChordFrets[(NUM_CHORD_VOICINGS + 1) / 2] CHORD_PROGMEM =
+{
+    // C
+    PACK_FRETS(1, 3), PACK_FRETS(1, 1), PACK_FRETS(3, 1), PACK_FRETS(5, 1),
+    PACK_FRETS(4, 1), PACK_FRETS(3, 1), PACK_FRETS(2, 3), PACK_FRETS(1, 3),
+    PACK_FRETS(2, 5),
+    // C#
+    PACK_FRETS(1, 4), PACK_FRETS(1, 4), PACK_FRETS(1, 6),
+    PACK_FRETS(1, 2), PACK_FRETS(2, 4), PACK_FRETS(1, 4), PACK_FRETS(1, 2),
+    PACK_FRETS(3, 6),
+    // D
+    PACK_FRETS(2, 5), PACK_FRETS(2, 1), PACK_FRETS(5, 1),
+    PACK_FRETS(2, 2), PACK_FRETS(1, 3), PACK_FRETS(1, 3), PACK_FRETS(1, 2),
+    PACK_FRETS(5, 1), PACK_FRETS(3, 1), PACK_FRETS(4, 3),
+    // Eb
+    PACK_FRETS(6, 1),
+    PACK_FRETS(2, 1), PACK_FRETS(3, 1), PACK_FRETS(4, 1), PACK_FRETS(4, 3),
+    PACK_FRETS(6, 1), PACK_FRETS(4, 1), PACK_FRETS(1, 1),
+    // E
+    PACK_FRETS(4, 2),
+    PACK_FRETS(2, 1), PACK_FRETS(2, 2), PACK_FRETS(2, 1), PACK_FRETS(2, 1),
+    PACK_FRETS(4, 2), PACK_FRETS(2, 1), PACK_FRETS(2, 1),
+    // F
+    PACK_FRETS(5, 1),
+    PACK_FRETS(3, 1), PACK_FRETS(3, 1), PACK_FRETS(1, 1), PACK_FRETS(3, 1),
+    PACK_FRETS(5, 1), PACK_FRETS(3, 1), PACK_FRETS(1, 2),
+    // F#
+    PACK_FRETS(6, 2),
+    PACK_FRETS(4, 1), PACK_FRETS(4, 1), PACK_FRETS(2, 2), PACK_FRETS(2, 1),
+    PACK_FRETS(2, 2), PACK_FRETS(4, 1), PACK_FRETS(2, 2),
+    // G
+    PACK_FRETS(3, 2),
+    PACK_FRETS(3, 5), PACK_FRETS(2, 3), PACK_FRETS(1, 2), PACK_FRETS(1, 3),
+    PACK_FRETS(2, 2), PACK_FRETS(3, 5), PACK_FRETS(1, 2),
+    // Ab
+    PACK_FRETS(1, 4),
+    PACK_FRETS(4, 6), PACK_FRETS(1, 3), PACK_FRETS(1, 3), PACK_FRETS(1, 4),
+    PACK_FRETS(1, 3), PACK_FRETS(1, 4), PACK_FRETS(1, 3),
+    // A
+    PACK_FRETS(2, 2),
+    PACK_FRETS(2, 1), PACK_FRETS(5, 1), PACK_FRETS(2, 4), PACK_FRETS(1, 4),
+    PACK_FRETS(2, 5), PACK_FRETS(1, 4), PACK_FRETS(1, 5), PACK_FRETS(2, 4),
+    // Bb
+    PACK_FRETS(1, 3), PACK_FRETS(1, 6), PACK_FRETS(3, 5), PACK_FRETS(2, 5),
+    PACK_FRETS(1, 3), PACK_FRETS(1, 3), PACK_FRETS(1, 6), PACK_FRETS(1, 3),
+    // B
+    PACK_FRETS(2, 4), PACK_FRETS(2, 7), PACK_FRETS(1, 4), PACK_FRETS(1, 3),
+    PACK_FRETS(1, 2), PACK_FRETS(2, 4), PACK_FRETS(2, 2), PACK_FRETS(1, 4)
+};
+#endif
+
+// The index of the first voicing of each type, one key per line, then the
+// end of the table.
+const uint16_t ChordVoicingOffsets[NUM_KEYS * NUM_CHORD_TYPES + 1] CHORD_PROGMEM =
+{
+    // C
+      0,   3,   5,   7,   9,  12,  14,  16,
+    // C#
+     18,  20,  22,  24,  26,  28,  30,  32,
+    // D
+     34,  37,  40,  42,  44,  47,  49,  51,
+    // Eb
+     53,  55,  57,  59,  61,  63,  65,  67,
+    // E
+     69,  71,  73,  75,  77,  79,  81,  83,
+    // F
+     85,  87,  89,  91,  93,  95,  97,  99,
+    // F#
+    101, 103, 105, 107, 109, 111, 113, 115,
+    // G
+    117, 120, 122, 124, 126, 128, 130, 132,
+    // Ab
+    134, 136, 138, 140, 142, 144, 146, 148,
+    // A
+    150, 153, 156, 158, 160, 162, 164, 166,
+    // Bb
+    168, 170, 172, 174, 176, 178, 180, 182,
+    // B
+    184, 186, 188, 190, 192, 194, 196, 198,
+    // End
+    200
+};
+
+// The difficulty level of each voicing, one key per line.
+const uint8_t ChordDifficulty[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+    // C
+    5, 7, 5, 5, 7, 5, 7, 5, 5, 8, 6, 6, 4, 7, 7, 6, 7, 5,
+    // C#
+    8, 7, 4, 7, 8, 7,
+    5, 7, 6, 6, 7, 7, 6, 7, 7, 5,
+    // D
+    5, 7, 4, 5, 7, 5, 3, 8, 4, 7, 4, 6, 4, 3,
+    7, 4, 7, 4, 7,
+    // Eb
+    8, 7, 8, 6, 7, 8, 7, 7, 7, 6, 7, 7, 7, 7, 5, 7,
+    // E
+    4, 8, 2,
+    8, 4, 6, 3, 7, 5, 7, 4, 7, 1, 7, 4, 7,
+    // F
+    7, 8, 6, 8, 5, 7, 4, 7, 8, 7, 7,
+    7, 6, 7, 3, 7,
+    // F#
+    7, 8, 6, 8, 7, 7, 7, 7, 7, 8, 8, 7, 6, 7, 6, 7,
+    // G
+    4, 7, 4,
+    6, 8, 3, 7, 5, 5, 5, 8, 4, 8, 6, 7, 5, 6,
+    // Ab
+    8, 7, 6, 8, 7, 7, 5, 5, 5, 8,
+    7, 8, 4, 6, 5, 6,
+    // A
+    3, 8, 3, 4, 6, 4, 3, 7, 4, 5, 2, 8, 4, 8, 3, 6, 5, 6,
+    // Bb
+    7, 8, 7, 6, 7, 7, 5, 5, 6, 5, 7, 7, 6, 6, 3, 5,
+    // B
+    7, 8, 7, 6, 4, 7, 4, 5,
+    7, 6, 7, 7, 3, 6, 7, 5
+};
+
+// The voicings sorted by difficulty, easiest first.
+const uint16_t ChordDifficultyOrder[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+     81,  71, 160,  40,  47,  75,  99, 122, 150, 152, 156, 164,
+    182, 196,  12,  20,  36,  42,  44,  46,  49,  51,  69,  73,
+     79,  83,  91, 117, 119, 128, 146, 153, 155, 158, 162, 188,
+    190,   0,   2,   3,   5,   7,   8,  17,  24,  33,  34,  37,
+     39,  67,  77,  89, 124, 125, 126, 132, 140, 141, 142, 148,
+    159, 166, 174, 175, 177, 183, 191, 199,  10,  11,  15,  26,
+     27,  30,  45,  56,  62,  74,  87,  97, 103, 113, 115, 120,
+    130, 133, 136, 147, 149, 154, 165, 167, 171, 176, 180, 181,
+    187, 193, 197,   1,   4,   6,  13,  14,  16,  19,  21,  23,
+     25,  28,  29,  31,  32,  35,  38,  43,  48,  50,  52,  54,
+     57,  59,  60,  61,  63,  64,  65,  66,  68,  76,  78,  80,
+     82,  84,  85,  90,  92,  94,  95,  96,  98, 100, 101, 105,
+    106, 107, 108, 109, 112, 114, 116, 118, 123, 131, 135, 138,
+    139, 144, 157, 168, 170, 172, 173, 178, 179, 184, 186, 189,
+    192, 194, 195, 198,   9,  18,  22,  41,  53,  55,  58,  70,
+     72,  86,  88,  93, 102, 104, 110, 111, 121, 127, 129, 134,
+    137, 143, 145, 151, 161, 163, 169, 185
+};
+
+// The rank in ChordDifficultyOrder[] of the first voicing of each level.
+const uint16_t ChordDifficultyStarts[NUM_DIFFICULTY_LEVELS + 1] CHORD_PROGMEM =
+{
+    0, 1, 3, 14, 37, 68, 99, 172, 200, 200
+};
+
+// The voice leading graph, CHORD_NEIGHBORS voicings of other chords per voicing.
+const uint8_t ChordNeighbors[CHORD_NEIGHBOR_BYTES] CHORD_PROGMEM =
+{
+    0x09, 0x0c, 0xa4, 0x47, 0x04, 0x0d, 0x0a, 0x0f, 0x0b, 0x0c, 0x9b, 0xa4, 0x07, 0x0e, 0x39, 0x8e,
+    0x01, 0x0d, 0x0f, 0x91, 0x99, 0x9e, 0x96, 0x9c, 0x08, 0x9f, 0xa5, 0x11, 0x03, 0x0e, 0x39, 0x90,
+    0x2d, 0x3e, 0x06, 0x11, 0x00, 0x0c, 0x0e, 0x10, 0x0d, 0x0f, 0x01, 0x04, 0x02, 0x0e, 0x9b, 0x0c,
+    0x00, 0x09, 0x47, 0x7a, 0x01, 0x0a, 0x04, 0x0f, 0x03, 0x07, 0x0b, 0x39, 0x0a, 0x04, 0x0d, 0x01,
+    0x7d, 0x09, 0x0c, 0x52, 0x08, 0x34, 0x3c, 0x3e, 0x1c, 0x57, 0x5c, 0x55, 0x15, 0x1d, 0x1b, 0xa3,
+    0x18, 0x1e, 0x49, 0x73, 0x13, 0x1d, 0xa3, 0x1b, 0x18, 0xb4, 0x14, 0x49, 0xaf, 0xb5, 0x21, 0x3e,
+    0x14, 0x73, 0x49, 0x7c, 0x1f, 0x74, 0x0b, 0x1a, 0x1f, 0x8d, 0xae, 0xb1, 0x1d, 0x13, 0x15, 0x46,
+    0x12, 0x57, 0x55, 0x59, 0x13, 0x1b, 0x15, 0x87, 0x14, 0x02, 0x0c, 0x45, 0x19, 0x1a, 0x74, 0x4a,
+    0x8d, 0x62, 0x8b, 0x93, 0xaf, 0x17, 0x83, 0xad, 0x28, 0x2f, 0x25, 0x2c, 0x26, 0x30, 0x40, 0x79,
+    0x27, 0x2e, 0x28, 0x2f, 0x2a, 0x22, 0x59, 0xb2, 0x23, 0x30, 0x83, 0xad, 0x24, 0x2a, 0x2e, 0x31,
+    0x22, 0x2c, 0x2f, 0xc4, 0xc5, 0x85, 0xc1, 0x22, 0x25, 0x59, 0x28, 0x31, 0x32, 0xb3, 0x1a, 0x2d,
+    0x28, 0x2f, 0x33, 0x22, 0x08, 0x32, 0x5a, 0xbf, 0x24, 0x31, 0x5b, 0x8e, 0x22, 0x28, 0x2c, 0x6b,
+    0x23, 0x26, 0x13, 0x56, 0x59, 0x2a, 0x2c, 0x33, 0x2b, 0x2d, 0x5a, 0xb3, 0x2c, 0x28, 0x2f, 0x31,
+    0x9f, 0x11, 0x72, 0x9d, 0x3f, 0x78, 0x0f, 0x76, 0x40, 0x89, 0x23, 0x66, 0x41, 0x69, 0x3b, 0x3d,
+    0xc2, 0x24, 0x6c, 0x95, 0x3b, 0x3d, 0x03, 0x07, 0x0f, 0x0a, 0x95, 0x04, 0x39, 0x41, 0x69, 0x3d,
+    0x42, 0xc3, 0x08, 0x11, 0x39, 0x41, 0x69, 0x3b, 0x08, 0x42, 0x6a, 0xaf, 0x35, 0x78, 0x76, 0x7b,
+    0x36, 0x23, 0x66, 0x79, 0x3b, 0x3d, 0x37, 0x39, 0x3c, 0x3e, 0x6a, 0xc3, 0x41, 0x69, 0x18, 0x3b,
+    0x41, 0x69, 0x3b, 0x3d, 0x47, 0x49, 0x4d, 0x4f, 0x50, 0x88, 0x87, 0x1b, 0x45, 0x4b, 0x51, 0x0c,
+    0x52, 0x4c, 0x4e, 0x54, 0x45, 0x4b, 0x4d, 0xa2, 0x4e, 0x4b, 0xa6, 0x1a, 0x47, 0x49, 0xa0, 0x45,
+    0x52, 0x4a, 0xa6, 0x1a, 0x45, 0x49, 0x47, 0x4b, 0x4a, 0x52, 0x47, 0x4b, 0x45, 0x47, 0x49, 0x4d,
+    0x46, 0x88, 0x87, 0x93, 0x47, 0x7a, 0x45, 0x4b, 0x4c, 0x48, 0x4e, 0x54, 0xbe, 0x45, 0x4f, 0x51,
+    0x52, 0x4c, 0x4e, 0x10, 0x57, 0x5f, 0x1c, 0x59, 0x60, 0x9a, 0xa5, 0xab, 0x1c, 0x55, 0x12, 0x5c,
+    0x62, 0x8b, 0x5e, 0x5a, 0x2a, 0x31, 0x25, 0x2c, 0x5e, 0x2d, 0x32, 0x62, 0x2e, 0x31, 0x8e, 0xb6,
+    0x12, 0x57, 0xb0, 0x1c, 0x25, 0x2a, 0x8c, 0x5c, 0x5a, 0x62, 0x8b, 0x08, 0x55, 0x57, 0x02, 0x0b,
+    0x56, 0x9a, 0xa5, 0x08, 0x57, 0x63, 0x8c, 0x1c, 0x5e, 0x58, 0x5a, 0x8d, 0x59, 0x61, 0x07, 0x2a,
+    0x0e, 0x90, 0x03, 0x05, 0x67, 0x6d, 0x70, 0x2f, 0xab, 0xb5, 0xbb, 0x40, 0x65, 0x2f, 0x6c, 0x6d,
+    0x72, 0x9d, 0x6a, 0x9f, 0x3b, 0x3d, 0x37, 0x39, 0x3e, 0x42, 0x72, 0x9d, 0x2f, 0xc6, 0x22, 0x28,
+    0x67, 0xc1, 0x22, 0x28, 0x65, 0x67, 0x70, 0x74, 0x28, 0x6c, 0x70, 0x71, 0xaa, 0xa8, 0x27, 0x31,
+    0x65, 0x67, 0x6d, 0x71, 0x2f, 0x67, 0x6b, 0x70, 0x68, 0x6a, 0x9f, 0x34, 0x18, 0x14, 0x94, 0x41,
+    0x19, 0x1f, 0x6d, 0x70, 0x7a, 0x80, 0x51, 0x7e, 0x78, 0x7b, 0x3f, 0x35, 0x7a, 0x80, 0x10, 0x51,
+    0x3f, 0x76, 0x35, 0x7b, 0x83, 0xad, 0xaf, 0x11, 0x51, 0x75, 0x7e, 0x80, 0x76, 0x78, 0x3f, 0x2b,
+    0x18, 0x14, 0x43, 0x47, 0x10, 0x52, 0xae, 0xb1, 0x7a, 0x80, 0x84, 0x51, 0x82, 0x0d, 0x20, 0x58,
+    0x75, 0x7a, 0x7e, 0x51, 0xba, 0xb8, 0x24, 0x38, 0x78, 0x10, 0x3f, 0x76, 0x79, 0xaf, 0x11, 0x21,
+    0x7e, 0x7a, 0x80, 0xc4, 0x24, 0x52, 0x77, 0x7d, 0x90, 0x8a, 0x00, 0x03, 0x88, 0x50, 0x46, 0x93,
+    0x50, 0x87, 0x46, 0x93, 0x21, 0x36, 0x79, 0x40, 0x5b, 0x61, 0x86, 0x8e, 0x5e, 0x58, 0x5a, 0x8d,
+    0x4f, 0x61, 0x2a, 0x45, 0x1a, 0x20, 0x62, 0x8b, 0x92, 0x94, 0xbc, 0x03, 0x93, 0x1d, 0x34, 0x68,
+    0x03, 0x07, 0x0e, 0x64, 0x04, 0x01, 0x08, 0x0d, 0x8e, 0x94, 0x03, 0x14, 0x88, 0x20, 0x50, 0x87,
+    0x8e, 0x3b, 0x73, 0x92, 0xb7, 0x0f, 0x38, 0x62, 0x99, 0x9c, 0xa0, 0xa2, 0x19, 0x14, 0x1e, 0x99,
+    0x9b, 0x14, 0x18, 0x9c, 0x05, 0x96, 0x9e, 0xa4, 0x60, 0x56, 0xa5, 0x46, 0x98, 0x02, 0x05, 0x0b,
+    0x96, 0x9e, 0x05, 0x2f, 0x68, 0x6a, 0x9f, 0x34, 0x05, 0x99, 0x9c, 0x2c, 0x34, 0x72, 0x9d, 0x06,
+    0x4b, 0x96, 0xa2, 0xa4, 0xa5, 0x30, 0x79, 0xaf, 0x49, 0x96, 0xa0, 0x14, 0x15, 0x13, 0x1d, 0x72,
+    0x99, 0xa0, 0x00, 0x05, 0x9a, 0x06, 0x08, 0x34, 0x4a, 0x4c, 0xa0, 0x05, 0xc7, 0x08, 0x11, 0x72,
+    0xaa, 0xb2, 0xb0, 0x25, 0xb3, 0x2b, 0xac, 0x32, 0xa8, 0x6f, 0xb2, 0xb4, 0x66, 0xb5, 0x56, 0x17,
+    0x7d, 0x82, 0xa9, 0xae, 0x79, 0xaf, 0x11, 0x21, 0x1a, 0x7d, 0xb1, 0x19, 0x3e, 0x83, 0xad, 0x11,
+    0xb2, 0xb4, 0x5c, 0xa8, 0xb7, 0x1a, 0x7d, 0x8d, 0xa8, 0xb0, 0x25, 0xaa, 0x2b, 0x32, 0xa9, 0xb1,
+    0xb0, 0xaa, 0xb2, 0xb6, 0xab, 0x17, 0xaf, 0x21, 0x59, 0x5b, 0xb4, 0x2a, 0xb1, 0x95, 0x10, 0x19,
+    0xba, 0xc2, 0xc1, 0x38, 0xc3, 0x3c, 0xbd, 0x42, 0xb8, 0x81, 0xc2, 0xc5, 0x66, 0xab, 0x40, 0x36,
+    0x8e, 0x94, 0x03, 0x14, 0x8d, 0x93, 0xb9, 0xbf, 0x53, 0xc4, 0x28, 0x80, 0x1a, 0x2d, 0x8d, 0xb1,
+    0xc4, 0xc6, 0x28, 0x6b, 0xc2, 0xc5, 0x6c, 0xb8, 0xb8, 0xc1, 0x38, 0xba, 0x3c, 0x42, 0xb9, 0x93,
+    0x28, 0xbe, 0xc0, 0x22, 0xc1, 0x22, 0xba, 0xc2, 0x6b, 0xc0, 0x2f, 0xc4, 0xa7, 0x08, 0x20, 0x2b
+};
+
+#if CHORD_REVERSE_INDEX
+// The index in ChordReverseVoicings[] of the first voicing of each slot.
+const uint16_t ChordReverseStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM =
+{
+      0,   2,   3,   6,  12,  14,  17,  19,  22,  25,  28,  30,
+     31,  34,  36,  37,  41,  43,  48,  52,  54,  58,  67,  71,
+     75,  75,  79,  81,  81,  81,  82,  87,  93,  97, 101, 103,
+    104, 107, 112, 117, 118, 121, 125, 126, 131, 135, 137, 142,
+    144, 148, 152, 155, 156, 158, 165, 169, 172, 177, 178, 183,
+    187, 187, 190, 194, 200
+};
+
+// The voicings sorted by the slot of their key.
+const uint16_t ChordReverseVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+     76,  97,  27,  34,  40, 108,  69,  73,  77,  83, 162, 190,
+    123, 183, 127, 144, 167,  68, 181,  12,  16,  39,  28,  87,
+    156, 121, 131, 173, 176, 180,  36,  35,  38,  48,  45, 191,
+    171,  24, 106, 115, 130,  25,  31,  70,  91, 129, 150, 151,
+     72,  82, 140, 142,  17,  22, 101, 112, 161, 179,   0,   5,
+      9,  44,  51, 116, 153, 158, 164,  52, 184, 186, 194,  63,
+    120, 141, 189,  10,  15,  57,  59,  18,  92, 109, 110, 126,
+    132, 149, 165,  30,  60,  66, 107, 192, 198, 102, 138, 163,
+    185, 104, 114, 157, 177,  58,  67, 135,  99, 146, 188,  19,
+     21,  29,  74,  75,  23,  26,  96, 154, 174, 175,  49,  90,
+    113,   7,  14,  53, 134, 111,  55,  61,  65, 105, 199,  20,
+     85,  89, 152, 100, 143,  32,  84, 168, 170, 178,  56, 172,
+     47, 103, 125, 137,   2,  11, 155, 159, 193, 196, 197, 124,
+     54,  64,   8,  62,  95, 148, 160, 166, 187,   3,  93, 128,
+    133,  71,  78, 147,  43,  50,  86, 169, 182, 145,  33,  88,
+     94,  98, 139,  41,  79, 118, 195,   1,   4,  13,   6,  37,
+     42,  46,  80,  81, 117, 119, 122, 136
+};
+#endif
+
+#if CHORD_TRANSPOSE_INDEX
+// The index in ChordTransposeVoicings[] of the first voicing of each slot.
+const uint16_t ChordTransposeStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM =
+{
+      0,   1,   9,  18,  35,  35,  42,  44,  61,  61,  64,  64,
+     65,  65,  70,  73,  79,  79,  80,  80,  81,  82,  82,  84,
+     93,  93,  99,  99,  99, 105, 109, 109, 111, 113, 128, 128,
+    136, 136, 136, 138, 144, 146, 146, 147, 150, 153, 153, 161,
+    161, 165, 170, 170, 179, 179, 179, 179, 182, 189, 195, 196,
+    196, 197, 200, 200, 200
+};
+
+// The voicings sorted by the slot of their key without the starting fret.
+const uint16_t ChordTransposeVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM =
+{
+     49,   7,  14,  25,  31,  43,  50,  60,  66, 111, 129, 134,
+    145, 150, 151, 163, 169, 185,  55,  61,  65,  72,  82,  88,
+     94,  98, 104, 105, 114, 121, 131, 137, 139, 157, 173,  20,
+     85,  89, 101, 112, 118, 135, 100, 116,   1,   4,  13,  19,
+     21,  29,  35,  38,  48,  54,  64, 168, 170, 178, 184, 186,
+    194,   2,  11, 155, 124,  17,  33, 148, 183, 199,  95, 109,
+    123,   3,  93, 110, 127, 143, 161, 182, 159,  79,  74,  75,
+      8,  26,  37,  42,  45,  46,  62, 174, 191,  97, 113, 130,
+    147, 165, 181,  69,  73,  77,  83, 162, 190, 144, 152, 179,
+    195,  68,  84,  39,  56,  28,  47,  63,  80,  87,  96, 103,
+    120, 125, 136, 141, 154, 171, 175, 187,  10,  15,  27, 176,
+    180, 193, 196, 197, 160, 166,  24, 115, 128, 133, 149, 167,
+     71,  78,  91, 140, 142, 177,  22,  41,  58,   0,   5,   9,
+     44,  51, 153, 158, 164,  81, 117, 119, 122,  57,  59,  76,
+     90, 106,  18,  34,  40,  53,  70,  86,  92, 102, 108,  30,
+    126, 132,  12,  16,  32,  52, 107, 192, 198,   6,  23, 138,
+    156, 172, 189,  67,  36,  99, 146, 188
+};
+#endif
+
+// The posting lists.  Strings are numbered high E first.
+const uint8_t ChordPostings[CHORD_POSTING_LISTS * CHORD_POSTING_BYTES] CHORD_PROGMEM =
+{
+    // String 0 on fret 1
+    0x52, 0xa4, 0xac, 0x38, 0xfc, 0x85, 0x63, 0x81, 0x59, 0x00, 0xf1, 0x3a, 0xeb, 0xd0, 0x43, 0xc1,
+    0x97, 0x95, 0x0a, 0x14, 0x2a, 0x1d, 0x75, 0x2d, 0x36,
+    // String 1 on fret 1
+    0xed, 0x4b, 0x82, 0x96, 0x02, 0xf8, 0x0e, 0xda, 0x04, 0x1c, 0xa1, 0x8e, 0xbb, 0x24, 0x53, 0x09,
+    0xc4, 0x45, 0xd9, 0x5f, 0x71, 0x5a, 0xea, 0xaa, 0x88,
+    // String 2 on fret 1
+    0x40, 0x84, 0xd6, 0x59, 0x16, 0x83, 0x20, 0x84, 0x60, 0xa2, 0xc9, 0x18, 0xc3, 0x10, 0x0a, 0x01,
+    0x64, 0x55, 0xfd, 0x15, 0xa4, 0x1a, 0xfb, 0x7a, 0xba,
+    // String 3 on fret 1
+    0xc8, 0x50, 0x83, 0x82, 0x03, 0x08, 0x94, 0x3a, 0x9e, 0xdd, 0x14, 0x65, 0x1e, 0x4f, 0x16, 0xa2,
+    0x4c, 0xfe, 0xdd, 0xb1, 0x63, 0xb2, 0xaa, 0x32, 0xc9,
+    // String 4 on fret 1
+    0x12, 0xa4, 0x6a, 0x29, 0x4a, 0x02, 0xc1, 0x2e, 0x9b, 0x5d, 0x16, 0x45, 0x04, 0x87, 0xac, 0x16,
+    0x2b, 0x0a, 0x32, 0x20, 0x88, 0x25, 0xd5, 0x05, 0xb6,
+    // String 5 on fret 1
+    0x12, 0xa4, 0x6c, 0x38, 0x6c, 0x87, 0x61, 0x84, 0x41, 0x00, 0xe1, 0xb2, 0xfb, 0x70, 0x53, 0x89,
+    0x84, 0x91, 0x08, 0x04, 0x22, 0x0d, 0x75, 0x0d, 0x36,
+    // String 0 on fret 2
+    0x00, 0x01, 0x03, 0x00, 0x03, 0x50, 0x90, 0x08, 0x02, 0x11, 0x0c, 0x01, 0x04, 0x0b, 0xac, 0x22,
+    0x28, 0x6a, 0x34, 0xe0, 0xc0, 0xe0, 0x82, 0xd0, 0xc1,
+    // String 1 on fret 2
+    0x10, 0x80, 0x75, 0x01, 0x55, 0x02, 0x30, 0x24, 0x5a, 0x42, 0x54, 0x40, 0x44, 0x8a, 0x8c, 0x20,
+    0x2a, 0x28, 0x22, 0xa0, 0x8c, 0xa4, 0x10, 0x04, 0x60,
+    // String 2 on fret 2
+    0x20, 0x21, 0x01, 0x22, 0xa1, 0x5c, 0x1b, 0x11, 0x01, 0x00, 0x20, 0xa2, 0x30, 0x68, 0x51, 0xa8,
+    0x90, 0xa0, 0x00, 0xca, 0x02, 0xc0, 0x04, 0x80, 0x45,
+    // String 3 on fret 2
+    0x25, 0x0b, 0x10, 0x45, 0x00, 0x20, 0x00, 0x40, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10,
+    0x20, 0x00, 0x20, 0x4a, 0x94, 0x40, 0x00, 0x80, 0x00,
+    // String 4 on fret 2
+    0x00, 0x10, 0x01, 0x00, 0x01, 0x00, 0x10, 0x00, 0x20, 0xa2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41,
+    // String 5 on fret 2
+    0x00, 0x10, 0x01, 0x00, 0x01, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa0, 0x04,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41,
+    // String 0 on fret 3
+    0xa8, 0x40, 0x00, 0x86, 0x00, 0x28, 0x04, 0x72, 0x04, 0x44, 0x00, 0x44, 0x10, 0x04, 0x10, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
+    // String 1 on fret 3
+    0x02, 0x24, 0x08, 0x28, 0xa8, 0x00, 0x41, 0x01, 0x01, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x06,
+    // String 2 on fret 3
+    0x12, 0x4a, 0x28, 0x84, 0x48, 0x20, 0xc4, 0x6a, 0x16, 0x55, 0x14, 0x45, 0x04, 0x87, 0x04, 0x02,
+    0x0a, 0x0a, 0x02, 0x20, 0x48, 0x25, 0x00, 0x05, 0x00,
+    // String 3 on fret 3
+    0x12, 0xa4, 0x6c, 0x38, 0x48, 0x02, 0x61, 0x85, 0x41, 0x00, 0xe1, 0x90, 0xe1, 0x30, 0x40, 0x09,
+    0x80, 0x01, 0x00, 0x04, 0x00, 0x0d, 0x15, 0x0d, 0x26,
+    // String 4 on fret 3
+    0x45, 0x4a, 0x80, 0x82, 0x00, 0x08, 0x04, 0x10, 0x04, 0x00, 0xa0, 0xb0, 0xb2, 0x70, 0x53, 0x89,
+    0xc4, 0x85, 0x89, 0x04, 0x22, 0x1a, 0x28, 0x2a, 0x08,
+    // String 5 on fret 3
+    0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 0 on fret 4
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+    // String 1 on fret 4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x21, 0x00, 0x41, 0x00, 0x82,
+    0x00, 0x82, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+    // String 2 on fret 4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 3 on fret 4
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    // String 4 on fret 4
+    0x00, 0x00, 0x04, 0x50, 0x00, 0x00, 0x20, 0x80, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 5 on fret 4
+    0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x04, 0x80, 0x00, 0x00, 0x12, 0x00, 0x22, 0x00,
+    // String 0 unplayed
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 1 unplayed
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 2 unplayed
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 3 unplayed
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // String 4 unplayed
+    0x08, 0x01, 0x10, 0x04, 0x90, 0x60, 0x00, 0x41, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x60, 0x04, 0x00, 0x00, 0xc0, 0x02, 0x90, 0x00,
+    // String 5 unplayed
+    0x8c, 0x49, 0x12, 0xc7, 0x92, 0x68, 0x86, 0x7b, 0x0e, 0x11, 0x04, 0x4d, 0x04, 0x87, 0x0c, 0x32,
+    0x2a, 0x6a, 0x37, 0xa9, 0x88, 0xe0, 0x8a, 0x90, 0x88,
+    // Starting fret bit 0
+    0xff, 0xee, 0x56, 0x51, 0xe9, 0x7c, 0xaf, 0xae, 0x3a, 0xa2, 0xe8, 0xff, 0x1f, 0x8a, 0x48, 0xdb,
+    0x5c, 0x7c, 0x37, 0x4e, 0x36, 0xb7, 0xdf, 0xd8, 0x41,
+    // Starting fret bit 1
+    0x12, 0xb4, 0x81, 0x86, 0x17, 0xab, 0x64, 0x85, 0x81, 0x5d, 0x16, 0x45, 0xe4, 0x70, 0xf3, 0xad,
+    0x27, 0x2a, 0xe2, 0x11, 0x41, 0x5a, 0xaa, 0x8d, 0x36,
+    // Starting fret bit 2
+    0x40, 0x01, 0xaa, 0x28, 0x4a, 0x00, 0x51, 0x50, 0x45, 0x00, 0x41, 0x00, 0x41, 0x05, 0x04, 0x02,
+    0x88, 0x83, 0x08, 0xa4, 0xaa, 0xa8, 0x20, 0x2a, 0x88,
+    // Starting fret bit 3
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+#endif
+#endif // !CHORD_EXTERNAL_STORE
+
+#undef X
@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordTable.h
+//
+// Defines the sizes of the generated chord tables.
+//
+// THIS FILE IS GENERATED by ChordTableCompiler from ChordTable.txt.  Do not
+// edit it by hand.  Edit ChordTable.txt and re-run the compiler instead.
+//
+// Copyright (C) 2015-2016 Joseph M. Corbett
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDTABLE_H
+#define CHORDTABLE_H
+
+#include <avr/pgmspace.h>       // For uintXX_t.
+#include "ChordTableConfig.h"    // For FULL_CHORD_LIBRARY and CHORD_PROGMEM.
+
+
+#if FULL_CHORD_LIBRARY
+
+// The full chord library.  Each key and type has its own number of
+// variations (see ChordChartData::GetNumVariations()).
+const unsigned NUM_COMMON_CHORDS           = 8;
+const unsigned NUM_SUPP_CHORDS             = 28;
+const unsigned NUM_KEYS                    = 12;
+const unsigned NUM_CHORD_TYPES             = 36;
+
+// The most variations of any key and type, and voicings in the whole table.
+const unsigned MAX_CHORD_VARIATIONS        = 3;
+const unsigned NUM_CHORD_VOICINGS          = 872;
+
+// Unique shapes in the shape dictionary, and bytes in the delta stream.
+const unsigned NUM_CHORD_SHAPES            = 152;
+const unsigned CHORD_STREAM_SIZE           = 2071;
+
+// Bits per voicing index in the voice leading graph, and its size.
+const unsigned CHORD_NEIGHBOR_BITS         = 10;
+const unsigned CHORD_NEIGHBOR_BYTES        = 4360;
+
+// The reverse and transposition indexes have 2^CHORD_REVERSE_SLOT_BITS slots.
+const unsigned CHORD_REVERSE_SLOT_BITS     = 9;
+
+// Bytes of FLASH used by the chord tables with the indexes every build has,
+// and by each index ChordTableConfig.h can leave out.
+#if CHORD_DELTA_STREAM
+const uint32_t CHORD_BASE_BYTES            = 13749;
+#else
+const uint32_t CHORD_BASE_BYTES            = 13332;
+#endif
+const uint32_t CHORD_REVERSE_INDEX_BYTES   = 2770;
+const uint32_t CHORD_TRANSPOSE_INDEX_BYTES = 2770;
+
+#else
+
+// The reduced chord library.  Each key and type has its own number of
+// variations (see ChordChartData::GetNumVariations()).
+const unsigned NUM_COMMON_CHORDS           = 8;
+const unsigned NUM_SUPP_CHORDS             = 0;
+const unsigned NUM_KEYS                    = 12;
+const unsigned NUM_CHORD_TYPES             = 8;
+
+// The most variations of any key and type, and voicings in the whole table.
+const unsigned MAX_CHORD_VARIATIONS        = 3;
+const unsigned NUM_CHORD_VOICINGS          = 200;
+
+// Unique shapes in the shape dictionary, and bytes in the delta stream.
+const unsigned NUM_CHORD_SHAPES            = 97;
+const unsigned CHORD_STREAM_SIZE           = 492;
+
+// Bits per voicing index in the voice leading graph, and its size.
+const unsigned CHORD_NEIGHBOR_BITS         = 8;
+const unsigned CHORD_NEIGHBOR_BYTES        = 800;
+
+// The reverse and transposition indexes have 2^CHORD_REVERSE_SLOT_BITS slots.
+const unsigned CHORD_REVERSE_SLOT_BITS     = 6;
+
+// Bytes of FLASH used by the chord tables with the indexes every build has,
+// and by each index ChordTableConfig.h can leave out.
+#if CHORD_DELTA_STREAM
+const uint32_t CHORD_BASE_BYTES            = 2982;
+#else
+const uint32_t CHORD_BASE_BYTES            = 3055;
+#endif
+const uint32_t CHORD_REVERSE_INDEX_BYTES   = 530;
+const uint32_t CHORD_TRANSPOSE_INDEX_BYTES = 530;
+
+#endif
+
+// Bytes of FLASH used by the chord tables in this build.
+const uint32_t CHORD_TABLE_BYTES           = CHORD_BASE_BYTES +
+    (CHORD_REVERSE_INDEX ? CHORD_REVERSE_INDEX_BYTES : 0) +
+    (CHORD_TRANSPOSE_INDEX ? CHORD_TRANSPOSE_INDEX_BYTES : 0);
+
+const unsigned CHORD_TABLE_STRINGS         = 6;   // Strings per voicing.
+const unsigned CHORD_SHAPE_SIZE            = 3;   // Bytes per shape.
+const unsigned CHORD_KEYFRAME_INTERVAL     = 16;  // Voicings per keyframe.
+const unsigned NUM_DIFFICULTY_LEVELS       = 9;   // Easiest is 1.
+const unsigned CHORD_NEIGHBORS             = 4;   // Neighbors per voicing.
+const unsigned CHORD_FRET_BITS             = 4;   // Bits per starting fret.
+
+// The posting lists: one per string on each fret of a pattern, then one per
+// string unplayed, then one per bit of the starting fret, each a bit per
+// voicing.
+const unsigned CHORD_POSTING_LISTS         = 34;
+const unsigned CHORD_POSTING_BYTES         = (NUM_CHORD_VOICINGS + 7) / 8;
+
+// The tables are only in PROGMEM when they aren't read from the external
+// store (see ChordStore.h).
+#if !CHORD_EXTERNAL_STORE
+
+#if CHORD_DELTA_STREAM
+// The voicings as a delta encoded stream (see ChordStream.h), and the byte
+// offset of each keyframe in it.
+extern const uint8_t  ChordStream[CHORD_STREAM_SIZE] CHORD_PROGMEM;
+extern const uint16_t ChordStreamKeyframes[(NUM_CHORD_VOICINGS + CHORD_KEYFRAME_INTERVAL - 1) /
+                                           CHORD_KEYFRAME_INTERVAL] CHORD_PROGMEM;
+#else
+// The packed shapes (see PackedShape in ChordChartData.h), the shape id of
+// each voicing, and the starting fret of each voicing (two per byte).
+extern const uint8_t ChordShapes[NUM_CHORD_SHAPES * CHORD_SHAPE_SIZE] CHORD_PROGMEM;
+extern const uint8_t ChordShapeIds[NUM_CHORD_VOICINGS] CHORD_PROGMEM;
+extern const uint8_t ChordFrets[(NUM_CHORD_VOICINGS + 1) / 2] CHORD_PROGMEM;
+#endif
+
+// The index of the first voicing of each key and type, so finding a voicing
+// is a single table read.  The extra last entry is NUM_CHORD_VOICINGS, so
+// the difference of two adjacent entries is a variation count.
+extern const uint16_t ChordVoicingOffsets[NUM_KEYS * NUM_CHORD_TYPES + 1] CHORD_PROGMEM;
+
+// The difficulty level of each voicing, the voicings sorted easiest first,
+// and the rank in that order where each level starts (the extra last entry
+// is NUM_CHORD_VOICINGS).
+extern const uint8_t  ChordDifficulty[NUM_CHORD_VOICINGS] CHORD_PROGMEM;
+extern const uint16_t ChordDifficultyOrder[NUM_CHORD_VOICINGS] CHORD_PROGMEM;
+extern const uint16_t ChordDifficultyStarts[NUM_DIFFICULTY_LEVELS + 1] CHORD_PROGMEM;
+
+// The voice leading graph: the CHORD_NEIGHBORS voicings of other chords
+// nearest each voicing, nearest first, as CHORD_NEIGHBOR_BITS bit voicing
+// indexes packed least significant bit first.
+extern const uint8_t  ChordNeighbors[CHORD_NEIGHBOR_BYTES] CHORD_PROGMEM;
+
+// The reverse index: the voicings sorted by the hash slot of their key (see
+// ReverseChordFinderMode::GetIndexKey()), and the index of the first voicing
+// of each slot (the extra last entry is NUM_CHORD_VOICINGS).
+#if CHORD_REVERSE_INDEX
+extern const uint16_t ChordReverseStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM;
+extern const uint16_t ChordReverseVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM;
+#endif
+
+// The transposition index: the same, with the starting fret left out of the
+// key, so a slot holds every transposition of a shape.
+#if CHORD_TRANSPOSE_INDEX
+extern const uint16_t ChordTransposeStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM;
+extern const uint16_t ChordTransposeVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM;
+#endif
+
+// The posting lists, one after the other.  Bit n % 8 of byte n / 8 of a list
+// is voicing n.
+extern const uint8_t  ChordPostings[CHORD_POSTING_LISTS * CHORD_POSTING_BYTES] CHORD_PROGMEM;
+
+#endif // !CHORD_EXTERNAL_STORE
+
+
+#endif // CHORDTABLE_H
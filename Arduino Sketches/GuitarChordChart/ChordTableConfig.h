@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordTableConfig.h
+//
+// Selects the chord library built into the sketch, and where in FLASH the
+// chord table is stored.  Defines the macros used to read the chord table.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDTABLECONFIG_H
+#define CHORDTABLECONFIG_H
+
+#include <avr/pgmspace.h>       // For PROGMEM and pgm_read_xxx().
+
+
+// Boards with more than 64 KB of FLASH (ATmega1280, ATmega2560) keep the chord
+// table above the near PROGMEM limit and read it with far pointers.
+#if defined(FLASHEND) && (FLASHEND > 0xffff)
+#define CHORD_FAR_PROGMEM 1
+#else
+#define CHORD_FAR_PROGMEM 0
+#endif
+
+// Define CHORD_EXTERNAL_STORE as 1 to read the chord table from an external SPI
+// FLASH chip (see ChordStore.h) instead of PROGMEM.  This is meant for the
+// ATmega2560: on the ATmega328 the hardware SPI pins are used by the string
+// LEDs.
+#if !defined CHORD_EXTERNAL_STORE
+#define CHORD_EXTERNAL_STORE 0
+#endif
+
+// Define CHORD_DELTA_STREAM as 1 to store the voicings as a delta encoded
+// stream (see ChordStream.h) instead of the shape dictionary.  The stream is
+// smaller for large chord libraries with many unique shapes, and
+// ChordTableCompiler reports both sizes.  It is read from PROGMEM only.
+#if !defined CHORD_DELTA_STREAM
+#define CHORD_DELTA_STREAM 0
+#endif
+#if CHORD_DELTA_STREAM && CHORD_EXTERNAL_STORE
+#error "The delta encoded chord stream can't be read from the external store."
+#endif
+
+// Chip select pin of the external SPI FLASH (the ATmega2560's SS pin).
+#if !defined CHORD_STORE_CS_PIN
+#define CHORD_STORE_CS_PIN 53
+#endif
+
+// The full library has all 36 chord types.  The reduced library has only the
+// 8 common types.  The full library is built by default on boards with far
+// FLASH, or with an external store.  Define FULL_CHORD_LIBRARY as 0 or 1 to
+// override this.
+#if !defined FULL_CHORD_LIBRARY
+#define FULL_CHORD_LIBRARY (CHORD_FAR_PROGMEM || CHORD_EXTERNAL_STORE)
+#endif
+
+// The reverse chord finder's indexes, which ChordTableCompiler generates
+// beside the chord table.  Each one replaces a pass through the whole table
+// with a lookup, at the cost of FLASH (the compiler reports the size of each).
+// Define a switch as 0 to leave its index out, and searches scan the table
+// instead.  The full library has room for both.  The reduced library is for
+// the ATmega328, so it leaves them out and scans its few chords instead.  The
+// other indexes are in every build.
+//
+// CHORD_REVERSE_INDEX    - ChordReverseStarts[] and ChordReverseVoicings[],
+//                          for reverse chord searches on a starting fret.
+#if !defined CHORD_REVERSE_INDEX
+#define CHORD_REVERSE_INDEX FULL_CHORD_LIBRARY
+#endif
+
+// CHORD_TRANSPOSE_INDEX  - ChordTransposeStarts[] and ChordTransposeVoicings[],
+//                          for reverse chord searches on any starting fret.
+#if !defined CHORD_TRANSPOSE_INDEX
+#define CHORD_TRANSPOSE_INDEX FULL_CHORD_LIBRARY
+#endif
+
+#if CHORD_FAR_PROGMEM
+// The .fini7 section follows the program code, so the chord table doesn't use
+// the near FLASH that PROGMEM strings must live in.
+#define CHORD_PROGMEM   __attribute__((__section__(".fini7")))
+#define CHORD_READ_BYTE(table, index)                                             \
+    pgm_read_byte_far(pgm_get_far_address(table) + (index))
+#define CHORD_READ_WORD(table, index)                                             \
+    pgm_read_word_far(pgm_get_far_address(table) + (index) * sizeof(uint16_t))
+#else
+#define CHORD_PROGMEM   PROGMEM
+#define CHORD_READ_BYTE(table, index)   pgm_read_byte(&(table)[index])
+#define CHORD_READ_WORD(table, index)   pgm_read_word(&(table)[index])
+#endif
+
+// FLASH kept free for the program.  The chord table may use the rest.  This is
+// checked when ChordChartData.cpp is compiled, unless the table is in the
+// external store.
+const uint32_t PROGRAM_FLASH_RESERVE = 24UL * 1024;
+
+
+#endif // CHORDTABLECONFIG_H
@@ -340,14 +340,9 @@ void DemoMode::ExecuteRandomChord(unsigned)
     if (pInstance->m_Delay.IsExpired())
     {
         // Select a random key, type, and variation.
-        unsigned key           = random(NUM_KEYS);
-        unsigned type          = random(TOTAL_CHORDS_PER_KEY);
-        unsigned numVariations = NUM_COMMON_CHORD_VARIATIONS;
-        if (type >= NUM_COMMON_CHORDS)
-        {
-            numVariations = NUM_SUPP_CHORD_VARIATIONS;
-        }
-        unsigned variation = random(numVariations);
+        unsigned key       = random(NUM_KEYS);
+        unsigned type      = random(TOTAL_CHORDS_PER_KEY);
+        unsigned variation = random(pInstance->m_ChordData.GetNumKeyVariations(key, type));
         
         // Get the selected random chord.
         pInstance->m_ChordData.GetChord(key, type, variation);
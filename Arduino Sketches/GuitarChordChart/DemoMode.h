@@ -65,6 +65,8 @@ public:
     virtual void     Shutdown() { }
     unsigned         GetDisplayOption() const       { return m_DisplayOption; }
     void             SetDisplayOption(unsigned val) { m_DisplayOption = val; }
+    void             SetTuning(unsigned tuning)     { m_ChordData.SetTuning(tuning); }
+    void             SetCapo(unsigned capo)         { m_ChordData.SetCapo(capo); }
     void             NextState();
     
     static void StartupAllOn();
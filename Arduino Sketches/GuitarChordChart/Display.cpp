@@ -32,6 +32,21 @@
 #include "Strings.h"        // For strings displayed on the LCD.
 
 
+// Bit patterns of strings in the reverse string order, indexed by a bit pattern
+// of strings.  Mirrors a chord for a left-handed fingerboard.
+static const uint8_t MirroredStrings[Instrument::ALL_STRINGS + 1] PROGMEM =
+{
+    0x00, 0x20, 0x10, 0x30, 0x08, 0x28, 0x18, 0x38,
+    0x04, 0x24, 0x14, 0x34, 0x0c, 0x2c, 0x1c, 0x3c,
+    0x02, 0x22, 0x12, 0x32, 0x0a, 0x2a, 0x1a, 0x3a,
+    0x06, 0x26, 0x16, 0x36, 0x0e, 0x2e, 0x1e, 0x3e,
+    0x01, 0x21, 0x11, 0x31, 0x09, 0x29, 0x19, 0x39,
+    0x05, 0x25, 0x15, 0x35, 0x0d, 0x2d, 0x1d, 0x3d,
+    0x03, 0x23, 0x13, 0x33, 0x0b, 0x2b, 0x1b, 0x3b,
+    0x07, 0x27, 0x17, 0x37, 0x0f, 0x2f, 0x1f, 0x3f
+};
+
+
 // Return our singleton instance.
 Display *Display::Instance()
 {
@@ -46,12 +61,19 @@ void Display::Initialize(uint8_t *pLedArray, LiquidCrystal *pLcd)
     m_pLcd           = pLcd;
     m_Verbose        = true;
     m_UnplayedOption = LIGHT_LAST_FRET_UNUSED;
+    m_LeftHanded     = false;
+}
+
+// Return the mirror image of a bit pattern of strings.
+uint8_t Display::MirrorStrings(uint8_t strings)
+{
+    return pgm_read_byte(&MirroredStrings[strings & Instrument::ALL_STRINGS]);
 }
 
 // Function to set all LEDs to the same state (off if state is 0, on otherwise).
 void Display::SetAllLeds(bool state)
 {
-    uint8_t fretValue = state ? 0x3f : 0;
+    uint8_t fretValue = state ? Instrument::ALL_STRINGS : 0;
     for (uint8_t fret = 0; fret < LedDriver::NUM_FRETS; fret++)
     {
         m_pLedArray[fret] = fretValue;
@@ -102,16 +124,126 @@ void Display::PowerupDisplay()
 }
 
 // Display a specified chord on the LCD and on the fingerboard.
-// pData - A pointer to the ChordData to be displayed.
+// pData         - A pointer to the ChordData to be displayed.
+// maxDifficulty - The difficulty filter, when browsing by difficulty, or 0.
 // A run time option is available to select how non-played strings
 // strings will be handled.
-void Display::DisplayChord(ChordChartData *pData)
+void Display::DisplayChord(ChordChartData *pData, unsigned maxDifficulty)
 {
     // Display the chord's data:
     // --------------------------            --------------------
     // | Key   Variation   Fret |  Example:  | Bb  V:4  Fret:10 |
     // | Type                   |            | Sixth            |
     // --------------------------            --------------------
+    // When browsing by difficulty, the short type is followed by the chord's
+    // difficulty and the filter:                | m6         D:3/5 |
+    // With a capo, the key is the one heard and the fret is counted from the
+    // nut, while the LEDs show the shape fingered behind the capo.
+    char buf[17];
+    DisplayChordHeading(pData);
+    m_pLcd->setCursor(0, 1);
+    if (m_Verbose && (maxDifficulty == 0))
+    {
+        m_pLcd->print(Strings::GetLongTypeString(pData->GetCurrentType(), buf));
+    }
+    else
+    {
+        m_pLcd->print(Strings::GetShortTypeString(pData->GetCurrentType(), buf));
+    }
+    if (maxDifficulty != 0)
+    {
+        m_pLcd->setCursor(11, 1);
+        m_pLcd->print(F("D:"));
+        m_pLcd->print(pData->GetCurrentDifficulty());
+        m_pLcd->print('/');
+        m_pLcd->print(maxDifficulty);
+    }
+    
+    // Display the chord pattern on the fingerboard.
+    DisplayLeds(pData->GetChordView());
+}    
+
+// Display a chord ranked by how near it is to a pattern, with its rank (1 is
+// the nearest) and the number of LEDs that differ from the pattern:
+// --------------------------            --------------------
+// | Key   Variation   Fret |  Example:  | Bb  V:4  Fret:10 |
+// | Type   Rank   Distance |            | m6     #2 Off:1  |
+// --------------------------            --------------------
+// pData    - A pointer to the ChordData to be displayed.
+// rank     - Rank of the chord, from 1.
+// distance - LEDs that differ.
+void Display::DisplayRankedChord(ChordChartData *pData, unsigned rank, unsigned distance)
+{
+    char buf[17];
+    DisplayChordHeading(pData);
+    m_pLcd->setCursor(0, 1);
+    m_pLcd->print(Strings::GetShortTypeString(pData->GetCurrentType(), buf));
+    m_pLcd->setCursor(7, 1);
+    m_pLcd->print('#');
+    m_pLcd->print(rank);
+    m_pLcd->print(F(" Off:"));
+    m_pLcd->print(distance);
+    
+    // Display the chord pattern on the fingerboard.
+    DisplayLeds(pData->GetChordView());
+}
+
+// Display one of the chords found by a search, numbered in the order found,
+// with the number found.  A '+' shows that more were found than were kept:
+// --------------------------            --------------------
+// | Key   Variation   Fret |  Example:  | A   V:2  Fret:5  |
+// | Type   Number of Count |            | m7     3 of 5    |
+// --------------------------            --------------------
+// pData  - A pointer to the ChordData to be displayed.
+// number - Number of the chord, from 1.
+// count  - Chords found.
+// more   - True if more chords matched than count.
+void Display::DisplayFoundChord(ChordChartData *pData, unsigned number, unsigned count, bool more)
+{
+    char buf[17];
+    DisplayChordHeading(pData);
+    m_pLcd->setCursor(0, 1);
+    m_pLcd->print(Strings::GetShortTypeString(pData->GetCurrentType(), buf));
+    m_pLcd->setCursor(7, 1);
+    m_pLcd->print(number);
+    m_pLcd->print(F(" of "));
+    m_pLcd->print(count);
+    if (more)
+    {
+        m_pLcd->print('+');
+    }
+    
+    // Display the chord pattern on the fingerboard.
+    DisplayLeds(pData->GetChordView());
+}
+
+// Display, on the second line only, how many chords fit the pattern being
+// entered, and the first of them, the one a search would find:
+// --------------------------            --------------------
+// |                        |  Example:  | Base Fret: ANY   |
+// | Count fit KeyType      |            | 14 fit Am7       |
+// --------------------------            --------------------
+// count  - Chords that fit.
+// pFirst - A pointer to the ChordData holding the first, or NULL if none fit.
+void Display::DisplayCandidates(unsigned count, ChordChartData *pFirst)
+{
+    char buf[17];
+    DispLcdProgmem(F("                "), false, 1, 0);
+    m_pLcd->setCursor(0, 1);
+    m_pLcd->print(count);
+    m_pLcd->print(F(" fit"));
+    if (pFirst != NULL)
+    {
+        m_pLcd->print(' ');
+        m_pLcd->print(Strings::GetKeyString(pFirst->GetCurrentKey(), buf));
+        m_pLcd->print(Strings::GetShortTypeString(pFirst->GetCurrentType(), buf));
+    }
+}
+
+// Clear the LCD and display the first line of a chord's data: its key,
+// variation and fret.
+void Display::DisplayChordHeading(ChordChartData *pData)
+{
     char buf[17];
     m_pLcd->clear();
     m_pLcd->print(Strings::GetKeyString(pData->GetCurrentKey(), buf));
@@ -119,30 +251,75 @@ void Display::DisplayChord(ChordChartData *pData)
     m_pLcd->print(F("V:"));
     m_pLcd->print(pData->GetCurrentVariation() + 1);
     m_pLcd->print(F("  Fret:"));
-    m_pLcd->print(pData->GetCurrentFret());
+    m_pLcd->print(pData->GetCurrentFret() + pData->GetCapo());
+}
+
+// Display the name of a chord that was worked out from its notes rather than
+// found in the chord table, so it has no variation:
+// --------------------------            --------------------
+// | Key/Bass          Fret |  Example:  | Am/G     Fret:5  |
+// | Type                   |            | Minor            |
+// --------------------------            --------------------
+// The bass is only shown when it isn't the key.  The fingerboard is left
+// as it is.
+// key  - Pitch class of the root (C = 0).
+// type - ChordType.
+// bass - Pitch class of the lowest note.
+// fret - Fret of the chord, counted from the nut.
+void Display::DisplayNamedChord(uint8_t key, uint8_t type, uint8_t bass, unsigned fret)
+{
+    char buf[17];
+    m_pLcd->clear();
+    m_pLcd->print(Strings::GetKeyString(key, buf));
+    if (bass != key)
+    {
+        m_pLcd->print('/');
+        m_pLcd->print(Strings::GetKeyString(bass, buf));
+    }
+    m_pLcd->setCursor(9, 0);
+    m_pLcd->print(F("Fret:"));
+    m_pLcd->print(fret);
     m_pLcd->setCursor(0, 1);
     if (m_Verbose)
     {
-        m_pLcd->print(Strings::GetLongTypeString(pData->GetCurrentType(), buf));
+        m_pLcd->print(Strings::GetLongTypeString(type, buf));
     }
     else
     {
-        m_pLcd->print(Strings::GetShortTypeString(pData->GetCurrentType(), buf));
+        m_pLcd->print(Strings::GetShortTypeString(type, buf));
     }
-    
-    // Display the chord pattern on the fingerboard.
-    DisplayLeds(pData->GetChordPtr());
-}    
+}
 
-// Display a specified chord on the LCD and on the fingerboard.
-// pData - A pointer to the ChordData to be displayed.
-// A compile time option is available to select how non-played strings
-// strings will be handled.
+// Display a specified chord pattern on the fingerboard.
+// pChord - A pointer to the chord pattern to be displayed.
 void Display::DisplayLeds(Chord *pChord)
 {
-    Chord chord;
-    memcpy(&chord, pChord, sizeof(Chord));
-    
+    uint8_t pattern[LedDriver::NUM_FRETS];
+    memcpy(pattern, pChord->GetPatternPtr(), LedDriver::NUM_FRETS);
+    ShowLeds(pattern, pChord->GetUnplayed());
+}    
+
+// Display a specified chord from FLASH on the fingerboard.  The fret patterns
+// are read straight from FLASH.
+// rView - The chord to be displayed.
+void Display::DisplayLeds(const ChordView &rView)
+{
+    uint8_t pattern[LedDriver::NUM_FRETS];
+    for (uint8_t i = 0; i < LedDriver::NUM_FRETS; i++)
+    {
+        pattern[i] = rView.GetFretPattern(i);
+    }
+    ShowLeds(pattern, rView.GetUnplayed());
+}    
+
+// Mark the unplayed strings of a chord pattern and display it on the
+// fingerboard.  A run time option is available to select how non-played
+// strings will be handled, and the pattern is mirrored if the fingerboard is
+// set up for a left-handed player.
+// pPattern - The chord pattern.  This is modified.
+// unplayed - Bit pattern of the unplayed strings.
+void Display::ShowLeds(uint8_t *pPattern, uint8_t unplayed)
+{
     // Determine how to handle non-played strings.
     switch (m_UnplayedOption)
     {
@@ -150,18 +327,18 @@ void Display::DisplayLeds(Chord *pChord)
     case LIGHT_ALL_FRETS:  
         for (unsigned i = 0; i < LedDriver::NUM_FRETS; i++)
         {
-            chord.GetPatternPtr()[i] |= chord.GetUnplayed();
+            pPattern[i] |= unplayed;
         }
         break;
         
     // Option: Set the strings of the last (unused) fret for non-played strings.
     case LIGHT_LAST_FRET_UNUSED:
-        chord.GetPatternPtr()[LedDriver::NUM_FRETS - 1] |= chord.GetUnplayed();;
+        pPattern[LedDriver::NUM_FRETS - 1] |= unplayed;
         break;
 
     // Option: Set the strings of the last (unused) fret for played strings.
     case LIGHT_LAST_FRET_USED:
-        chord.GetPatternPtr()[LedDriver::NUM_FRETS - 1] |= ~chord.GetUnplayed();
+        pPattern[LedDriver::NUM_FRETS - 1] |= ~unplayed;
         break;
         
     // Option: Do nothing
@@ -170,8 +347,17 @@ void Display::DisplayLeds(Chord *pChord)
         break;
     }
 
+    // Mirror the chord pattern for a left-handed fingerboard.
+    if (m_LeftHanded)
+    {
+        for (unsigned i = 0; i < LedDriver::NUM_FRETS; i++)
+        {
+            pPattern[i] = MirrorStrings(pPattern[i]);
+        }
+    }
+
     // Display the chord pattern on the fingerboard.
-    memcpy(m_pLedArray, chord.GetPatternPtr(), LedDriver::NUM_FRETS);
+    memcpy(m_pLedArray, pPattern, LedDriver::NUM_FRETS);
 }    
 
 // Display a string from FLASH (PROGMEM).
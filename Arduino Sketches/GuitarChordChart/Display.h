@@ -42,7 +42,11 @@ public:
     void     Initialize(uint8_t *pLedArray, LiquidCrystal *pLcd);
     
     void     SetAllLeds(bool state);
-    void     DisplayChord(ChordChartData *pData);
+    void     DisplayChord(ChordChartData *pData, unsigned maxDifficulty = 0);
+    void     DisplayNamedChord(uint8_t key, uint8_t type, uint8_t bass, unsigned fret);
+    void     DisplayRankedChord(ChordChartData *pData, unsigned rank, unsigned distance);
+    void     DisplayCandidates(unsigned count, ChordChartData *pFirst);
+    void     DisplayFoundChord(ChordChartData *pData, unsigned number, unsigned count, bool more);
     void     PowerupDisplay();
     void     DispLcdProgmem(
                   const __FlashStringHelper *pStr, bool clear = true, unsigned row = 0, unsigned col = 0);    
@@ -52,10 +56,13 @@ public:
                   uint32_t val, bool clear = true, unsigned row = 0, unsigned col = 0);
     void     DispLcdIntHex(uint32_t val, bool clear, unsigned row, unsigned col);
     void     DisplayLeds(Chord *pChord);
+    void     DisplayLeds(const ChordView &rView);
     bool     GetVerbose() const              { return m_Verbose; }
     void     SetVerbose(bool val)            { m_Verbose = val; }
     unsigned GetUnplayedOption() const       { return m_UnplayedOption; }
     void     SetUnplayedOption(unsigned val) { m_UnplayedOption = val; }
+    bool     GetLeftHanded() const           { return m_LeftHanded; }
+    void     SetLeftHanded(bool val)         { m_LeftHanded = val; }
     uint8_t  *GetLedArrayPtr()               { return m_pLedArray; }
         
     // Unplayed option values.
@@ -66,13 +73,17 @@ public:
     static const unsigned FIRST_UNPLAYED_OPTION  = LIGHT_ALL_FRETS;
     static const unsigned NUM_UNPLAYED_OPTIONS   = IGNORE + 1;                                         
 
+    // Return a bit pattern of strings in the reverse string order, as seen on
+    // a fingerboard mirrored for a left-handed player.
+    static uint8_t MirrorStrings(uint8_t strings);
+
 
 protected:
     
 private:
     Display() :
         m_pLedArray(NULL), m_pLcd(NULL),
-        m_Verbose(true), m_UnplayedOption(LIGHT_LAST_FRET_UNUSED)
+        m_Verbose(true), m_UnplayedOption(LIGHT_LAST_FRET_UNUSED), m_LeftHanded(false)
         { }
     ~Display() { }
     
@@ -80,11 +91,14 @@ private:
     Display(Display &rMgr);
     Display &operator=(Display &rMgr);
 
+    void     ShowLeds(uint8_t *pPattern, uint8_t unplayed);
+    void     DisplayChordHeading(ChordChartData *pData);
     
     uint8_t       *m_pLedArray;
     LiquidCrystal *m_pLcd;
     bool           m_Verbose;
     unsigned       m_UnplayedOption;
+    bool           m_LeftHanded;
 };
 
 
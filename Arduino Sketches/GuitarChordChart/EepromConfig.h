@@ -41,6 +41,9 @@ struct AppConfig
     unsigned m_DemoDisplayOption;        // Demo display option.
     bool     m_IrCodeDispPermission;     // Allow IR code display mode or not.
     unsigned m_Brightness;               // Startup LED brightness.
+    unsigned m_Tuning;                   // Guitar tuning (TuningType).
+    unsigned m_Capo;                     // Capo fret, 0 for none.
+    bool     m_LeftHanded;               // Mirror the fingerboard (true/false).
 };
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -65,7 +68,7 @@ public:
     // !!!NOTE!!! Increment this value any time the AppConfig structure is 
     // !!!!!!!!!! changed (member added, size of member changed, etc).
     /////////////////////////////////////////////////////////////////////////////
-    static const unsigned THIS_VERSION = 1;
+    static const unsigned THIS_VERSION = 2;
     
     // This constant identifies the application.  It should never change.
     static const unsigned THIS_ID      = 0xC04D;
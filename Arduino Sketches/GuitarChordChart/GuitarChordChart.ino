@@ -39,6 +39,7 @@
 #include "EepromConfig.h"           // For EepromConfig class.
 #include "DemoMode.h"               // For DemoMode class.
 #include "SettingsMode.h"           // For SettingsMode class.
+#include "ChordStore.h"             // For ChordStore class.
 
 
 // IR key decode values.
@@ -69,7 +70,6 @@ void setup()
 {
     // Cache pointers to class instances we'll use in this function.
     Display     *pDisplay     = Display::Instance();
-    ModeManager *pModeManager = ModeManager::Instance();
     
     // Initialize the fingerboard (LED) driver.
     LedDriver::Initialize(gFrets, gStrings, gPattern, 1);
@@ -92,7 +92,20 @@ void setup()
     pDisplay->PowerupDisplay();
     pDisplay->SetAllLeds(false);
     
-    // Initialize the mode manager.
+    // Mount the chord table.  Without it there is nothing to show, so stop
+    // here if it's missing.
+    if (!ChordStore::Mount())
+    {
+        gLcd.clear();
+        gLcd.print(F("No chord table"));
+        while (1)
+        {
+        }
+    }
+    
+    // Initialize the mode manager.  Its modes fetch their first chord when
+    // they are built, so it isn't built until the chord table is mounted.
+    ModeManager *pModeManager = ModeManager::Instance();
     pModeManager->Initialize();
     
     // Make sure DemoMode is initialized by calling its Instance() method.
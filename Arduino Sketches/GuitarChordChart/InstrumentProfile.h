@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////////////////////////////////////
+// InstrumentProfile.h
+//
+// Defines the Instrument class, which fixes the number of strings and frets
+// of the guitar the sketch is built for.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined INSTRUMENTPROFILE_H
+#define INSTRUMENTPROFILE_H
+
+#include <stdint.h>                 // For uintxx_t.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// Instrument class.  The one definition of the string and fret counts of the
+// 6 string guitar the sketch is built for.  The chord data, LED driver,
+// display and reverse chord finder all take their counts and string masks
+// from here, so they are compile time constants in every build.  Bit n of a
+// string mask is string n, with the highest pitched string in bit 0.
+/////////////////////////////////////////////////////////////////////////////////
+class Instrument
+{
+public:
+    static const uint8_t NUM_STRINGS = 6;   // Strings on the guitar.
+    static const uint8_t NUM_FRETS   = 5;   // Frets on the LED fingerboard.  The
+                                            // last one marks unplayed strings.
+    static const uint8_t ALL_STRINGS = (1 << NUM_STRINGS) - 1;  // Mask of every string.
+
+protected:
+
+private:
+    // Unimplemented methods.
+    Instrument();
+};
+
+
+#endif // INSTRUMENTPROFILE_H
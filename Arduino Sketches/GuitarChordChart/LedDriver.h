@@ -29,6 +29,7 @@
 #include "TimerOne.h"   // For timer.
 #include <inttypes.h>   // For uint8_t, ...
 #include "Arduino.h"    // For Arduino specific definitions.
+#include "InstrumentProfile.h"  // For Instrument.
 
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -68,8 +69,8 @@ public:
     static uint16_t DecrementDutyCycle();
 
     // Some useful constants.
-    static const uint16_t NUM_FRETS   = 5;   // Number of frets.
-    static const uint16_t NUM_STRINGS = 6;   // Number of strings.
+    static const uint16_t NUM_FRETS   = Instrument::NUM_FRETS;   // Number of frets.
+    static const uint16_t NUM_STRINGS = Instrument::NUM_STRINGS; // Number of strings.
 
     protected:
 
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////
+// PageCache.cpp
+//
+// Contains methods defined by the PageCache class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>                 // For memset().
+#include "PageCache.h"
+
+
+// Read a byte through the cache.
+// address - Byte address on the block device.
+uint8_t PageCache::ReadByte(uint32_t address)
+{
+    uint32_t block  = address / BlockDevice::BLOCK_SIZE;
+    uint8_t  offset = address % BlockDevice::BLOCK_SIZE;
+
+    // Most reads are from the same page as the last read.
+    if (m_Blocks[m_LastPage] == block)
+    {
+#if PAGE_CACHE_STATS
+        m_Hits++;
+#endif
+        return m_Pages[m_LastPage][offset];
+    }
+
+    uint8_t page = FindPage(block);
+    if (page != NO_PAGE)
+    {
+#if PAGE_CACHE_STATS
+        m_Hits++;
+#endif
+        Touch(page);
+        return m_Pages[page][offset];
+    }
+
+    // It's a miss.  If a neighbor block is cached we're walking through the
+    // table, so prefetch the block after this one in the same direction.
+#if PAGE_CACHE_STATS
+    m_Misses++;
+#endif
+    uint32_t prefetch = NO_BLOCK;
+    if ((block != 0) && (FindPage(block - 1) != NO_PAGE))
+    {
+        prefetch = block + 1;
+    }
+    else if (FindPage(block + 1) != NO_PAGE)
+    {
+        prefetch = block - 1;
+    }
+    if ((prefetch != NO_BLOCK) && (FindPage(prefetch) == NO_PAGE))
+    {
+#if PAGE_CACHE_STATS
+        m_Prefetches++;
+#endif
+        LoadPage(prefetch);
+    }
+
+    page = LoadPage(block);
+    return m_Pages[page][offset];
+}
+
+// Read a little endian 16 bit word through the cache.  The word may span two
+// blocks.
+// address - Byte address on the block device.
+uint16_t PageCache::ReadWord(uint32_t address)
+{
+    uint16_t low = ReadByte(address);
+    return low | ((uint16_t)ReadByte(address + 1) << 8);
+}
+
+// Empty the cache.  Use this if the block device's contents change.
+void PageCache::Invalidate()
+{
+    for (uint8_t page = 0; page < NUM_PAGES; page++)
+    {
+        m_Blocks[page] = NO_BLOCK;
+        m_Ages[page]   = page;
+    }
+    m_LastPage = 0;
+#if PAGE_CACHE_STATS
+    ResetStats();
+#endif
+}
+
+// Return the page holding the specified block, or NO_PAGE if it isn't cached.
+uint8_t PageCache::FindPage(uint32_t block) const
+{
+    for (uint8_t page = 0; page < NUM_PAGES; page++)
+    {
+        if (m_Blocks[page] == block)
+        {
+            return page;
+        }
+    }
+    return NO_PAGE;
+}
+
+// Read a block from the device into the least recently used page, and return
+// the page.  A page that fails to read is left empty and reads as zeros.
+uint8_t PageCache::LoadPage(uint32_t block)
+{
+    // Find the least recently used page.
+    uint8_t page = 0;
+    for (uint8_t i = 1; i < NUM_PAGES; i++)
+    {
+        if (m_Ages[i] > m_Ages[page])
+        {
+            page = i;
+        }
+    }
+
+    if (m_pDevice->Read(block, m_Pages[page]))
+    {
+        m_Blocks[page] = block;
+    }
+    else
+    {
+        m_Blocks[page] = NO_BLOCK;
+        memset(m_Pages[page], 0, BlockDevice::BLOCK_SIZE);
+    }
+    Touch(page);
+    return page;
+}
+
+// Make the specified page the most recently used page.
+void PageCache::Touch(uint8_t page)
+{
+    for (uint8_t i = 0; i < NUM_PAGES; i++)
+    {
+        if (m_Ages[i] < m_Ages[page])
+        {
+            m_Ages[i]++;
+        }
+    }
+    m_Ages[page] = 0;
+    m_LastPage   = page;
+}
@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////////////////////////////////////
+// PageCache.h
+//
+// Defines the PageCache class, a small LRU cache of BlockDevice blocks in RAM.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined PAGECACHE_H
+#define PAGECACHE_H
+
+#include "BlockDevice.h"            // For BlockDevice.
+
+// The number of cached pages.  Each page uses BlockDevice::BLOCK_SIZE bytes of
+// RAM.
+#if !defined CHORD_CACHE_PAGES
+#define CHORD_CACHE_PAGES 8
+#endif
+
+// Define PAGE_CACHE_STATS as 1 to count cache hits, misses and prefetches.
+#if !defined PAGE_CACHE_STATS
+#define PAGE_CACHE_STATS 0
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// PageCache class.  Reads bytes from a BlockDevice through a least recently
+// used cache of whole blocks.  Browsing the chords walks the chord table in
+// order, so when a miss follows a cached neighbor block, the next block in
+// the same direction is prefetched as well.
+/////////////////////////////////////////////////////////////////////////////////
+class PageCache
+{
+public:
+    PageCache(BlockDevice *pDevice) : m_pDevice(pDevice)
+    {
+        Invalidate();
+    }
+    
+    uint8_t  ReadByte(uint32_t address);
+    uint16_t ReadWord(uint32_t address);
+    void     Invalidate();
+
+    // Read from another block device.  The cache is emptied.
+    void     SetDevice(BlockDevice *pDevice) { m_pDevice = pDevice; Invalidate(); }
+
+#if PAGE_CACHE_STATS
+    uint32_t GetHits() const       { return m_Hits; }
+    uint32_t GetMisses() const     { return m_Misses; }
+    uint32_t GetPrefetches() const { return m_Prefetches; }
+    void     ResetStats()          { m_Hits = m_Misses = m_Prefetches = 0; }
+#endif
+
+    static const uint8_t NUM_PAGES = CHORD_CACHE_PAGES;
+
+protected:
+    
+private:
+    // Unimplemented methods.
+    PageCache(const PageCache &);
+    PageCache &operator=(const PageCache &);
+
+    uint8_t  FindPage(uint32_t block) const;
+    uint8_t  LoadPage(uint32_t block);
+    void     Touch(uint8_t page);
+
+    static const uint32_t NO_BLOCK = 0xffffffff;
+    static const uint8_t  NO_PAGE  = 0xff;
+
+    BlockDevice *m_pDevice;
+    uint8_t      m_LastPage;                    // Most recently used page.
+    uint32_t     m_Blocks[NUM_PAGES];           // Block held by each page.
+    uint8_t      m_Ages[NUM_PAGES];             // Age of each page, 0 = most recent.
+    uint8_t      m_Pages[NUM_PAGES][BlockDevice::BLOCK_SIZE];
+#if PAGE_CACHE_STATS
+    uint32_t     m_Hits;
+    uint32_t     m_Misses;
+    uint32_t     m_Prefetches;
+#endif
+};
+
+
+
+#endif // PAGECACHE_H
@@ -0,0 +1,149 @@
+/////////////////////////////////////////////////////////////////////////////////
+// PitchClassSet.cpp
+//
+// Implements the PitchClassSet class, which finds the notes a fingerboard
+// pattern plays.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "PitchClassSet.h"
+
+
+// The set bit of each pitch class.  A variable shift of a 16 bit value is a
+// loop on the AVR, so it is looked up instead.
+static const uint16_t PitchClassBits[PitchClassSet::NUM_PITCH_CLASSES] FORMULA_PROGMEM =
+{
+    0x001, 0x002, 0x004, 0x008, 0x010, 0x020, 0x040, 0x080, 0x100, 0x200, 0x400, 0x800
+};
+
+// The number of bits set in each nibble.
+static const uint8_t NibbleCounts[16] FORMULA_PROGMEM =
+{
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+};
+
+
+uint16_t PitchClassSet::GetBit(uint8_t pitch)
+{
+    return FORMULA_READ_WORD(&PitchClassBits[pitch]);
+}
+
+
+uint8_t PitchClassSet::Count(uint16_t set)
+{
+    return FORMULA_READ_BYTE(&NibbleCounts[set & 0x0f]) +
+           FORMULA_READ_BYTE(&NibbleCounts[(set >> 4) & 0x0f]) +
+           FORMULA_READ_BYTE(&NibbleCounts[(set >> 8) & 0x0f]);
+}
+
+
+// This method finds the notes of a fingerboard pattern.  The rows are
+// scanned from the highest fret down, so each string takes the highest fret
+// it is held at, and the strings left over are open.
+void PitchClassSet::Analyze(uint8_t baseFret, const uint8_t *pPattern, uint8_t numRows,
+                            uint8_t unplayed, unsigned tuning)
+{
+    uint8_t lowestNote = 0xff;
+    uint8_t remaining  = ~unplayed & Instrument::ALL_STRINGS;
+    m_Set = 0;
+
+    for (uint8_t row = numRows + 1; row-- != 0; )
+    {
+        // The last pass (row 0 of the loop) plays the open strings.
+        uint8_t strings = (row == 0) ? remaining : (pPattern[row - 1] & remaining);
+        uint8_t fret    = (row == 0) ? 0 : baseFret + row - 1;
+        remaining &= ~strings;
+        
+        for (uint8_t string = 0; strings != 0; string++, strings >>= 1)
+        {
+            if (strings & 1)
+            {
+                uint8_t note = ChordFormulas::GetOpenNote(tuning, string) + fret;
+                m_Set |= GetBit(ChordFormulas::GetPitchClass(note));
+                if (note < lowestNote)
+                {
+                    lowestNote = note;
+                }
+            }
+        }
+    }
+
+    m_Bass = (m_Set == 0) ? NO_BASS : ChordFormulas::GetPitchClass(lowestNote);
+}
+
+
+// This method names the chord the set plays.  A chord type fits a root when
+// the set has every required interval above it and nothing outside the
+// allowed ones.  A fit with the root in the bass wins, then the one with the
+// fewest optional intervals left out, then the lowest type (the common types
+// come first), so C E G A over A is Am7 rather than C6, and C F Bb over C is
+// C7sus4 rather than Bbsus2.  Every type is tried against every root in the
+// set, at most 36 x 12 checks.
+bool PitchClassSet::Identify(uint8_t &rRoot, uint8_t &rType) const
+{
+    // Rotate the set once for each root rather than once for each type.  A
+    // root that isn't played is left empty, which no formula fits.
+    uint16_t intervals[NUM_PITCH_CLASSES];
+    for (uint8_t root = 0; root < NUM_PITCH_CLASSES; root++)
+    {
+        intervals[root] = Contains(root) ? GetIntervals(root) : 0;
+    }
+
+    uint8_t bestScore = 0xff;
+    for (uint8_t type = 0; type < ChordFormulas::NUM_TYPES; type++)
+    {
+        uint16_t required = ChordFormulas::GetRequired(type);
+        uint16_t allowed  = ChordFormulas::GetAllowed(type);
+        for (uint8_t root = 0; root < NUM_PITCH_CLASSES; root++)
+        {
+            uint16_t set = intervals[root];
+            if (((set & required) != required) || ((set & ~allowed) != 0))
+            {
+                continue;
+            }
+
+            uint8_t score = Count(allowed & ~set);
+            if (root != m_Bass)
+            {
+                score += NUM_PITCH_CLASSES;
+            }
+            if (score < bestScore)
+            {
+                bestScore = score;
+                rRoot     = root;
+                rType     = type;
+            }
+        }
+    }
+    return bestScore != 0xff;
+}
+
+
+// This method finds the notes of a chord voicing in FLASH (or synthesized).
+void PitchClassSet::Analyze(const ChordView &rView, unsigned tuning)
+{
+    uint8_t pattern[NUM_CHORD_FRETS];
+    for (uint8_t row = 0; row < NUM_CHORD_FRETS; row++)
+    {
+        pattern[row] = rView.GetFretPattern(row);
+    }
+    Analyze(rView.GetFret(), pattern, NUM_CHORD_FRETS, rView.GetUnplayed(), tuning);
+}
@@ -0,0 +1,96 @@
+/////////////////////////////////////////////////////////////////////////////////
+// PitchClassSet.h
+//
+// Defines the PitchClassSet class, which finds the notes a fingerboard pattern
+// plays.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined PITCHCLASSSET_H
+#define PITCHCLASSSET_H
+
+#include "ChordChartData.h"     // For Chord and ChordView.
+#include "ChordFormulas.h"      // For TuningType and the open string notes.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// PitchClassSet class.  The notes of a chord as a 12 bit set, bit n set for
+// pitch class n (C = 0), plus the pitch class of the lowest note (the bass).
+// Each string sounds the highest fret it is held at, or its open note when it
+// is neither fretted nor unplayed.  Rotating the set down by the root gives
+// the chord's intervals, in the same form as ChordFormulas.
+/////////////////////////////////////////////////////////////////////////////////
+class PitchClassSet
+{
+public:
+    PitchClassSet(uint16_t set = 0, uint8_t bass = NO_BASS) : m_Set(set), m_Bass(bass) { }
+
+    // Find the notes of a fingerboard pattern.
+    // baseFret - Fret of the first row of the pattern.
+    // pPattern - Strings held at each fret, one byte per row.
+    // numRows  - Rows in the pattern.
+    // unplayed - Strings that aren't played.
+    // tuning   - TuningType of the strings.
+    void Analyze(uint8_t baseFret, const uint8_t *pPattern, uint8_t numRows,
+                 uint8_t unplayed, unsigned tuning = TuningStandard);
+    void Analyze(const Chord &rChord, unsigned tuning = TuningStandard)
+    {
+        Analyze(rChord.GetFret(), rChord.GetPatternPtr(), NUM_CHORD_FRETS,
+                rChord.GetUnplayed(), tuning);
+    }
+    void Analyze(const ChordView &rView, unsigned tuning = TuningStandard);
+
+    uint16_t GetSet() const                 { return m_Set; }
+    uint8_t  GetBass() const                { return m_Bass; }
+    bool     IsEmpty() const                { return m_Set == 0; }
+    bool     Contains(uint8_t pitch) const  { return (m_Set & GetBit(pitch)) != 0; }
+    uint8_t  GetNumNotes() const            { return Count(m_Set); }
+
+    // Return the set as intervals above a root (bit 0 is the root).
+    uint16_t GetIntervals(uint8_t root) const { return Rotate(m_Set, root); }
+
+    // Name the chord the set plays.  Returns false if no chord formula fits.
+    // rRoot - Set to the pitch class of the root.
+    // rType - Set to the ChordType.
+    bool Identify(uint8_t &rRoot, uint8_t &rType) const;
+
+    // Set helpers.  Rotate() moves every pitch class down by semitones
+    // (0..11), wrapping from C to B.
+    static uint16_t GetBit(uint8_t pitch);
+    static uint8_t  Count(uint16_t set);
+    static uint16_t Rotate(uint16_t set, uint8_t semitones)
+    {
+        return ((set >> semitones) | (set << (NUM_PITCH_CLASSES - semitones))) & ALL_PITCH_CLASSES;
+    }
+
+    static const uint8_t  NUM_PITCH_CLASSES = 12;
+    static const uint16_t ALL_PITCH_CLASSES = (1 << NUM_PITCH_CLASSES) - 1;
+    static const uint8_t  NO_BASS           = 0xff;   // No strings played.
+
+protected:
+    
+private:
+    uint16_t m_Set;                     // Bit n set for pitch class n.
+    uint8_t  m_Bass;                    // Pitch class of the lowest note, or NO_BASS.
+};
+
+
+#endif // PITCHCLASSSET_H
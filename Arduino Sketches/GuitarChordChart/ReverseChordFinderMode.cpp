@@ -29,6 +29,8 @@
 #include "LedDriver.h"              // For NUM_FRETS, NUM_STRINGS.
 #include "ModeManager.h"            // For AGAIN.
 #include "EepromConfig.h"           // For EepromConfig class.
+#include "ChordFormulas.h"          // For TuningStandard.
+#include "PitchClassSet.h"          // For PitchClassSet class.
 
 
 // Return a pointer to our singleton instance.
@@ -49,7 +51,10 @@ void ReverseChordFinderMode::Startup()
     m_CurrentString = 0;
     m_CurrentFret   = 0;
     m_CurrentValue  = 0;
-    m_MatchPattern = (1 << LedDriver::NUM_STRINGS) - 1;
+    m_MatchPattern = Instrument::ALL_STRINGS;
+    m_Result        = FOUND_RESULT;
+    m_Ranked        = false;
+    m_NumFound      = 0;
     memset(&m_Chord, 0, sizeof(Chord));
     
     // Reset our chord data to the first chord.
@@ -60,7 +65,7 @@ void ReverseChordFinderMode::Startup()
     
     // Display the initial match pattern on the fingerboard.
     uint8_t *pPattern = m_Chord.GetPatternPtr();
-    pPattern[0] = m_MatchPattern;
+    pPattern[0] = GetStrings(m_MatchPattern);
     pDisplay->DisplayLeds(&m_Chord);
     
     pDisplay->DispLcdProgmem(F("Strings to Match"), true, 0, 0);
@@ -115,7 +120,7 @@ void ReverseChordFinderMode::UpdateCurrentPattern()
     uint8_t *pPattern = m_Chord.GetPatternPtr();
     
     // Setup the bit pattern of the current string.
-    uint8_t stringBp = (1 << m_CurrentString);
+    uint8_t stringBp = GetStrings(1 << m_CurrentString);
     
     // Set or clear the currently selected LED based on its current value.
     if (m_CurrentValue)
@@ -135,10 +140,19 @@ void ReverseChordFinderMode::UpdateCurrentPattern()
     else
     {
         // Current LED value is "off" so clear the corresponding bit.
-        pPattern[m_CurrentFret] &= ~(1 << m_CurrentString);
+        pPattern[m_CurrentFret] &= ~stringBp;
     }
 }
 
+// Return the strings under a bit pattern of LEDs on the fingerboard.  The
+// string cursor and the strings to match are kept as LEDs, so the keys move
+// them the same way across the fingerboard when it is mirrored for a
+// left-handed player.
+uint8_t ReverseChordFinderMode::GetStrings(uint8_t leds) const
+{
+    return Display::Instance()->GetLeftHanded() ? Display::MirrorStrings(leds) : leds;
+}
+
 // Display the current base fret value.
 void ReverseChordFinderMode::UpdateBaseFretDisplay()
 {
@@ -175,18 +189,18 @@ uint32_t ReverseChordFinderMode::HandleGettingStringsMatchPatternState(uint32_t
         {
             m_MatchPattern >>= 1;
         }
-        pPattern[0] = m_MatchPattern;
+        pPattern[0] = GetStrings(m_MatchPattern);
         
         // Display the match pattern on the fingerboard.
         pDisplay->DisplayLeds(&m_Chord);
         break;
         
     case PATTERN_LEFT: // Add upper strings.
-        if (m_MatchPattern < ((1 << LedDriver::NUM_STRINGS) - 1))
+        if (m_MatchPattern < Instrument::ALL_STRINGS)
         {
             m_MatchPattern = (m_MatchPattern <<= 1) + 1;
         }
-        pPattern[0] = m_MatchPattern;
+        pPattern[0] = GetStrings(m_MatchPattern);
 
         // Display the match pattern on the fingerboard.
         pDisplay->DisplayLeds(&m_Chord);
@@ -284,7 +298,7 @@ uint32_t ReverseChordFinderMode::HandleGettingPatternState(uint32_t irKey)
         {
             m_Delay.Start(LONG_DELAY);
         }
-        pPattern[m_CurrentFret] ^= (1 << m_CurrentString);
+        pPattern[m_CurrentFret] ^= GetStrings(1 << m_CurrentString);
         pDisplay->DisplayLeds(&m_Chord);
     }
     
@@ -299,7 +313,7 @@ uint32_t ReverseChordFinderMode::HandleGettingPatternState(uint32_t irKey)
             m_CurrentFret = 0;
         }
         // Set the new LED as active and re-start the delay.
-        m_CurrentValue = (pPattern[m_CurrentFret] & (1 << m_CurrentString)) ? 1 : 0;
+        m_CurrentValue = (pPattern[m_CurrentFret] & GetStrings(1 << m_CurrentString)) ? 1 : 0;
         m_Delay.Start(LONG_DELAY);
         break;
         
@@ -311,7 +325,7 @@ uint32_t ReverseChordFinderMode::HandleGettingPatternState(uint32_t irKey)
             m_CurrentFret = LedDriver::NUM_FRETS - 1;
         }
         // Set the new LED as active and re-start the delay.
-        m_CurrentValue = (pPattern[m_CurrentFret] & (1 << m_CurrentString)) ? 1 : 0;
+        m_CurrentValue = (pPattern[m_CurrentFret] & GetStrings(1 << m_CurrentString)) ? 1 : 0;
         m_Delay.Start(LONG_DELAY);
         break;
         
@@ -323,7 +337,7 @@ uint32_t ReverseChordFinderMode::HandleGettingPatternState(uint32_t irKey)
             m_CurrentString = 0;
         }
         // Set the new LED as active and re-start the delay.
-        m_CurrentValue = (pPattern[m_CurrentFret] & (1 << m_CurrentString)) ? 1 : 0;
+        m_CurrentValue = (pPattern[m_CurrentFret] & GetStrings(1 << m_CurrentString)) ? 1 : 0;
         m_Delay.Start(LONG_DELAY);
         break;
         
@@ -335,29 +349,40 @@ uint32_t ReverseChordFinderMode::HandleGettingPatternState(uint32_t irKey)
             m_CurrentString = LedDriver::NUM_STRINGS - 1;
         }
         // Set the new LED as active and re-start the delay.
-        m_CurrentValue = (pPattern[m_CurrentFret] & (1 << m_CurrentString)) ? 1 : 0;
+        m_CurrentValue = (pPattern[m_CurrentFret] & GetStrings(1 << m_CurrentString)) ? 1 : 0;
         m_Delay.Start(LONG_DELAY);
         break;
         
     case TOGGLE: // Toggle the current LED's state.
         m_CurrentValue ^= 1;
         UpdateCurrentPattern();
+        UpdateCandidates();
         m_Delay.Start(LONG_DELAY);
         break;
         
     case SEARCH: // Start the search.
         UpdateCurrentPattern();
         pDisplay->DisplayLeds(&m_Chord);
+        m_Result = FOUND_RESULT;
+        m_Ranked = false;
         
         if (Search())
         {
-            // A chord matching the specified pattern was found, display it.
-            pDisplay->DisplayChord(&m_ChordData);
+            // Chords matching the specified pattern were found, display the
+            // first.
+            DisplayFound();
+        }
+        else if (DisplayIdentified())
+        {
+            // No chord matches, but the notes of the pattern make one.
+            m_Result = NAMED_RESULT;
         }
         else
         {
-            // The specified pattern was not found, let the user know.
+            // The specified pattern was not found, let the user know, and
+            // that the nearest chords can be shown.
             pDisplay->DispLcdProgmem(F("Chord Not Found"), true, 0, 0);
+            pDisplay->DispLcdProgmem(F("Ffwd => Nearest"), false, 1, 0);
         }
         m_CurrentState = WAITING_DONE_STATE;
         break;
@@ -387,24 +412,52 @@ uint32_t ReverseChordFinderMode::HandleWaitingDoneState(uint32_t irKey)
     switch (irKey)
     {
     case SEARCH:
-        // Point past last found chord, then search.
-        m_ChordData.NextChord();
-        if (Search())
+    case NEXT_FOUND: // Step to the next chord found, and wrap if needed.
+        if (m_NumFound != 0)
         {
-            pDisplay->DisplayChord(&m_ChordData);
+            if (++m_FoundIndex >= m_NumFound)
+            {
+                m_FoundIndex = 0;
+            }
+            m_Result = FOUND_RESULT;
+            DisplayFound();
         }
-        else
+        break;
+        
+    case PREV_FOUND: // Step to the previous chord found, and wrap if needed.
+        if (m_NumFound != 0)
         {
-            pDisplay->DispLcdProgmem(F("Chord Not Found"), true, 0, 0);
+            if (0 == m_FoundIndex--)
+            {
+                m_FoundIndex = m_NumFound - 1;
+            }
+            m_Result = FOUND_RESULT;
+            DisplayFound();
+        }
+        break;
+        
+    case NEAREST: // Step through the chords nearest the pattern.
+        if (!m_Ranked)
+        {
+            m_Ranked = Rank();
+            m_Rank   = 0;
+        }
+        else if (++m_Rank >= m_Ranker.GetNumResults())
+        {
+            m_Rank = 0;
+        }
+        if (m_Ranked)
+        {
+            m_Result = RANKED_RESULT;
+            DisplayRanked();
         }
-        m_CurrentState = WAITING_DONE_STATE;
         break;
         
     case TOGGLE_TYPE_DISPLAY: // Toggle chord type display type.
         verboseDisplay ^= true;
         pAppConfig->m_Verbose = verboseDisplay;
         pDisplay->SetVerbose(pAppConfig->m_Verbose);
-        pDisplay->DisplayChord(&m_ChordData);
+        DisplayResult();
         break;
             
     case NEXT_UNPLAYED_OPT:
@@ -414,7 +467,7 @@ uint32_t ReverseChordFinderMode::HandleWaitingDoneState(uint32_t irKey)
         }
         pAppConfig->m_UnplayedOption = unplayedOption;
         pDisplay->SetUnplayedOption(unplayedOption);
-        pDisplay->DisplayChord(&m_ChordData);
+        DisplayResult();
         break;
             
     default:
@@ -425,21 +478,236 @@ uint32_t ReverseChordFinderMode::HandleWaitingDoneState(uint32_t irKey)
     return returnedIrKey;
 }
 
-// Perform the actual search to try to match the pattern entered by the userl.
+// Display the result of the last search again, after a display option changes.
+void ReverseChordFinderMode::DisplayResult()
+{
+    switch (m_Result)
+    {
+    case NAMED_RESULT:
+        DisplayIdentified();
+        break;
+        
+    case RANKED_RESULT:
+        DisplayRanked();
+        break;
+        
+    default:
+        if (m_NumFound != 0)
+        {
+            DisplayFound();
+        }
+        break;
+    }
+}
+
+// Load and display the chord found selected.
+void ReverseChordFinderMode::DisplayFound()
+{
+    m_ChordData.GetChordAt(m_Found[m_FoundIndex]);
+    Display::Instance()->DisplayFoundChord(&m_ChordData, m_FoundIndex + 1, m_NumFound,
+                                           m_MoreFound);
+}
+
+// Rank every chord by how near it is to the pattern entered by the user, with
+// the strings that aren't matched left out, and keep the nearest.  The rows
+// are compared fret by fret, unless any base fret was selected.  This is one
+// pass through the whole chord table.  Returns false if no chord can be
+// ranked (the pattern starts behind the capo).
+bool ReverseChordFinderMode::Rank()
+{
+    SearchPattern search;
+    if (!GetSearchPattern(search))
+    {
+        return false;
+    }
+    
+    ChordRanker::Pattern target;
+    target.m_Fret     = (m_Chord.GetFret() == 0) ? 0 : search.m_BaseFret;
+    target.m_Unplayed = search.m_Unplayed;
+    for (uint8_t row = 0; row < ChordRanker::NUM_ROWS; row++)
+    {
+        target.m_Rows[row] = (row < search.m_NumFrets) ? search.m_pFrets[row] : 0;
+    }
+    m_Ranker.Start(target, search.m_Match);
+    
+    // Score every chord.
+    const ChordView &rView = m_ChordData.GetChordView();
+    ChordRanker::Pattern pattern;
+    m_ChordData.GetChord(0, 0, 0);
+    do
+    {
+        pattern.m_Fret     = rView.GetFret();
+        pattern.m_Unplayed = rView.GetUnplayed();
+        for (uint8_t row = 0; row < ChordRanker::NUM_ROWS; row++)
+        {
+            pattern.m_Rows[row] = rView.GetFretPattern(row);
+        }
+        m_Ranker.Add(m_ChordData.GetCurrentVoicing(), pattern);
+    } while (m_ChordData.NextChord());
+    
+    m_Ranker.Finish();
+    return m_Ranker.GetNumResults() != 0;
+}
+
+// Load and display the ranked chord selected.
+void ReverseChordFinderMode::DisplayRanked()
+{
+    const ChordRanker::Result &rResult = m_Ranker.GetResult(m_Rank);
+    m_ChordData.GetChordAt(rResult.m_Id);
+    Display::Instance()->DisplayRankedChord(&m_ChordData, m_Rank + 1, rResult.m_Distance);
+}
+
+// Name the pattern entered by the user from its notes, when it matches no
+// chord in the chord table, and display the name.  Strings that aren't
+// matched are left out.  With any base fret, the pattern is named where the
+// LEDs show it, on the first fret above the capo.  Returns false if the notes
+// don't make any chord.
+bool ReverseChordFinderMode::DisplayIdentified()
+{
+    // Cache some useful data.
+    uint8_t *pPattern = m_Chord.GetPatternPtr();
+    uint8_t baseFret  = m_Chord.GetFret();
+    uint8_t capo      = m_ChordData.GetCapo();
+    uint8_t unplayed  = pPattern[LedDriver::NUM_FRETS - 1] | ~GetStrings(m_MatchPattern);
+    
+    if (baseFret == 0)
+    {
+        baseFret = capo + 1;
+    }
+    else if (baseFret <= capo)
+    {
+        return false;
+    }
+    
+    // Name the shape fingered behind the capo, then move its root and bass up
+    // by the capo, the same way the chord table's keys are.
+    PitchClassSet notes;
+    uint8_t root;
+    uint8_t type;
+    notes.Analyze(baseFret - capo, pPattern, LedDriver::NUM_FRETS - 1, unplayed,
+                  m_ChordData.GetTuning());
+    if (!notes.Identify(root, type))
+    {
+        return false;
+    }
+    Display::Instance()->DisplayNamedChord((root + capo) % PitchClassSet::NUM_PITCH_CLASSES, type,
+                                           (notes.GetBass() + capo) % PitchClassSet::NUM_PITCH_CLASSES,
+                                           baseFret);
+    return true;
+}
+
+// Find the chords matching the pattern entered by the user, in one pass, and
+// keep the first MAX_FOUND of them in m_Found[], so the user can step back
+// and forth through them without searching again.  The first is loaded.
+// Returns false if none matches.
 bool ReverseChordFinderMode::Search()
+{
+    SearchPattern pattern;
+    m_NumFound   = 0;
+    m_MoreFound  = false;
+    m_FoundIndex = 0;
+    if (!GetSearchPattern(pattern))
+    {
+        return false;
+    }
+    
+    // When every string is compared in standard tuning, a matching chord has
+    // the pattern's key, so only the chords in its reverse index slot need to
+    // be looked at, or with any base fret, its transposition index slot.  A
+    // build without the index (see ChordTableConfig.h) scans instead.
+#if CHORD_REVERSE_INDEX || CHORD_TRANSPOSE_INDEX
+    if ((m_MatchPattern == Instrument::ALL_STRINGS) &&
+        (m_ChordData.GetTuning() == TuningStandard) &&
+        ((pattern.m_BaseFret != 0) ? CHORD_REVERSE_INDEX : CHORD_TRANSPOSE_INDEX))
+    {
+        IndexSearch(pattern);
+    }
+    else
+#endif
+    {
+        // Otherwise try every chord.
+        const ChordView &rView = m_ChordData.GetChordView();
+        m_ChordData.GetChord(0, 0, 0);
+        do
+        {
+            if (Matches(pattern, rView))
+            {
+                AddFound(m_ChordData.GetCurrentVoicing());
+            }
+        } while (m_ChordData.NextChord());
+    }
+    
+    if (m_NumFound == 0)
+    {
+        return false;
+    }
+    m_ChordData.GetChordAt(m_Found[0]);
+    return true;
+}
+
+// Add a chord found to m_Found[], in the order NextChord() steps through the
+// chords.  When it is full, the chord stepped to last is dropped.  A scan
+// finds the chords in order, so each is added at the end.
+void ReverseChordFinderMode::AddFound(unsigned voicing)
+{
+    unsigned position = m_ChordData.GetVoicingPosition(voicing);
+    uint8_t  index    = m_NumFound;
+    
+    if (m_NumFound < MAX_FOUND)
+    {
+        m_NumFound++;
+    }
+    else
+    {
+        m_MoreFound = true;
+        if (position > m_ChordData.GetVoicingPosition(m_Found[MAX_FOUND - 1]))
+        {
+            return;
+        }
+        index = MAX_FOUND - 1;
+    }
+    for ( ; (index != 0) && (m_ChordData.GetVoicingPosition(m_Found[index - 1]) > position);
+          index--)
+    {
+        m_Found[index] = m_Found[index - 1];
+    }
+    m_Found[index] = voicing;
+}
+
+// Normalize the pattern entered by the user for a search.  Returns false if
+// no chord can match it.
+bool ReverseChordFinderMode::GetSearchPattern(SearchPattern &rPattern)
 {
     // Cache some useful data.
     uint8_t *pPattern   = m_Chord.GetPatternPtr();    
-    uint8_t patternMask = ~pPattern[LedDriver::NUM_FRETS - 1];
-    uint8_t baseFret    = m_Chord.GetFret();
     uint8_t patternSize = LedDriver::NUM_FRETS - 1;
+    uint8_t baseFret    = m_Chord.GetFret();
+    uint8_t capo        = m_ChordData.GetCapo();
+    
+    rPattern.m_Unplayed = pPattern[LedDriver::NUM_FRETS - 1];
+    rPattern.m_Match    = GetStrings(m_MatchPattern);
+    
+    // The base fret is entered counted from the nut, as it is displayed, but
+    // the chord shapes are counted from the capo.  No shape starts behind it.
+    if (baseFret != 0)
+    {
+        if (baseFret <= capo)
+        {
+            return false;
+        }
+        baseFret -= capo;
+    }
     
     // Normalize the pattern so that the pattern's first fret is always used.
+    // Any base fret stays any.
     while ((*pPattern == 0) && (patternSize != 0))
     {
         pPattern++;
         patternSize--;
-        baseFret++;
+        if (baseFret != 0)
+        {
+            baseFret++;
+        }
     }
     // Handle the degenerate case where all frets are open.
     if (patternSize == 0)
@@ -448,48 +716,157 @@ bool ReverseChordFinderMode::Search()
         baseFret    = 1;
         pPattern = m_Chord.GetPatternPtr();
     }
-        
-    // We haven't found the chord yet.
-    bool found = false;
     
-    // Loop to try to find the specified pattern.
-    do
+    rPattern.m_pFrets   = pPattern;
+    rPattern.m_NumFrets = patternSize;
+    rPattern.m_BaseFret = baseFret;
+    return true;
+}
+
+// Count the chords that fit the pattern as it stands, the ones a search
+// would step through, and display the count with the first of them.  Each
+// string compared must be on the same row, or unplayed, as in the pattern,
+// or if it is open in the pattern, on none of the rows or unplayed.  The
+// posting lists only hold the chord table, so nothing is counted in other
+// tunings, where the chords are synthesized.
+void ReverseChordFinderMode::UpdateCandidates()
+{
+    SearchPattern pattern;
+    if (m_ChordData.GetTuning() != TuningStandard)
     {
-        // See if the base fret matches the request.
-        if ((baseFret != 0) && (baseFret != m_ChordData.GetCurrentFret()))
+        return;
+    }
+    if (!GetSearchPattern(pattern))
+    {
+        Display::Instance()->DisplayCandidates(0, NULL);
+        return;
+    }
+    
+    m_Filter.Clear();
+    m_Filter.RequireFret(pattern.m_BaseFret);
+    for (uint8_t string = 0; string < LedDriver::NUM_STRINGS; string++)
+    {
+        uint8_t strings = 1 << string;
+        uint8_t row     = 0;
+        if ((pattern.m_Match & strings) == 0)
         {
-            // Doesn't match, look for another.
             continue;
         }
-        
-        // See if the unplayed strings match the request.
-        if ((pPattern[LedDriver::NUM_FRETS - 1] & m_MatchPattern) !=
-            (m_ChordData.GetChordPtr()->GetUnplayed() & m_MatchPattern))
+        if ((pattern.m_Unplayed & strings) != 0)
         {
-            // Doesn't match, look for another.
+            m_Filter.RequireString(string, 1 << CandidateFilter::UNPLAYED_ROW, true);
             continue;
         }
-        
-        // Base fret and unplayed strings match, see if the pattern matches.
-        unsigned index = 0;
-        for ( ; index < patternSize; index++)
+        while ((row < pattern.m_NumFrets) && ((pattern.m_pFrets[row] & strings) == 0))
         {
-            if ((pPattern[index] & m_MatchPattern) != 
-                (m_ChordData.GetChordPatternPtr()[index] & m_MatchPattern))
-            {
-                // Pattern doesn't match.
-                break;
-            }
+            row++;
         }
-        
-        // See if we found a match.
-        if (index == patternSize)
+        if (row < pattern.m_NumFrets)
+        {
+            m_Filter.RequireString(string, 1 << row, true);
+        }
+        else
         {
-            found = true;
+            m_Filter.RequireString(string, ((1 << pattern.m_NumFrets) - 1) |
+                                           (1 << CandidateFilter::UNPLAYED_ROW), false);
         }
-    } while (!found && m_ChordData.NextChord());  // Loop till we find one or until
-                                                  // we hit the end of the known chords.
-                                                  
-    // Return the found status.
-    return found;
+    }
+    
+    // A search starts from the first chord.
+    unsigned first;
+    m_ChordData.GetChord(0, 0, 0);
+    unsigned count = m_Filter.Count(m_ChordData.GetCurrentVoicing(), first);
+    if (count != 0)
+    {
+        m_ChordData.GetChordAt(first);
+    }
+    Display::Instance()->DisplayCandidates(count, (count != 0) ? &m_ChordData : NULL);
 }
+
+// Return true if a chord matches a search pattern.
+bool ReverseChordFinderMode::Matches(const SearchPattern &rPattern, const ChordView &rView)
+{
+    uint8_t match = rPattern.m_Match;
+    
+    // See if the base fret matches the request.
+    if ((rPattern.m_BaseFret != 0) && (rPattern.m_BaseFret != rView.GetFret()))
+    {
+        return false;
+    }
+    
+    // See if the unplayed strings match the request.
+    if ((rPattern.m_Unplayed & match) != (rView.GetUnplayed() & match))
+    {
+        return false;
+    }
+    
+    // Base fret and unplayed strings match, see if the pattern matches.
+    for (unsigned index = 0; index < rPattern.m_NumFrets; index++)
+    {
+        if ((rPattern.m_pFrets[index] & match) != (rView.GetFretPattern(index) & match))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if CHORD_REVERSE_INDEX || CHORD_TRANSPOSE_INDEX
+// Find the chords matching the pattern like a scan, but only looking at the
+// chords in the pattern's reverse index slot.  With any base fret the key
+// has no fret, and the slot is looked up in the transposition index, which
+// holds every chord by its shape alone, so one slot has every transposition
+// of the shape.  Search() only calls this when the build has the index.
+void ReverseChordFinderMode::IndexSearch(const SearchPattern &rPattern)
+{
+    unsigned slot = GetIndexSlot(GetIndexKey(rPattern));
+    if (rPattern.m_BaseFret != 0)
+    {
+#if CHORD_REVERSE_INDEX
+        unsigned last = ChordStore::ReadReverseStart(slot + 1);
+        for (unsigned index = ChordStore::ReadReverseStart(slot); index < last; index++)
+        {
+            AddIfMatches(rPattern, ChordStore::ReadReverseVoicing(index));
+        }
+#endif
+    }
+    else
+    {
+#if CHORD_TRANSPOSE_INDEX
+        unsigned last = ChordStore::ReadTransposeStart(slot + 1);
+        for (unsigned index = ChordStore::ReadTransposeStart(slot); index < last; index++)
+        {
+            AddIfMatches(rPattern, ChordStore::ReadTransposeVoicing(index));
+        }
+#endif
+    }
+}
+
+// Load a chord, and add it to the chords found if it matches the pattern.
+// Each is loaded, so this works wherever the chord table is stored.
+void ReverseChordFinderMode::AddIfMatches(const SearchPattern &rPattern, unsigned voicing)
+{
+    m_ChordData.GetChordAt(voicing);
+    if (Matches(rPattern, m_ChordData.GetChordView()))
+    {
+        AddFound(voicing);
+    }
+}
+
+// Return the reverse index key of a search pattern: the base fret in bits
+// 0-3 (0 for any, the transposition index key), the unplayed strings in bits
+// 4-9 and the strings on the first fret in bits 10-15.  This must match
+// ReverseIndex::GetKey() in ChordTableCompiler.
+uint16_t ReverseChordFinderMode::GetIndexKey(const SearchPattern &rPattern)
+{
+    return rPattern.m_BaseFret | ((uint16_t)rPattern.m_Unplayed << 4) |
+           ((uint16_t)rPattern.m_pFrets[0] << 10);
+}
+
+// Return the reverse index slot of a key, the top bits of a multiplicative
+// hash.  This must match ReverseIndex::GetSlot() in ChordTableCompiler.
+unsigned ReverseChordFinderMode::GetIndexSlot(uint16_t key)
+{
+    return (uint16_t)(key * 0x9e37u) >> (16 - ChordStore::GetReverseSlotBits());
+}
+#endif // CHORD_REVERSE_INDEX || CHORD_TRANSPOSE_INDEX
@@ -34,6 +34,8 @@
 #include "ChordChartData.h"     // For the chord data.
 #include "PolledDelay.h"        // For PolledDelay class.
 #include "LedDriver.h"          // For NUM_STRINGS.
+#include "ChordRanker.h"        // For ChordRanker class.
+#include "CandidateFilter.h"    // For CandidateFilter class.
 
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -51,6 +53,9 @@ public:
     virtual void     Startup();
     virtual void     Shutdown() { }
     
+    // Select the fret of the capo, 0 for none.
+    void SetCapo(unsigned capo) { m_ChordData.SetCapo(capo); }
+    
 protected:
     
 private:
@@ -63,7 +68,9 @@ private:
     static const uint32_t TOGGLE              = IrCodes::OK;      // Enter
     static const uint32_t SELECT              = IrCodes::OK;      // Enter
     static const uint32_t SEARCH              = IrCodes::PLAY;    // Play
-    static const uint32_t SEARCH_NEXT         = IrCodes::FFWD;    // Ffwd
+    static const uint32_t NEAREST             = IrCodes::FFWD;    // Ffwd
+    static const uint32_t NEXT_FOUND          = IrCodes::CH_UP;   // Channel Up
+    static const uint32_t PREV_FOUND          = IrCodes::CH_DOWN; // Channel Down
     static const uint32_t TOGGLE_TYPE_DISPLAY = IrCodes::INFO;    // Info
     static const uint32_t NEXT_UNPLAYED_OPT   = IrCodes::GUIDE;   // Guide
     static const uint32_t PATTERN_RIGHT       = IrCodes::RIGHT;   // Right
@@ -75,11 +82,31 @@ private:
     static const uint8_t GETTING_PATTERN_STATE              = 2;
     static const uint8_t WAITING_DONE_STATE                 = 3;
     
+    // What the LCD shows after a search.
+    static const uint8_t FOUND_RESULT  = 0;     // The chord found, if any.
+    static const uint8_t NAMED_RESULT  = 1;     // No chord matched.  The pattern
+                                                // was named from its notes.
+    static const uint8_t RANKED_RESULT = 2;     // One of the nearest chords.
+    
     // Miscellaneous constants.
     static const uint8_t  MAX_BASE_FRET   = 11;
+    static const uint8_t  MAX_FOUND       = 32;   // Chords kept by a search.
     static const uint32_t LONG_DELAY      = 500;
     static const uint32_t SHORT_DELAY     = 125;
     
+    /////////////////////////////////////////////////////////////////////////////
+    // SearchPattern structure.  The pattern entered, normalized so that its
+    // first fret has a string on it.
+    /////////////////////////////////////////////////////////////////////////////
+    struct SearchPattern
+    {
+        const uint8_t *m_pFrets;        // Strings on each fret.
+        uint8_t        m_NumFrets;
+        uint8_t        m_BaseFret;      // Counted from the capo, 0 for any.
+        uint8_t        m_Unplayed;      // Unplayed strings.
+        uint8_t        m_Match;         // Strings compared.
+    };
+    
     
     // Unimplemented methods
     ReverseChordFinderMode(ReverseChordFinderMode &rMgr);
@@ -88,14 +115,17 @@ private:
     // Private constructor and destructor for singleton.
     ReverseChordFinderMode() : m_ChordData(), m_CurrentState(GETTING_STRING_MATCH_PATTERN_STATE), m_CurrentString(0),
                                m_CurrentFret(0), m_CurrentValue(0),
-                               m_MatchPattern((1 << LedDriver::NUM_STRINGS) - 1),
-                               m_Delay(LONG_DELAY), m_Chord()
+                               m_MatchPattern(Instrument::ALL_STRINGS),
+                               m_Delay(LONG_DELAY), m_Chord(), m_Result(FOUND_RESULT),
+                               m_Ranker(), m_Ranked(false), m_Rank(0), m_Filter(),
+                               m_NumFound(0), m_MoreFound(false), m_FoundIndex(0)
     { 
         memset(&m_Chord, 0, sizeof(Chord));
         m_ChordData.GetChord(0, 0, 0);
     }
     ~ReverseChordFinderMode() { }
     
+    uint8_t  GetStrings(uint8_t leds) const;
     void     UpdateCurrentPattern();
     void     UpdateBaseFretDisplay();
     uint32_t HandleGettingFretState(uint32_t irKey);
@@ -103,6 +133,24 @@ private:
     uint32_t HandleGettingPatternState(uint32_t irKey);
     uint32_t HandleWaitingDoneState(uint32_t irKey);
     bool     Search();
+    bool     GetSearchPattern(SearchPattern &rPattern);
+    void     UpdateCandidates();
+#if CHORD_REVERSE_INDEX || CHORD_TRANSPOSE_INDEX
+    void     IndexSearch(const SearchPattern &rPattern);
+    void     AddIfMatches(const SearchPattern &rPattern, unsigned voicing);
+#endif
+    void     AddFound(unsigned voicing);
+    void     DisplayFound();
+    bool     DisplayIdentified();
+    void     DisplayResult();
+    bool     Rank();
+    void     DisplayRanked();
+    
+    static bool     Matches(const SearchPattern &rPattern, const ChordView &rView);
+#if CHORD_REVERSE_INDEX || CHORD_TRANSPOSE_INDEX
+    static uint16_t GetIndexKey(const SearchPattern &rPattern);
+    static unsigned GetIndexSlot(uint16_t key);
+#endif
       
     ChordChartData m_ChordData;
     uint8_t        m_CurrentState;
@@ -112,6 +160,17 @@ private:
     uint8_t        m_MatchPattern;
     PolledDelay    m_Delay;
     Chord          m_Chord;
+    uint8_t        m_Result;        // What the LCD shows after a search.
+    ChordRanker    m_Ranker;        // The chords nearest the pattern,
+    bool           m_Ranked;        // once they have been ranked.
+    uint8_t        m_Rank;          // The one shown.
+    CandidateFilter m_Filter;       // The chords that fit the pattern
+                                    // being entered.
+    uint16_t       m_Found[MAX_FOUND];  // Voicings found by the last search,
+                                        // in the order NextChord() steps,
+    uint8_t        m_NumFound;          // the first MAX_FOUND of them,
+    bool           m_MoreFound;         // and whether more matched.
+    uint8_t        m_FoundIndex;        // The one shown.
 };
 
 
@@ -31,6 +31,9 @@
 #include "EepromConfig.h"      // For AppConfig struct.
 #include "LedDriver.h"         // For LedDriver class.
 #include "DemoMode.h"          // For DemoMode class.
+#include "ChordFinderMode.h"   // For ChordFinderMode class.
+#include "ReverseChordFinderMode.h" // For ReverseChordFinderMode class.
+#include "ChordFormulas.h"     // For TuningType.
 
 
 // Return a pointer to our singleton instance.
@@ -51,6 +54,7 @@ void SettingsMode::Initialize()
     AppConfig *pAppConfig     = &pConfig->m_AppConfig;
     DemoMode *pDemoMode       = DemoMode::Instance();
     ModeManager *pModeManager = ModeManager::Instance();
+    ChordFinderMode *pChordFinderMode = ChordFinderMode::Instance();
 
     if (pConfig->GetFromEE())
     {
@@ -65,6 +69,9 @@ void SettingsMode::Initialize()
         pAppConfig->m_DemoDisplayOption    = pDemoMode->GetDisplayOption();
         pAppConfig->m_IrCodeDispPermission = pModeManager->GetIrCodeDisplayPermission();
         pAppConfig->m_Brightness           = LedDriver::GetDutyCycle();
+        pAppConfig->m_Tuning               = pChordFinderMode->GetTuning();
+        pAppConfig->m_Capo                 = pChordFinderMode->GetCapo();
+        pAppConfig->m_LeftHanded           = pDisplay->GetLeftHanded();
         
         // Store the config data locally.
         m_AppConfig = *pAppConfig;
@@ -102,6 +109,18 @@ uint32_t SettingsMode::Execute(uint32_t irKey)
         irKey = HandleGettingChordDisplayDisplay(irKey);
         break;
             
+    case GETTING_TUNING_STATE:
+        irKey = HandleGettingTuning(irKey);
+        break;
+            
+    case GETTING_CAPO_STATE:
+        irKey = HandleGettingCapo(irKey);
+        break;
+            
+    case GETTING_HANDEDNESS_STATE:
+        irKey = HandleGettingHandedness(irKey);
+        break;
+            
     case GETTING_UNPLAYED_OPTION_STATE:
         irKey = HandleGettingUnplayedOption(irKey);
         break;
@@ -142,6 +161,33 @@ void SettingsMode::EnterChordDisplayState()
     DisplayChordDisplaySelection();
 }
 
+void SettingsMode::EnterTuningState()
+{
+    Display  *pDisplay  = Display::Instance();
+    
+    m_CurrentState = GETTING_TUNING_STATE;
+    pDisplay->DispLcdProgmem(F("Tuning:"), true, 0, 4);
+    DisplayTuningSelection();
+}
+
+void SettingsMode::EnterCapoState()
+{
+    Display  *pDisplay  = Display::Instance();
+    
+    m_CurrentState = GETTING_CAPO_STATE;
+    pDisplay->DispLcdProgmem(F("Capo:"), true, 0, 5);
+    DisplayCapoSelection();
+}
+
+void SettingsMode::EnterHandednessState()
+{
+    Display  *pDisplay  = Display::Instance();
+    
+    m_CurrentState = GETTING_HANDEDNESS_STATE;
+    pDisplay->DispLcdProgmem(F("Fingerboard:"), true, 0, 2);
+    DisplayHandednessSelection();
+}
+
 void SettingsMode::EnterUnplayedState()
 {
     Display  *pDisplay  = Display::Instance();
@@ -207,6 +253,114 @@ uint32_t SettingsMode::HandleGettingChordDisplayDisplay(uint32_t irKey)
         break;
         
     case SELECT:  // Enter the next state.
+        EnterTuningState();
+        break;
+        
+    default:
+        // We didn't handle the passed in key, so return it unmodified.
+        returnKey = irKey;
+        break;
+    }
+    
+    return returnKey;
+}
+
+uint32_t SettingsMode::HandleGettingTuning(uint32_t irKey)
+{
+    // Cache some useful data.
+    unsigned  tuning    = m_AppConfig.m_Tuning;
+    
+    // Assume that we're going to use the specified IR key.
+    uint32_t returnKey = 0;
+    
+    switch (irKey)
+    {
+    case PREVIOUS: // Bump to the previous tuning and display the selection.
+        if (tuning-- == TuningStandard)
+        {
+            tuning = NUM_TUNINGS - 1;
+        }
+        m_AppConfig.m_Tuning = tuning;
+        DisplayTuningSelection();
+        break;
+        
+    case NEXT: // Bump to the next tuning and display the selection.
+        if (++tuning >= NUM_TUNINGS)
+        {
+            tuning = TuningStandard;
+        }
+        m_AppConfig.m_Tuning = tuning;
+        DisplayTuningSelection();
+        break;
+        
+    case SELECT: // Enter the next state.
+        EnterCapoState();
+        break;
+        
+    default:
+        // We didn't handle the passed in key, so return it unmodified.
+        returnKey = irKey;
+        break;
+    }
+    
+    return returnKey;
+}
+
+uint32_t SettingsMode::HandleGettingCapo(uint32_t irKey)
+{
+    // Cache some useful data.
+    unsigned  capo      = m_AppConfig.m_Capo;
+    
+    // Assume that we're going to use the specified IR key.
+    uint32_t returnKey = 0;
+    
+    switch (irKey)
+    {
+    case PREVIOUS: // Move the capo down a fret and display the selection.
+        if (capo-- == 0)
+        {
+            capo = ChordChartData::MAX_CAPO;
+        }
+        m_AppConfig.m_Capo = capo;
+        DisplayCapoSelection();
+        break;
+        
+    case NEXT: // Move the capo up a fret and display the selection.
+        if (++capo > ChordChartData::MAX_CAPO)
+        {
+            capo = 0;
+        }
+        m_AppConfig.m_Capo = capo;
+        DisplayCapoSelection();
+        break;
+        
+    case SELECT: // Enter the next state.
+        EnterHandednessState();
+        break;
+        
+    default:
+        // We didn't handle the passed in key, so return it unmodified.
+        returnKey = irKey;
+        break;
+    }
+    
+    return returnKey;
+}
+
+uint32_t SettingsMode::HandleGettingHandedness(uint32_t irKey)
+{
+    // Assume that we're going to use the specified IR key.
+    uint32_t returnKey = 0;
+    
+    switch (irKey)
+    {
+    case PREVIOUS:
+    case NEXT:      // Toggle the left-handed option value.
+        m_AppConfig.m_LeftHanded ^= true;
+        DisplayHandednessSelection();
+        break;
+        
+    case SELECT: // Enter the next state.
         EnterUnplayedState();
         break;
         
@@ -425,6 +579,55 @@ void SettingsMode::DisplayChordDisplaySelection()
     }            
 }
 
+void SettingsMode::DisplayTuningSelection()
+{
+    Display  *pDisplay  = Display::Instance();
+    unsigned tuning     = m_AppConfig.m_Tuning;
+    char     dispBuf[17];
+        
+    pDisplay->DispLcd(Strings::GetTuningString(tuning, dispBuf), false, 1, 0);    
+}
+
+void SettingsMode::DisplayCapoSelection()
+{
+    Display  *pDisplay  = Display::Instance();
+    unsigned capo       = m_AppConfig.m_Capo;
+    
+    if (capo == 0)
+    {
+        pDisplay->DispLcdProgmem(F("  NONE  "), false, 1, 4);
+    }
+    else
+    {
+        pDisplay->DispLcdProgmem(F("FRET    "), false, 1, 4);
+        pDisplay->DispLcdInt(capo, false, 1, 9);
+    }
+}
+
+void SettingsMode::DisplayHandednessSelection()
+{
+    Display  *pDisplay   = Display::Instance();
+    bool     savedOption = pDisplay->GetLeftHanded();
+    ChordChartData       chordData;
+    
+    if (m_AppConfig.m_LeftHanded)
+    {
+        pDisplay->DispLcdProgmem(F(" LEFT HANDED "), false, 1, 1);
+    }
+    else
+    {
+        pDisplay->DispLcdProgmem(F("RIGHT HANDED "), false, 1, 1);
+    }
+    
+    // Temporarily set the current option, and show how a chord will be displayed.
+    pDisplay->SetLeftHanded(m_AppConfig.m_LeftHanded);
+    chordData.GetChord(KeyTypeC, TypeMajor, 0);
+    pDisplay->DisplayLeds(chordData.GetChordView());
+    
+    // Restore the saved option value.
+    pDisplay->SetLeftHanded(savedOption);
+}
+
 void SettingsMode::DisplayUnplayedSelection()
 {
     Display  *pDisplay   = Display::Instance();
@@ -441,7 +644,7 @@ void SettingsMode::DisplayUnplayedSelection()
     
     // Select a chord that has unplayed strings, and show how it will be displayed.
     chordData.GetChord(KeyTypeC, TypeMinorSixth, 0);
-    pDisplay->DisplayLeds(chordData.GetChordPtr());
+    pDisplay->DisplayLeds(chordData.GetChordView());
     
     // Restore the saved unplayed option value.
     pDisplay->SetUnplayedOption(savedOption);    
@@ -508,7 +711,13 @@ void SettingsMode::DistributeSettings()
     // A valid config exists.  Distribute its contents to our application classes.
     pDisplay->SetVerbose(pAppConfig->m_Verbose);
     pDisplay->SetUnplayedOption(pAppConfig->m_UnplayedOption);
+    pDisplay->SetLeftHanded(pAppConfig->m_LeftHanded);
     pDemoMode->SetDisplayOption(pAppConfig->m_DemoDisplayOption);
     pModeManager->SetIrCodeDisplayPermission(pAppConfig->m_IrCodeDispPermission);
     LedDriver::SetDutyCycle(pAppConfig->m_Brightness);
+    ChordFinderMode::Instance()->SetTuning(pAppConfig->m_Tuning);
+    pDemoMode->SetTuning(pAppConfig->m_Tuning);
+    ChordFinderMode::Instance()->SetCapo(pAppConfig->m_Capo);
+    ReverseChordFinderMode::Instance()->SetCapo(pAppConfig->m_Capo);
+    pDemoMode->SetCapo(pAppConfig->m_Capo);
 }
@@ -63,16 +63,22 @@ private:
       
     // State definitions.
     static const unsigned GETTING_CHORD_DISPLAY_STATE   = 0;
-    static const unsigned GETTING_UNPLAYED_OPTION_STATE = 1;
-    static const unsigned GETTING_DEMO_OPTION_STATE     = 2;
-    static const unsigned GETTING_BRIGHTNESS_STATE      = 3;
-    static const unsigned GETTING_IR_PERMISSION_STATE   = 4;
-    static const unsigned SAVING_TO_EEPROM_STATE        = 5;
+    static const unsigned GETTING_TUNING_STATE          = 1;
+    static const unsigned GETTING_CAPO_STATE            = 2;
+    static const unsigned GETTING_HANDEDNESS_STATE      = 3;
+    static const unsigned GETTING_UNPLAYED_OPTION_STATE = 4;
+    static const unsigned GETTING_DEMO_OPTION_STATE     = 5;
+    static const unsigned GETTING_BRIGHTNESS_STATE      = 6;
+    static const unsigned GETTING_IR_PERMISSION_STATE   = 7;
+    static const unsigned SAVING_TO_EEPROM_STATE        = 8;
     static const unsigned FIRST_OPTION_STATE            = GETTING_CHORD_DISPLAY_STATE;
     static const unsigned NUMBER_OPTION_STATES          = SAVING_TO_EEPROM_STATE - 1;
     
     // State entry methods.
     void EnterChordDisplayState();
+    void EnterTuningState();
+    void EnterCapoState();
+    void EnterHandednessState();
     void EnterUnplayedState();
     void EnterDemoOptionState();
     void EnterBrightnessState();
@@ -81,6 +87,9 @@ private:
     
     // State handling methods.
     uint32_t HandleGettingChordDisplayDisplay(uint32_t irKey);
+    uint32_t HandleGettingTuning(uint32_t irKey);
+    uint32_t HandleGettingCapo(uint32_t irKey);
+    uint32_t HandleGettingHandedness(uint32_t irKey);
     uint32_t HandleGettingUnplayedOption(uint32_t irKey);
     uint32_t HandleGettingDemoOption(uint32_t irKey);
     uint32_t HandleGettingBrightness(uint32_t irKey);
@@ -89,6 +98,9 @@ private:
     
     // Option setting string display methods.
     void DisplayChordDisplaySelection();
+    void DisplayTuningSelection();
+    void DisplayCapoSelection();
+    void DisplayHandednessSelection();
     void DisplayUnplayedSelection();
     void DisplayDemoSelection();
     void DisplayBrightnessSelection();
@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////////
+// SpiFlashDevice.cpp
+//
+// Contains methods defined by the SpiFlashDevice class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordTableConfig.h"       // For CHORD_EXTERNAL_STORE.
+
+#if CHORD_EXTERNAL_STORE
+
+#include <SPI.h>                    // For SPI support.
+#include "Arduino.h"                // For Arduino specific definitions.
+#include "SpiFlashDevice.h"
+
+
+// Set up the SPI bus and deselect the chip.
+void SpiFlashDevice::Initialize()
+{
+    pinMode(m_CsPin, OUTPUT);
+    digitalWrite(m_CsPin, HIGH);
+    SPI.begin();
+    m_Initialized = true;
+}
+
+
+// Read one block from the chip.  The chip streams out consecutive bytes for
+// as long as it stays selected, so a block is a single command.
+// block - Block number.
+// pBuf  - Buffer that receives BLOCK_SIZE bytes.
+bool SpiFlashDevice::Read(uint32_t block, uint8_t *pBuf)
+{
+    if (!m_Initialized)
+    {
+        return false;
+    }
+
+    uint32_t address = block * BLOCK_SIZE;
+    SPI.beginTransaction(SPISettings(SPI_CLOCK_HZ, MSBFIRST, SPI_MODE0));
+    digitalWrite(m_CsPin, LOW);
+    SPI.transfer(READ_DATA_COMMAND);
+    SPI.transfer((uint8_t)(address >> 16));
+    SPI.transfer((uint8_t)(address >> 8));
+    SPI.transfer((uint8_t)address);
+    for (uint8_t i = 0; i < BLOCK_SIZE; i++)
+    {
+        pBuf[i] = SPI.transfer(0);
+    }
+    digitalWrite(m_CsPin, HIGH);
+    SPI.endTransaction();
+    return true;
+}
+
+#endif // CHORD_EXTERNAL_STORE
@@ -0,0 +1,63 @@
+/////////////////////////////////////////////////////////////////////////////////
+// SpiFlashDevice.h
+//
+// Defines the SpiFlashDevice class, a BlockDevice that reads an external SPI
+// serial FLASH chip (W25Qxx, AT25DF and compatible).
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined SPIFLASHDEVICE_H
+#define SPIFLASHDEVICE_H
+
+#include "BlockDevice.h"            // For BlockDevice.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// SpiFlashDevice class.  Reads blocks from a serial FLASH chip on the hardware
+// SPI bus, using the standard READ DATA (0x03) command.  The chip must
+// already hold the chord table image written by ChordTableCompiler.
+/////////////////////////////////////////////////////////////////////////////////
+class SpiFlashDevice : public BlockDevice
+{
+public:
+    SpiFlashDevice(uint8_t csPin) : m_CsPin(csPin), m_Initialized(false) { }
+    virtual ~SpiFlashDevice() { }
+
+    // Set up the SPI bus and the chip select pin.  Reads fail until this has
+    // been called.
+    void Initialize();
+
+    virtual bool Read(uint32_t block, uint8_t *pBuf);
+
+protected:
+    
+private:
+    static const uint8_t  READ_DATA_COMMAND = 0x03;     // Read data, 24 bit address.
+    static const uint32_t SPI_CLOCK_HZ      = 8000000;  // Within every chip's
+                                                        // READ DATA limit.
+
+    uint8_t m_CsPin;                    // Chip select (active low) pin.
+    bool    m_Initialized;              // true once Initialize() has been called.
+};
+
+
+
+#endif // SPIFLASHDEVICE_H
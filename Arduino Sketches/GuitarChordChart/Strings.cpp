@@ -195,6 +195,19 @@ static const char* const DemoOptionStrings[] PROGMEM =
 };
 
 
+// Tuning strings, in TuningType order.
+static const char Tuning_00[] PROGMEM = "   STANDARD    ";
+static const char Tuning_01[] PROGMEM = "    DROP D     ";
+static const char Tuning_02[] PROGMEM = "    DADGAD     ";
+static const char Tuning_03[] PROGMEM = "    OPEN G     ";
+
+// An array of pointers to the tuning strings.
+static const char* const TuningStrings[] PROGMEM = 
+{
+    Tuning_00, Tuning_01, Tuning_02, Tuning_03
+};
+
+
 
 
 // An array of pointers to the demo mode state strings.
@@ -345,3 +358,23 @@ char *Strings::GetDemoOptionString(unsigned index, char *pBuf)
     return pBuf;
 }
  
+// This method returns the specified tuning string into the caller's 
+// specified buffer.  The method's return value is the pointer to the caller's
+// buffer that was passed in pBuf if successful.  If the requested index is out
+// of bounds, a NULL is returned.  This can be useful when using the method in
+// a print statement, for example.
+char *Strings::GetTuningString(unsigned index, char *pBuf)
+{
+    // Make sure the tuning value is valid.  If not, return NULL.
+    if (index >= sizeof(TuningStrings) / sizeof(TuningStrings[0]))
+    {
+        return (char *)0;
+    }
+    
+    // Copy the specified string from FLASH into the caller's buffer.
+    strcpy_P(pBuf, (char *)pgm_read_word(&TuningStrings[index]));
+    
+    // Return the caller's buffer pointer.
+    return pBuf;
+}
+ 
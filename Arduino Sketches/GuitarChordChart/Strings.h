@@ -105,6 +105,7 @@ public:
     static char *GetUnplayedOptionString(unsigned index, char *pBuf);
     static char *GetDemoModeString(unsigned index, char *pBuf);
     static char *GetDemoOptionString(unsigned index, char *pBuf);
+    static char *GetTuningString(unsigned index, char *pBuf);
 
 protected:
     
@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////////////
+// VoicingEnumerator.cpp
+//
+// Contains methods defined by the VoicingEnumerator class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "VoicingEnumerator.h"
+
+
+void VoicingEnumerator::SetChord(const uint8_t *pOpenPitches, uint8_t root,
+                                 uint16_t required, uint16_t allowed)
+{
+    for (uint8_t string = 0; string < NUM_STRINGS; string++)
+    {
+        m_Pitches[string] = pOpenPitches[string];
+    }
+    m_Root     = root;
+    m_Required = required;
+    m_Allowed  = allowed | required;
+}
+
+
+void VoicingEnumerator::Enumerate(uint8_t baseFret, Visitor *pVisitor)
+{
+    SearchState state = { 0, 0, 0, 0, 0, NUM_ROWS, 0, 0, 0 };
+
+    m_BaseFret = baseFret;
+    m_pVisitor = pVisitor;
+    SearchString(NUM_STRINGS - 1, state);
+}
+
+
+// Try each value of the specified string, then search the next higher
+// string.
+// string - String to search, from NUM_STRINGS - 1 (low E) down to 0.
+// state  - The search state of the lower strings.
+void VoicingEnumerator::SearchString(int8_t string, SearchState state)
+{
+    if (string < 0)
+    {
+        Finish(state);
+        return;
+    }
+
+    // Give up if the strings that are left can't play the missing tones.
+    if (CountIntervals(m_Required & ~state.m_Intervals) > string + 1)
+    {
+        return;
+    }
+
+    for (uint8_t value = VALUE_OPEN; value <= NUM_ROWS + 1; value++)
+    {
+        SearchState next = state;
+        uint8_t     shift = string * BITS_PER_STRING;
+
+        // The last pass leaves the string unplayed.
+        if (value > NUM_ROWS)
+        {
+            next.m_Shape |= (uint32_t)VALUE_UNPLAYED << shift;
+            next.m_Muted += (state.m_Played != 0);
+            SearchString(string - 1, next);
+            continue;
+        }
+
+        // Only chord tones may be played, and the bass may have to be the root.
+        uint8_t fret     = (value == VALUE_OPEN) ? 0 : m_BaseFret + value - 1;
+        uint8_t interval = GetInterval(string, fret);
+        if (((m_Allowed & (1 << interval)) == 0) ||
+            (m_RootInBass && (state.m_Played == 0) && (interval != 0)))
+        {
+            continue;
+        }
+
+        next.m_Shape      |= (uint32_t)value << shift;
+        next.m_Intervals  |= 1 << interval;
+        next.m_Played++;
+        next.m_InnerMuted += state.m_Muted;
+        next.m_Muted       = 0;
+        if (value != VALUE_OPEN)
+        {
+            next.m_Fretted++;
+            next.m_FirstRow += (value == 1);
+            next.m_LowRow    = (value < next.m_LowRow) ? value : next.m_LowRow;
+            next.m_HighRow   = (value > next.m_HighRow) ? value : next.m_HighRow;
+        }
+
+        // A barre across the starting fret takes one finger.
+        uint8_t fingers = (next.m_FirstRow > 1) ? next.m_Fretted - next.m_FirstRow + 1 :
+                                                  next.m_Fretted;
+        if ((fingers > m_MaxFingers) || (next.m_InnerMuted > MAX_INNER_MUTED) ||
+            ((next.m_Fretted != 0) && (next.m_HighRow - next.m_LowRow > m_MaxStretch)))
+        {
+            continue;
+        }
+        SearchString(string - 1, next);
+    }
+}
+
+
+// Check that a complete voicing is valid, score it, and pass it on.
+void VoicingEnumerator::Finish(const SearchState &rState)
+{
+    // Every voicing frets a string at its starting fret.  Like the chord
+    // table, this leaves out voicings of only open strings.
+    if ((rState.m_FirstRow == 0) || (rState.m_Played < m_MinStrings) ||
+        ((rState.m_Intervals & m_Required) != m_Required))
+    {
+        return;
+    }
+
+    // Prefer more strings, fewer fingers, a smaller stretch, no muted strings
+    // inside the chord, and a position nearer the nut.
+    uint8_t fingers = (rState.m_FirstRow > 1) ? rState.m_Fretted - rState.m_FirstRow + 1 :
+                                                rState.m_Fretted;
+    Voicing voicing;
+    voicing.m_Shape = rState.m_Shape;
+    voicing.m_Fret  = m_BaseFret;
+    voicing.m_Score = (NUM_STRINGS - rState.m_Played) * 10 + fingers * 5 +
+                      rState.m_HighRow * 4 + rState.m_InnerMuted * 30 + m_BaseFret * 2;
+    m_pVisitor->Visit(voicing);
+}
+
+
+// Return the number of intervals in an interval set.
+uint8_t VoicingEnumerator::CountIntervals(uint16_t intervals)
+{
+    uint8_t count = 0;
+    while (intervals)
+    {
+        intervals &= intervals - 1;
+        count++;
+    }
+    return count;
+}
@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////////////////////////////////////
+// VoicingEnumerator.h
+//
+// Defines the VoicingEnumerator class, which finds every playable voicing of
+// a chord at a starting fret.  This file builds on the host as well as the
+// Arduino.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined VOICINGENUMERATOR_H
+#define VOICINGENUMERATOR_H
+
+#include <stdint.h>                 // For uintxx_t.
+#include "InstrumentProfile.h"      // For Instrument.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// VoicingEnumerator class.  Searches the strings from low E to high E,
+// trying each string unplayed, open, and on each fret of the pattern that
+// plays a chord tone.  A branch is abandoned as soon as it needs too many
+// fingers, too wide a stretch, too many muted strings inside the chord, or
+// can no longer play every required tone.  Each voicing found is scored
+// (lower is better) and handed to a Visitor.
+//
+// The Arduino runs this for one chord at a time (see ChordSynthesizer).  The
+// ChordVoicer host tool runs it for every chord.
+/////////////////////////////////////////////////////////////////////////////////
+class VoicingEnumerator
+{
+public:
+    // A voicing.  The shape is packed like PackedShape (see ChordChartData.h),
+    // high E in the least significant bits.
+    struct Voicing
+    {
+        uint32_t m_Shape;
+        uint8_t  m_Fret;                    // Starting fret.
+        uint8_t  m_Score;                   // Lower is better.
+    };
+
+    // Receives each voicing found.
+    class Visitor
+    {
+    public:
+        virtual ~Visitor() { }
+        virtual void Visit(const Voicing &rVoicing) = 0;
+    };
+
+    VoicingEnumerator() : m_MaxFingers(4), m_MaxStretch(NUM_ROWS - 1), m_MinStrings(3),
+                          m_RootInBass(true) { }
+
+    // Select the chord to enumerate.
+    // pOpenPitches - Pitch class of each open string, high E first.
+    // root         - Pitch class of the chord's root (C = 0).
+    // required     - Intervals that must be played (see ChordFormulas).
+    // allowed      - Intervals that may be played.
+    void SetChord(const uint8_t *pOpenPitches, uint8_t root, uint16_t required,
+                  uint16_t allowed);
+
+    // Set the playability limits.  The defaults suit the Arduino.
+    void SetLimits(uint8_t maxFingers, uint8_t maxStretch, uint8_t minStrings,
+                   bool rootInBass)
+    {
+        m_MaxFingers = maxFingers;
+        m_MaxStretch = maxStretch;
+        m_MinStrings = minStrings;
+        m_RootInBass = rootInBass;
+    }
+
+    // Find every voicing that frets a string at the starting fret.
+    void Enumerate(uint8_t baseFret, Visitor *pVisitor);
+
+    static const uint8_t NUM_STRINGS     = Instrument::NUM_STRINGS;
+    static const uint8_t NUM_ROWS        = Instrument::NUM_FRETS - 1;
+                                                // Frets a voicing may span.  The
+                                                // display's last fret is reserved
+                                                // for unplayed strings.
+    static const uint8_t MAX_BASE_FRET   = 12;  // Highest useful starting fret.
+    static const uint8_t VALUE_OPEN      = 0;   // Packed string values.  Fretted
+    static const uint8_t VALUE_UNPLAYED  = 7;   // strings are 1..NUM_ROWS.
+    static const uint8_t BITS_PER_STRING = 3;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    VoicingEnumerator(const VoicingEnumerator &);
+    VoicingEnumerator &operator=(const VoicingEnumerator &);
+
+    // The search's progress through the strings tried so far.
+    struct SearchState
+    {
+        uint32_t m_Shape;
+        uint16_t m_Intervals;               // Intervals played.
+        uint8_t  m_Played;                  // Strings played.
+        uint8_t  m_Fretted;                 // Strings fretted.
+        uint8_t  m_FirstRow;                // Strings fretted at the starting fret.
+        uint8_t  m_LowRow;                  // Range of fretted rows.
+        uint8_t  m_HighRow;
+        uint8_t  m_Muted;                   // Unplayed strings since the last played one.
+        uint8_t  m_InnerMuted;              // Unplayed strings inside the chord.
+    };
+
+    void    SearchString(int8_t string, SearchState state);
+    void    Finish(const SearchState &rState);
+    uint8_t GetInterval(uint8_t string, uint8_t fret) const
+    {
+        return (m_Pitches[string] + fret + 12 - m_Root) % 12;
+    }
+    static uint8_t CountIntervals(uint16_t intervals);
+
+    static const uint8_t MAX_INNER_MUTED = 1;
+
+    uint8_t  m_Pitches[NUM_STRINGS];
+    uint8_t  m_Root;
+    uint16_t m_Required;
+    uint16_t m_Allowed;
+    uint8_t  m_MaxFingers;
+    uint8_t  m_MaxStretch;
+    uint8_t  m_MinStrings;
+    bool     m_RootInBass;
+    uint8_t  m_BaseFret;
+    Visitor *m_pVisitor;
+};
+
+#endif // VOICINGENUMERATOR_H
@@ -0,0 +1,320 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordCacheBench.cpp
+//
+// Contains main() for the chord cache benchmark.  This host (Linux) program
+// reads a chord table image (see ChordStore.h in the sketch) through the
+// sketch's PageCache, using a file in place of the SPI FLASH chip, and
+// reports the cache hit rate and lookup latency of typical browsing patterns.
+//
+// Usage: ChordCacheBench <image>
+//        ChordCacheBench --generate <voicings per key> <image>
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "FileBlockDevice.h"
+#include "PageCache.h"              // From the sketch.
+
+
+// These must match ChordStore.h and ChordChartData.h in the sketch.
+static const unsigned IMAGE_HEADER_SIZE  = 16;
+static const unsigned SHAPE_SIZE         = 3;
+static const unsigned NUM_STRINGS        = 6;
+
+// Each SPI block read sends a 4 byte command and address, then the block, at
+// the sketch's 8 MHz SPI clock.
+static const double SPI_BLOCK_MICROS = (4 + BlockDevice::BLOCK_SIZE) * 8 / 8.0;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ImageLayout structure.  The counts from an image header, and the address of
+// each table.
+/////////////////////////////////////////////////////////////////////////////////
+struct ImageLayout
+{
+    unsigned m_NumVoicings;
+    unsigned m_NumShapes;
+    unsigned m_NumKeys;
+    unsigned m_NumTypes;
+    uint32_t m_Shapes;
+    uint32_t m_ShapeIds;
+    uint32_t m_Frets;
+    uint32_t m_Offsets;
+    std::vector<unsigned> m_NumVariations;  // Per key and type, from the offsets.
+
+    unsigned GetNumVariations(unsigned key, unsigned type) const
+    {
+        return m_NumVariations[key * m_NumTypes + type];
+    }
+};
+
+
+// Read the image header through the cache.  Returns true if it's a chord
+// table image.
+static bool ReadLayout(PageCache &rCache, ImageLayout &rLayout)
+{
+    if ((rCache.ReadByte(0) != 'G') || (rCache.ReadByte(1) != 'C') ||
+        (rCache.ReadByte(2) != 'C') || (rCache.ReadByte(3) != 'T'))
+    {
+        return false;
+    }
+    rLayout.m_NumVoicings      = rCache.ReadWord(4);
+    rLayout.m_NumShapes        = rCache.ReadWord(6);
+    rLayout.m_NumKeys          = rCache.ReadByte(8);
+    rLayout.m_NumTypes         = rCache.ReadByte(9);
+    rLayout.m_Shapes           = IMAGE_HEADER_SIZE;
+    rLayout.m_ShapeIds         = rLayout.m_Shapes + rLayout.m_NumShapes * SHAPE_SIZE;
+    rLayout.m_Frets            = rLayout.m_ShapeIds + rLayout.m_NumVoicings;
+    rLayout.m_Offsets          = rLayout.m_Frets + (rLayout.m_NumVoicings + 1) / 2;
+
+    // Each key and type has its own number of variations.  The offsets table
+    // ends with the number of voicings.
+    rLayout.m_NumVariations.clear();
+    for (unsigned i = 0; i < rLayout.m_NumKeys * rLayout.m_NumTypes; i++)
+    {
+        uint32_t address = rLayout.m_Offsets + i * sizeof(uint16_t);
+        rLayout.m_NumVariations.push_back(rCache.ReadWord(address + sizeof(uint16_t)) -
+                                          rCache.ReadWord(address));
+    }
+    return true;
+}
+
+
+// Read a voicing the way the sketch displays it: the starting fret, then the
+// shape once for the unplayed strings and once for each fret (see ChordView).
+// Returns a checksum so the reads can't be optimized away.
+static unsigned ReadVoicing(PageCache &rCache, const ImageLayout &rLayout, unsigned voicing)
+{
+    unsigned sum = rCache.ReadByte(rLayout.m_Frets + voicing / 2);
+    for (unsigned pass = 0; pass < NUM_STRINGS; pass++)
+    {
+        uint32_t shape = rLayout.m_Shapes + rCache.ReadByte(rLayout.m_ShapeIds + voicing) * SHAPE_SIZE;
+        for (unsigned i = 0; i < SHAPE_SIZE; i++)
+        {
+            sum += rCache.ReadByte(shape + i);
+        }
+    }
+    return sum;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// Benchmark class.  Runs one access pattern and reports it.
+/////////////////////////////////////////////////////////////////////////////////
+class Benchmark
+{
+public:
+    Benchmark(FileBlockDevice &rDevice, PageCache &rCache, const ImageLayout &rLayout) :
+        m_rDevice(rDevice), m_rCache(rCache), m_rLayout(rLayout), m_Sum(0) { }
+
+    void Run(const char *pName, const std::vector<unsigned> &rVoicings, bool lookup);
+
+    static void PrintHeading();
+
+private:
+    FileBlockDevice   &m_rDevice;
+    PageCache         &m_rCache;
+    const ImageLayout &m_rLayout;
+    unsigned           m_Sum;
+};
+
+void Benchmark::PrintHeading()
+{
+    printf("%-16s %8s %9s %10s %9s %11s %9s %10s\n", "pattern", "chords", "hit rate",
+           "bytes", "misses", "prefetches", "ns/chord", "SPI ms");
+}
+
+// Read each voicing in the list, from a cold cache.
+// lookup - true to find each voicing through ChordVoicingOffsets[], as
+//          GetChord() does.
+void Benchmark::Run(const char *pName, const std::vector<unsigned> &rVoicings, bool lookup)
+{
+    m_rCache.Invalidate();
+    m_rDevice.ResetReads();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rVoicings.size(); i++)
+    {
+        unsigned voicing = rVoicings[i];
+        if (lookup)
+        {
+            // The list holds the offset index and the variation.
+            voicing = m_rCache.ReadWord(m_rLayout.m_Offsets + (voicing >> 8) * sizeof(uint16_t)) +
+                      (voicing & 0xff);
+        }
+        m_Sum += ReadVoicing(m_rCache, m_rLayout, voicing);
+    }
+    double nanos = std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - start).count();
+
+    uint32_t bytes = m_rCache.GetHits() + m_rCache.GetMisses();
+    printf("%-16s %8u %8.2f%% %10u %9u %11u %9.1f %10.1f\n", pName,
+           (unsigned)rVoicings.size(), 100.0 * m_rCache.GetHits() / bytes, bytes,
+           m_rCache.GetMisses(), m_rCache.GetPrefetches(), nanos / rVoicings.size(),
+           m_rDevice.GetReads() * SPI_BLOCK_MICROS / 1000.0);
+}
+
+
+// Write a synthetic image with the specified number of voicings per key, so
+// the cache can be measured with a larger library than ChordTable.txt holds.
+static bool Generate(unsigned voicingsPerKey, const char *pPath)
+{
+    const unsigned numKeys = 12;
+    const unsigned numTypes = 36;
+    const unsigned numShapes = 256;
+    unsigned variations = voicingsPerKey / numTypes;
+    unsigned numVoicings = numKeys * numTypes * variations;
+    if ((variations == 0) || (variations > 255) || (numVoicings > 0xffff))
+    {
+        fprintf(stderr, "error: voicings per key must be %u..%u\n", numTypes,
+                0xffff / numKeys);
+        return false;
+    }
+
+    std::vector<uint8_t> image(IMAGE_HEADER_SIZE, 0);
+    memcpy(&image[0], "GCCT", 4);
+    image[4]  = numVoicings & 0xff;
+    image[5]  = numVoicings >> 8;
+    image[6]  = numShapes & 0xff;
+    image[7]  = numShapes >> 8;
+    image[8]  = numKeys;
+    image[9]  = numTypes;
+    image[10] = variations;
+    image[12] = 9;
+    image[13] = 6;
+    image[14] = 4;
+
+    srand(1);
+    for (unsigned i = 0; i < numShapes * SHAPE_SIZE; i++)
+    {
+        image.push_back(rand() & 0xff);
+    }
+    for (unsigned i = 0; i < numVoicings; i++)
+    {
+        image.push_back(rand() % numShapes);
+    }
+    for (unsigned i = 0; i < (numVoicings + 1) / 2; i++)
+    {
+        image.push_back(rand() & 0xff);
+    }
+    for (unsigned i = 0; i <= numKeys * numTypes; i++)
+    {
+        image.push_back((i * variations) & 0xff);
+        image.push_back((i * variations) >> 8);
+    }
+
+    FILE *pFile = fopen(pPath, "wb");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "%s: error: can't create file\n", pPath);
+        return false;
+    }
+    bool ok = fwrite(&image[0], 1, image.size(), pFile) == image.size();
+    return (fclose(pFile) == 0) && ok;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if ((argc == 4) && (strcmp(argv[1], "--generate") == 0))
+    {
+        return Generate(atoi(argv[2]), argv[3]) ? 0 : 1;
+    }
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <image>\n"
+                        "       %s --generate <voicings per key> <image>\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+
+    FileBlockDevice device;
+    PageCache cache(&device);
+    ImageLayout layout;
+    if (!device.Open(argv[1]))
+    {
+        return 1;
+    }
+    if (!ReadLayout(cache, layout))
+    {
+        fprintf(stderr, "%s: error: not a chord table image\n", argv[1]);
+        return 1;
+    }
+
+    printf("%s: %u voicings (%u per key), %u shapes\n", argv[1], layout.m_NumVoicings,
+           layout.m_NumVoicings / layout.m_NumKeys, layout.m_NumShapes);
+    printf("%u pages of %u bytes (%u bytes of RAM)\n\n", PageCache::NUM_PAGES,
+           BlockDevice::BLOCK_SIZE, PageCache::NUM_PAGES * BlockDevice::BLOCK_SIZE);
+
+    // NextChord() and PreviousChord() walk the voicings in order.
+    std::vector<unsigned> forward;
+    for (unsigned voicing = 0; voicing < layout.m_NumVoicings; voicing++)
+    {
+        forward.push_back(voicing);
+    }
+    std::vector<unsigned> backward(forward.rbegin(), forward.rend());
+
+    // NextKey() keeps the type and variation, and steps the key.  Random
+    // GetChord() calls jump anywhere.  Both look the voicing up first.
+    std::vector<unsigned> byKey;
+    for (unsigned type = 0; type < layout.m_NumTypes; type++)
+    {
+        for (unsigned variation = 0; ; variation++)
+        {
+            // Keys without this variation are skipped, as NextKey() would.
+            bool found = false;
+            for (unsigned key = 0; key < layout.m_NumKeys; key++)
+            {
+                if (variation < layout.GetNumVariations(key, type))
+                {
+                    byKey.push_back(((key * layout.m_NumTypes + type) << 8) | variation);
+                    found = true;
+                }
+            }
+            if (!found)
+            {
+                break;
+            }
+        }
+    }
+    std::vector<unsigned> random;
+    srand(2);
+    for (unsigned i = 0; i < layout.m_NumVoicings; i++)
+    {
+        unsigned key = rand() % layout.m_NumKeys;
+        unsigned type = rand() % layout.m_NumTypes;
+        unsigned variation = rand() % layout.GetNumVariations(key, type);
+        random.push_back(((key * layout.m_NumTypes + type) << 8) | variation);
+    }
+
+    Benchmark benchmark(device, cache, layout);
+    Benchmark::PrintHeading();
+    benchmark.Run("NextChord", forward, false);
+    benchmark.Run("PreviousChord", backward, false);
+    benchmark.Run("NextKey", byKey, true);
+    benchmark.Run("GetChord", random, true);
+    return 0;
+}
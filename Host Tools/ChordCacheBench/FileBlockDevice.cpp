@@ -0,0 +1,62 @@
+/////////////////////////////////////////////////////////////////////////////////
+// FileBlockDevice.cpp
+//
+// Contains methods defined by the FileBlockDevice class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include "FileBlockDevice.h"
+
+
+FileBlockDevice::~FileBlockDevice()
+{
+    if (m_pFile != NULL)
+    {
+        fclose(m_pFile);
+    }
+}
+
+// Open the image file.  Returns true if successful.
+bool FileBlockDevice::Open(const std::string &rPath)
+{
+    m_pFile = fopen(rPath.c_str(), "rb");
+    if (m_pFile == NULL)
+    {
+        fprintf(stderr, "%s: error: can't open file\n", rPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Read one block.  Like erased FLASH, bytes past the end of the file read as
+// 0xff.
+bool FileBlockDevice::Read(uint32_t block, uint8_t *pBuf)
+{
+    if ((m_pFile == NULL) || (fseek(m_pFile, (long)block * BLOCK_SIZE, SEEK_SET) != 0))
+    {
+        return false;
+    }
+    size_t count = fread(pBuf, 1, BLOCK_SIZE, m_pFile);
+    memset(pBuf + count, 0xff, BLOCK_SIZE - count);
+    m_Reads++;
+    return true;
+}
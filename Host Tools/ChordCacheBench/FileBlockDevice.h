@@ -0,0 +1,62 @@
+/////////////////////////////////////////////////////////////////////////////////
+// FileBlockDevice.h
+//
+// Defines the FileBlockDevice class, a BlockDevice that reads a file on the
+// host.  It stands in for the sketch's SpiFlashDevice.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined FILEBLOCKDEVICE_H
+#define FILEBLOCKDEVICE_H
+
+#include <stdio.h>
+#include <string>
+#include "BlockDevice.h"            // For BlockDevice (from the sketch).
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// FileBlockDevice class.  Reads blocks from a chord table image file, and
+// counts the reads so they can be compared with the cost of SPI transfers.
+/////////////////////////////////////////////////////////////////////////////////
+class FileBlockDevice : public BlockDevice
+{
+public:
+    FileBlockDevice() : m_pFile(NULL), m_Reads(0) { }
+    virtual ~FileBlockDevice();
+
+    bool Open(const std::string &rPath);
+    virtual bool Read(uint32_t block, uint8_t *pBuf);
+
+    unsigned long GetReads() const { return m_Reads; }
+    void          ResetReads()     { m_Reads = 0; }
+
+protected:
+
+private:
+    // Unimplemented methods.
+    FileBlockDevice(const FileBlockDevice &);
+    FileBlockDevice &operator=(const FileBlockDevice &);
+
+    FILE         *m_pFile;
+    unsigned long m_Reads;
+};
+
+#endif // FILEBLOCKDEVICE_H
@@ -0,0 +1,375 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordFetchBench.cpp
+//
+// Contains main() for the chord fetch benchmark.  This host (Linux) program
+// fetches every key, type and variation of the chord libraries in
+// ChordTable.txt two ways: from the original unpacked Keys[] array, with the
+// index worked out from the common/supplemental chord counts, and from the
+// packed table the sketch uses now, through ChordVoicingOffsets[].  It checks
+// both give the same chords and reports the time per fetch and the table
+// sizes.
+//
+// Usage: ChordFetchBench <ChordTable.txt>
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "ChordSource.h"            // From ChordTableCompiler.
+#include "ShapeDictionary.h"        // From ChordTableCompiler.
+
+
+// Times the whole key, type and variation space is fetched, so the time is
+// long enough to measure.
+static const unsigned REPEATS = 2000;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// Chord structure.  The original unpacked chord, as it was stored in Keys[]:
+// the starting fret, the unplayed strings, and the strings on each fret.
+/////////////////////////////////////////////////////////////////////////////////
+struct Chord
+{
+    uint8_t m_Fret;
+    uint8_t m_Unplayed;
+    uint8_t m_Chord[NUM_CHORD_FRETS];
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// UnpackedTable class.  The original chord table: each key holds every
+// common type with the same number of variations, then every supplemental
+// type with its own number.  Types with fewer variations repeat their last.
+/////////////////////////////////////////////////////////////////////////////////
+class UnpackedTable
+{
+public:
+    void Build(const ChordSource &rSource, unsigned numTypes);
+    size_t GetSize() const { return m_Keys.size() * sizeof(Chord); }
+
+    // The original ChordChartData::GetChord(): limit the position, then work
+    // out the chord's index and copy it.
+    void GetChord(unsigned key, unsigned type, unsigned variation, Chord &rChord) const
+    {
+        if (key >= NUM_KEYS)
+        {
+            key = NUM_KEYS - 1;
+        }
+        unsigned index = key * m_KeySize;
+        if (type < NUM_COMMON_TYPES)
+        {
+            index += type * m_CommonVariations;
+            if (variation >= m_CommonVariations)
+            {
+                variation = m_CommonVariations - 1;
+            }
+            index += variation;
+        }
+        else
+        {
+            if (type >= m_NumTypes)
+            {
+                type = m_NumTypes - 1;
+            }
+            index += NUM_COMMON_TYPES * m_CommonVariations +
+                     (type - NUM_COMMON_TYPES) * m_SuppVariations;
+            if (variation >= m_SuppVariations)
+            {
+                variation = m_SuppVariations - 1;
+            }
+            index += variation;
+        }
+        memcpy(&rChord, &m_Keys[index], sizeof(Chord));
+    }
+
+protected:
+
+private:
+    std::vector<Chord> m_Keys;
+    unsigned           m_NumTypes;
+    unsigned           m_CommonVariations;
+    unsigned           m_SuppVariations;
+    unsigned           m_KeySize;           // Chords per key.
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// PackedTable class.  The chord table as ChordTableCompiler writes it: the
+// first voicing of each key and type, a one byte shape id and a 4 bit
+// starting fret per voicing, and the packed shapes.
+/////////////////////////////////////////////////////////////////////////////////
+class PackedTable
+{
+public:
+    bool Build(const ChordSource &rSource, unsigned numTypes);
+    size_t GetSize() const
+    {
+        return m_Offsets.size() * sizeof(uint16_t) + m_ShapeIds.size() +
+               m_Frets.size() + m_Shapes.size();
+    }
+
+    // ChordChartData::GetChord() and ChordView: limit the position, find the
+    // voicing through the offsets, and decode its fret and strings.
+    void GetChord(unsigned key, unsigned type, unsigned variation, Chord &rChord) const
+    {
+        key  = (key < NUM_KEYS) ? key : NUM_KEYS - 1;
+        type = (type < m_NumTypes) ? type : m_NumTypes - 1;
+        unsigned index = key * m_NumTypes + type;
+        unsigned numVariations = m_Offsets[index + 1] - m_Offsets[index];
+        variation = (variation < numVariations) ? variation : numVariations - 1;
+        unsigned voicing = m_Offsets[index] + variation;
+
+        uint8_t frets = m_Frets[voicing / 2];
+        rChord.m_Fret = (voicing & 1) ? (frets >> 4) : (frets & 0x0f);
+
+        const uint8_t *pShape = &m_Shapes[m_ShapeIds[voicing] * SHAPE_SIZE];
+        uint32_t bits = (uint32_t)pShape[0] | ((uint32_t)pShape[1] << 8) |
+                        ((uint32_t)pShape[2] << 16);
+        memset(rChord.m_Chord, 0, sizeof(rChord.m_Chord));
+        rChord.m_Unplayed = 0;
+        for (unsigned string = 0; string < NUM_STRINGS; string++)
+        {
+            unsigned offset = bits & ((1 << BITS_PER_STRING) - 1);
+            if (offset == PACKED_UNPLAYED)
+            {
+                rChord.m_Unplayed |= 1 << string;
+            }
+            else if (offset != 0)
+            {
+                rChord.m_Chord[offset - 1] |= 1 << string;
+            }
+            bits >>= BITS_PER_STRING;
+        }
+    }
+
+protected:
+
+private:
+    static const unsigned SHAPE_SIZE = 3;   // Bytes per packed shape.
+
+    std::vector<uint16_t> m_Offsets;
+    std::vector<uint8_t>  m_ShapeIds;
+    std::vector<uint8_t>  m_Frets;
+    std::vector<uint8_t>  m_Shapes;
+    unsigned              m_NumTypes;
+};
+
+
+// Return the voicing of a key, type and variation from the source.
+static const ChordEntry &FindEntry(const ChordSource &rSource, unsigned key, unsigned type,
+                                   unsigned variation)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        if ((rEntries[i].m_Key == key) && (rEntries[i].m_Type == type) &&
+            (rEntries[i].m_Variation == variation))
+        {
+            return rEntries[i];
+        }
+    }
+    return rEntries[0];
+}
+
+// Return the unpacked form of a voicing.
+static Chord Unpack(const ChordEntry &rEntry)
+{
+    Chord chord = { };
+    chord.m_Fret = rEntry.GetBaseFret();
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        unsigned offset = rEntry.GetOffset(string);
+        if (offset == PACKED_UNPLAYED)
+        {
+            chord.m_Unplayed |= 1 << string;
+        }
+        else if (offset != 0)
+        {
+            chord.m_Chord[offset - 1] |= 1 << string;
+        }
+    }
+    return chord;
+}
+
+
+// Lay out the library the original way, with the most variations of any
+// common type for every common type, and likewise for supplemental types.
+void UnpackedTable::Build(const ChordSource &rSource, unsigned numTypes)
+{
+    m_NumTypes         = numTypes;
+    m_CommonVariations = 0;
+    m_SuppVariations   = 0;
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < numTypes; type++)
+        {
+            unsigned &rMax = (type < NUM_COMMON_TYPES) ? m_CommonVariations : m_SuppVariations;
+            if (rSource.GetNumVariations(key, type) > rMax)
+            {
+                rMax = rSource.GetNumVariations(key, type);
+            }
+        }
+    }
+    m_KeySize = NUM_COMMON_TYPES * m_CommonVariations +
+                (numTypes - NUM_COMMON_TYPES) * m_SuppVariations;
+
+    m_Keys.clear();
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < numTypes; type++)
+        {
+            unsigned slots = (type < NUM_COMMON_TYPES) ? m_CommonVariations : m_SuppVariations;
+            unsigned count = rSource.GetNumVariations(key, type);
+            for (unsigned variation = 0; variation < slots; variation++)
+            {
+                unsigned stored = (variation < count) ? variation : count - 1;
+                m_Keys.push_back(Unpack(FindEntry(rSource, key, type, stored)));
+            }
+        }
+    }
+}
+
+// Lay out the library the way ChordTableCompiler does.  Returns false if
+// it has too many shapes for one byte shape ids.
+bool PackedTable::Build(const ChordSource &rSource, unsigned numTypes)
+{
+    ShapeDictionary dictionary;
+    if (!dictionary.Build(rSource))
+    {
+        return false;
+    }
+    m_NumTypes = numTypes;
+
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    m_Offsets.clear();
+    m_ShapeIds.clear();
+    m_Frets.assign((rEntries.size() + 1) / 2, 0);
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < numTypes; type++)
+        {
+            m_Offsets.push_back(m_ShapeIds.size());
+            for (unsigned variation = 0; variation < rSource.GetNumVariations(key, type);
+                 variation++)
+            {
+                const ChordEntry &rEntry = FindEntry(rSource, key, type, variation);
+                unsigned voicing = m_ShapeIds.size();
+                m_ShapeIds.push_back(dictionary.GetShapeId(&rEntry - &rEntries[0]));
+                m_Frets[voicing / 2] |= rEntry.GetBaseFret() << ((voicing & 1) ? 4 : 0);
+            }
+        }
+    }
+    m_Offsets.push_back(m_ShapeIds.size());
+
+    m_Shapes.clear();
+    for (unsigned id = 0; id < dictionary.GetNumShapes(); id++)
+    {
+        uint32_t shape = dictionary.GetShape(id);
+        for (unsigned i = 0; i < SHAPE_SIZE; i++)
+        {
+            m_Shapes.push_back((uint8_t)(shape >> (8 * i)));
+        }
+    }
+    return true;
+}
+
+
+// Fetch every key, type and variation, one more variation than any chord
+// has so the limits are taken too.  Returns the time per fetch and a sum of
+// the chords fetched, so the fetches can't be optimized away and the two
+// tables can be compared.
+template <class TABLE>
+static double Fetch(const TABLE &rTable, unsigned numTypes, unsigned numVariations,
+                    unsigned long &rSum)
+{
+    Chord chord;
+    rSum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned repeat = 0; repeat < REPEATS; repeat++)
+    {
+        for (unsigned key = 0; key < NUM_KEYS; key++)
+        {
+            for (unsigned type = 0; type < numTypes; type++)
+            {
+                for (unsigned variation = 0; variation <= numVariations; variation++)
+                {
+                    rTable.GetChord(key, type, variation, chord);
+                    rSum = rSum * 31 + chord.m_Fret + (chord.m_Unplayed << 4);
+                    for (unsigned fret = 0; fret < NUM_PATTERN_FRETS; fret++)
+                    {
+                        rSum = rSum * 31 + chord.m_Chord[fret];
+                    }
+                }
+            }
+        }
+    }
+    double nanos = std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - start).count();
+    return nanos / REPEATS / (NUM_KEYS * numTypes * (numVariations + 1));
+}
+
+// Report both ways of fetching one library.  Returns false if they fetch
+// different chords.
+static bool Measure(const char *pName, const ChordSource &rSource, unsigned numTypes)
+{
+    UnpackedTable unpacked;
+    PackedTable   packed;
+    unpacked.Build(rSource, numTypes);
+    if (!packed.Build(rSource, numTypes))
+    {
+        return false;
+    }
+
+    unsigned long unpackedSum;
+    unsigned long packedSum;
+    double unpackedNanos = Fetch(unpacked, numTypes, rSource.GetMaxVariations(), unpackedSum);
+    double packedNanos   = Fetch(packed, numTypes, rSource.GetMaxVariations(), packedSum);
+    printf("%-8s %8u %9zu %9.2f %9zu %9.2f  %s\n", pName, (unsigned)rSource.GetEntries().size(),
+           unpacked.GetSize(), unpackedNanos, packed.GetSize(), packedNanos,
+           (unpackedSum == packedSum) ? "same" : "DIFFERENT");
+    return unpackedSum == packedSum;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <ChordTable.txt>\n", argv[0]);
+        return 2;
+    }
+
+    ChordSource full;
+    if (!full.Load(argv[1]))
+    {
+        return 1;
+    }
+    ChordSource reduced(full);
+    reduced.RemoveSuppTypes();
+
+    printf("                     Unpacked            Packed\n");
+    printf("Library  Voicings     Bytes  ns/fetch     Bytes  ns/fetch  Chords\n");
+    bool same = Measure("reduced", reduced, NUM_COMMON_TYPES);
+    same = Measure("full", full, NUM_TYPES) && same;
+    return same ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordRankBench.cpp
+//
+// Contains main() for the chord ranking benchmark.  This host (Linux) program
+// runs the sketch's ChordRanker over the chord libraries in ChordTable.txt, as
+// the reverse chord finder does when no chord matches the pattern entered.
+// Each query is a voicing with one finger moved a fret, the way a pattern is
+// usually mistyped.  It reports how often the voicing meant is among the
+// chords ranked, and the time a ranking pass over the whole library takes
+// against the time between two IR keys.
+//
+// Usage: ChordRankBench <ChordTable.txt>
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "ChordRanker.h"            // From the sketch.
+#include "ChordSource.h"            // From ChordTableCompiler.
+
+
+// Times each query is repeated, so the time is long enough to measure.
+static const unsigned REPEATS = 20;
+
+// The sketch's minimum time between IR keys (IR_KEY_DELAY_MILLIS).  A
+// ranking pass started by a key should end before the next key.
+static const double KEY_INTERVAL_MILLIS = 200.0;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// RankCost structure.  The results of ranking a library for every query.
+/////////////////////////////////////////////////////////////////////////////////
+struct RankCost
+{
+    double m_Found;                     // Fraction of queries that ranked the
+                                        // voicing meant.
+    double m_Rank;                      // Its average rank, from 1, when found.
+    double m_Nanos;                     // Time per ranking pass.
+};
+
+
+// Return the fingerboard pattern of a voicing, as the sketch reads it from
+// the chord table.
+static ChordRanker::Pattern GetPattern(const ChordEntry &rEntry)
+{
+    ChordRanker::Pattern pattern = { };
+    pattern.m_Fret = rEntry.GetBaseFret();
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        unsigned offset = rEntry.GetOffset(string);
+        if (offset == PACKED_UNPLAYED)
+        {
+            pattern.m_Unplayed |= 1 << string;
+        }
+        else if (offset != 0)
+        {
+            pattern.m_Rows[offset - 1] |= 1 << string;
+        }
+    }
+    return pattern;
+}
+
+// Return a voicing's pattern with one finger moved a fret: the first
+// fretted string from the query number moves up a fret, or down if it is on
+// the last row.  The pattern is normalized like the reverse chord finder's,
+// so its first row has a string on it.  With anyFret, its fret is 0.
+static ChordRanker::Pattern GetQuery(const ChordEntry &rEntry, unsigned query, bool anyFret)
+{
+    ChordRanker::Pattern pattern = GetPattern(rEntry);
+    for (unsigned i = 0; i < NUM_STRINGS; i++)
+    {
+        uint8_t bit = 1 << ((query + i) % NUM_STRINGS);
+        for (unsigned row = 0; row < ChordRanker::NUM_ROWS; row++)
+        {
+            if ((pattern.m_Rows[row] & bit) != 0)
+            {
+                unsigned moved = (row + 1 < ChordRanker::NUM_ROWS) ? row + 1 : row - 1;
+                pattern.m_Rows[row]   &= ~bit;
+                pattern.m_Rows[moved] |= bit;
+                i = NUM_STRINGS;
+                break;
+            }
+        }
+    }
+    while ((pattern.m_Rows[0] == 0) &&
+           ((pattern.m_Rows[1] | pattern.m_Rows[2] | pattern.m_Rows[3]) != 0))
+    {
+        for (unsigned row = 0; row + 1 < ChordRanker::NUM_ROWS; row++)
+        {
+            pattern.m_Rows[row] = pattern.m_Rows[row + 1];
+        }
+        pattern.m_Rows[ChordRanker::NUM_ROWS - 1] = 0;
+        pattern.m_Fret++;
+    }
+    if (anyFret)
+    {
+        pattern.m_Fret = 0;
+    }
+    return pattern;
+}
+
+// Rank the whole library for a mistyped pattern of every voicing.
+static RankCost Rank(const std::vector<ChordRanker::Pattern> &rPatterns,
+                     const std::vector<ChordEntry> &rEntries, bool anyFret)
+{
+    ChordRanker ranker;
+    unsigned long found = 0;
+    unsigned long ranks = 0;
+    double        nanos = 0;
+
+    for (size_t query = 0; query < rEntries.size(); query++)
+    {
+        ChordRanker::Pattern target = GetQuery(rEntries[query], query, anyFret);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (unsigned repeat = 0; repeat < REPEATS; repeat++)
+        {
+            ranker.Start(target, (1 << NUM_STRINGS) - 1);
+            for (size_t i = 0; i < rPatterns.size(); i++)
+            {
+                ranker.Add(i, rPatterns[i]);
+            }
+            ranker.Finish();
+        }
+        nanos += std::chrono::duration<double, std::nano>(
+                     std::chrono::steady_clock::now() - start).count();
+
+        // Voicings that look the same count as the one meant.
+        for (uint8_t rank = 0; rank < ranker.GetNumResults(); rank++)
+        {
+            const ChordEntry &rResult = rEntries[ranker.GetResult(rank).m_Id];
+            if (memcmp(rResult.m_Frets, rEntries[query].m_Frets, sizeof(rResult.m_Frets)) == 0)
+            {
+                found++;
+                ranks += rank + 1;
+                break;
+            }
+        }
+    }
+
+    RankCost cost = { (double)found / rEntries.size(), (double)ranks / found,
+                      nanos / REPEATS / rEntries.size() };
+    return cost;
+}
+
+// Report the ranking of one library, at the pattern's fret and at any fret.
+static void Measure(const char *pName, const ChordSource &rSource)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    std::vector<ChordRanker::Pattern> patterns;
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        patterns.push_back(GetPattern(rEntries[i]));
+    }
+
+    for (unsigned anyFret = 0; anyFret < 2; anyFret++)
+    {
+        RankCost cost = Rank(patterns, rEntries, anyFret != 0);
+        double   passMillis = cost.m_Nanos / 1e6;
+        printf("%-8s %-5s %8u %7.1f%% %6.2f %10.1f %8.1f %11.0fx\n", pName,
+               anyFret ? "any" : "fixed", (unsigned)rEntries.size(), 100.0 * cost.m_Found,
+               cost.m_Rank, cost.m_Nanos / 1000.0, cost.m_Nanos / rEntries.size(),
+               KEY_INTERVAL_MILLIS / passMillis);
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <ChordTable.txt>\n", argv[0]);
+        return 2;
+    }
+
+    ChordSource full;
+    if (!full.Load(argv[1]))
+    {
+        return 1;
+    }
+    ChordSource reduced(full);
+    reduced.RemoveSuppTypes();
+
+    printf("Top %u of the library, %.0f ms between IR keys\n", ChordRanker::MAX_RESULTS,
+           KEY_INTERVAL_MILLIS);
+    printf("Library  Fret  Voicings   Found   Rank   us/pass ns/chord    Headroom\n");
+    Measure("reduced", reduced);
+    Measure("full", full);
+    return 0;
+}
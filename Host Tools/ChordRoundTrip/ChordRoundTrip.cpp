@@ -0,0 +1,571 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordRoundTrip.cpp
+//
+// Contains main() for the chord table round trip check.  This host (Linux)
+// program decodes every voicing of a chord pack written by ChordTableCompiler
+// (ChordTableReduced.bin or ChordTableFull.bin) through its voicing offsets,
+// shape dictionary and starting fret nibbles, and checks that each chord of
+// the original hand written Keys[] table comes back bit for bit.
+//
+// Usage: ChordRoundTrip <pack.bin>...
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "ChordSource.h"            // From ChordTableCompiler.
+
+
+// The original table had 2 variations of each common type, 7 bytes each.
+static const unsigned ORIGINAL_VARIATIONS = 2;
+static const unsigned ORIGINAL_CHORD_SIZE = 2 + NUM_CHORD_FRETS;
+
+// Bytes in a pack header (see ChordStore.h).
+static const unsigned PACK_HEADER_SIZE = 16;
+static const unsigned PACK_SHAPE_SIZE  = 3;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// Chord structure.  The original unpacked chord, as it was stored in Keys[]:
+// the starting fret, the unplayed strings, and the strings on each fret.
+/////////////////////////////////////////////////////////////////////////////////
+struct Chord
+{
+    uint8_t m_Fret;
+    uint8_t m_Unplayed;
+    uint8_t m_Chord[NUM_CHORD_FRETS];
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+// The original chord table, copied unchanged from ChordChartData.cpp as it
+// was before the chords were packed.
+///////////////////////////////////////////////////////////////////////////////
+static const uint8_t Keys[NUM_KEYS * NUM_COMMON_TYPES * ORIGINAL_VARIATIONS *
+                          ORIGINAL_CHORD_SIZE] =
+///////////////////////////////////////////////////////////////////////////////
+{
+///////////////////////////////////////////////////////////////////////////////
+// C
+///////////////////////////////////////////////////////////////////////////////
+
+    // C Major
+    1, 0x00, 0x02, 0x08, 0x30, 0x00, 0x00,     3, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
+
+    // C Minor
+    1, 0x30, 0x0a, 0x00, 0x01, 0x00, 0x00,     3, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,
+
+    // C Sixth
+    1, 0x00, 0x02, 0x0c, 0x01, 0x00, 0x00,     5, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,
+
+    // C Minor Sixth
+    1, 0x20, 0x0a, 0x00, 0x01, 0x00, 0x00,     4, 0x30, 0x02, 0x0d, 0x00, 0x00, 0x00,
+
+    // C Seventh
+    1, 0x00, 0x02, 0x08, 0x34, 0x00, 0x00,     3, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,
+
+    // C Major Seventh
+    2, 0x00, 0x08, 0x30, 0x00, 0x00, 0x00,     3, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
+
+    // C Minor Seventh
+    1, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,     3, 0x00, 0x35, 0x02, 0x08, 0x00, 0x00,
+
+    // C Ninth
+    2, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,     5, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// C#
+///////////////////////////////////////////////////////////////////////////////
+
+    // C Sharp Major
+    1, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,     4, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
+
+    // C Sharp Minor
+    1, 0x30, 0x04, 0x0a, 0x00, 0x00, 0x00,     4, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,
+
+    // C Sharp Sixth
+    1, 0x00, 0x34, 0x02, 0x08, 0x01, 0x00,     6, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,
+
+    // C Sharp Minor Sixth
+    1, 0x20, 0x14, 0x0a, 0x00, 0x00, 0x00,     2, 0x20, 0x0a, 0x04, 0x11, 0x00, 0x00,
+
+    // C Sharp Seventh
+    2, 0x30, 0x02, 0x08, 0x05, 0x00, 0x00,     4, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,
+
+    // C Sharp Major Seventh
+    1, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,     4, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
+
+    // C Sharp Minor Seventh
+    1, 0x20, 0x04, 0x08, 0x00, 0x10, 0x00,     2, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,
+
+    // C Sharp Ninth
+    3, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,     6, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// D
+///////////////////////////////////////////////////////////////////////////////
+
+    // D Major
+    2, 0x00, 0x25, 0x02, 0x00, 0x00, 0x00,     5, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
+
+    // D Minor
+    1, 0x00, 0x21, 0x04, 0x02, 0x00, 0x00,     5, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,
+
+    // D Sixth
+    2, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00,     2, 0x00, 0x34, 0x02, 0x08, 0x01, 0x00,
+
+    // D Minor Sixth
+    1, 0x00, 0x21, 0x04, 0x00, 0x00, 0x00,     3, 0x20, 0x0a, 0x04, 0x11, 0x00, 0x00,
+
+    // D Seventh
+    1, 0x00, 0x02, 0x25, 0x00, 0x00, 0x00,     3, 0x30, 0x02, 0x08, 0x05, 0x00, 0x00,
+
+    // D Major Seventh
+    2, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00,     5, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
+
+    // D Minor Seventh
+    1, 0x20, 0x03, 0x04, 0x00, 0x00, 0x00,     3, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,
+
+    // D Ninth
+    1, 0x00, 0x02, 0x24, 0x00, 0x00, 0x00,     4, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// Eb
+///////////////////////////////////////////////////////////////////////////////
+
+    // E Flat Major
+    3, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,     6, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,
+
+    // E Flat Minor
+    1, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,     2, 0x30, 0x01, 0x04, 0x0a, 0x00, 0x00,
+
+    // E Flat Sixth
+    1, 0x20, 0x1a, 0x00, 0x05, 0x00, 0x00,     3, 0x00, 0x34, 0x02, 0x08, 0x01, 0x00,
+
+    // E Flat Minor Sixth
+    1, 0x20, 0x1a, 0x01, 0x04, 0x00, 0x00,     4, 0x20, 0x0a, 0x04, 0x11, 0x00, 0x00,
+
+    // E Flat Seventh
+    1, 0x20, 0x18, 0x02, 0x05, 0x00, 0x00,     4, 0x30, 0x02, 0x08, 0x05, 0x00, 0x00,
+
+    // E Flat Major Seventh
+    3, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,     6, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,
+
+    // E Flat Minor Seventh
+    1, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,     4, 0x20, 0x0a, 0x00, 0x15, 0x00, 0x00,
+
+    // E Flat Ninth
+    1, 0x20, 0x19, 0x02, 0x00, 0x00, 0x00,     1, 0x00, 0x19, 0x02, 0x24, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// E
+///////////////////////////////////////////////////////////////////////////////
+
+    // E Major
+    1, 0x00, 0x04, 0x18, 0x00, 0x00, 0x00,     4, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,
+
+    // E Minor
+    2, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,     2, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
+
+    // E Sixth
+    1, 0x00, 0x04, 0x1a, 0x00, 0x00, 0x00,     2, 0x00, 0x1a, 0x00, 0x05, 0x00, 0x00,
+
+    // E Minor Sixth
+    2, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00,     2, 0x20, 0x1a, 0x01, 0x04, 0x00, 0x00,
+
+    // E Seventh
+    1, 0x00, 0x04, 0x18, 0x02, 0x00, 0x00,     2, 0x00, 0x18, 0x02, 0x05, 0x00, 0x00,
+
+    // E Major Seventh
+    1, 0x00, 0x0c, 0x10, 0x00, 0x00, 0x00,     4, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,
+
+    // E Minor Seventh
+    2, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,     2, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
+
+    // E Ninth
+    1, 0x00, 0x04, 0x11, 0x00, 0x00, 0x00,     2, 0x00, 0x19, 0x02, 0x24, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// F
+///////////////////////////////////////////////////////////////////////////////
+
+    // F Major
+    1, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,     5, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,
+
+    // F Minor
+    1, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     3, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
+
+    // F Sixth
+    1, 0x00, 0x23, 0x04, 0x00, 0x00, 0x00,     3, 0x20, 0x1a, 0x00, 0x05, 0x00, 0x00,
+
+    // F Minor Sixth
+    1, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00,     1, 0x00, 0x25, 0x00, 0x1a, 0x00, 0x00,
+
+    // F Seventh
+    1, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,     3, 0x20, 0x18, 0x02, 0x05, 0x00, 0x00,
+
+    // F Major Seventh
+    1, 0x00, 0x22, 0x04, 0x18, 0x00, 0x00,     5, 0x00, 0x27, 0x00, 0x08, 0x10, 0x00,
+
+    // F Minor Seventh
+    1, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,     3, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
+
+    // F Ninth
+    1, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00,     1, 0x00, 0x2a, 0x04, 0x11, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// F#
+///////////////////////////////////////////////////////////////////////////////
+
+    // F Sharp Major
+    2, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,     6, 0x00, 0x25, 0x02, 0x08, 0x10, 0x00,
+
+    // F Sharp Minor
+    2, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     4, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
+
+    // F Sharp Sixth
+    1, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,     4, 0x20, 0x1a, 0x00, 0x05, 0x00, 0x00,
+
+    // F Sharp Minor Sixth
+    1, 0x00, 0x08, 0x27, 0x00, 0x00, 0x00,     2, 0x00, 0x25, 0x00, 0x1a, 0x00, 0x00,
+
+    // F Sharp Seventh
+    2, 0x00, 0x22, 0x04, 0x18, 0x00, 0x00,     2, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
+
+    // F Sharp Major Seventh
+    1, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,     2, 0x00, 0x23, 0x0c, 0x10, 0x00, 0x00,
+
+    // F Sharp Minor Seventh
+    2, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,     4, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
+
+    // F Sharp Ninth
+    1, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,     2, 0x00, 0x2a, 0x04, 0x11, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// G
+///////////////////////////////////////////////////////////////////////////////
+
+    // G Major
+    2, 0x00, 0x10, 0x21, 0x00, 0x00, 0x00,     3, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,
+
+    // G Minor
+    3, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     5, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
+
+    // G Sixth
+    2, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00,     3, 0x00, 0x22, 0x04, 0x18, 0x00, 0x00,
+
+    // G Minor Sixth
+    1, 0x20, 0x10, 0x08, 0x02, 0x00, 0x00,     2, 0x30, 0x08, 0x07, 0x00, 0x00, 0x00,
+
+    // G Seventh
+    1, 0x00, 0x01, 0x10, 0x20, 0x00, 0x00,     3, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
+
+    // G Major Seventh
+    2, 0x00, 0x11, 0x20, 0x00, 0x00, 0x00,     2, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,
+
+    // G Minor Seventh
+    3, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,     5, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
+
+    // G Ninth
+    1, 0x00, 0x01, 0x14, 0x20, 0x00, 0x00,     2, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// Ab
+///////////////////////////////////////////////////////////////////////////////
+
+    // A Flat Major
+    1, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,     4, 0x00, 0x23, 0x04, 0x18, 0x00, 0x00,
+
+    // A Flat Minor
+    4, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,     6, 0x20, 0x18, 0x01, 0x04, 0x02, 0x00,
+
+    // A Flat Sixth
+    1, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,     3, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
+
+    // A Flat Minor Sixth
+    1, 0x00, 0x2d, 0x10, 0x00, 0x00, 0x00,     3, 0x30, 0x08, 0x07, 0x00, 0x00, 0x00,
+
+    // A Flat Seventh
+    1, 0x30, 0x0e, 0x01, 0x00, 0x00, 0x00,     4, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
+
+    // A Flat Major Seventh
+    1, 0x20, 0x0e, 0x00, 0x11, 0x00, 0x00,     3, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,
+
+    // A Flat Minor Seventh
+    1, 0x30, 0x0c, 0x01, 0x00, 0x00, 0x00,     4, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,
+
+    // A Flat Ninth
+    1, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,     3, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// A
+///////////////////////////////////////////////////////////////////////////////
+
+    // A Major
+    2, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,     2, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,
+
+    // A Minor
+    1, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00,     5, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,
+
+    // A Sixth
+    2, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,     4, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
+
+    // A Minor Sixth
+    1, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00,     4, 0x20, 0x08, 0x07, 0x00, 0x00, 0x00,
+
+    // A Seventh
+    2, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,     5, 0x00, 0x29, 0x04, 0x10, 0x02, 0x00,
+
+    // A Major Seventh
+    1, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00,     4, 0x20, 0x11, 0x02, 0x04, 0x08, 0x00,
+
+    // A Minor Seventh
+    1, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00,     5, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,
+
+    // A Ninth
+    2, 0x00, 0x0a, 0x01, 0x04, 0x00, 0x00,     4, 0x20, 0x14, 0x0b, 0x00, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// Bb
+///////////////////////////////////////////////////////////////////////////////
+
+    // B Flat Major
+    1, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,     3, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,
+
+    // B Flat Minor
+    1, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,     6, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,
+
+    // B Flat Sixth
+    3, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,     5, 0x20, 0x18, 0x03, 0x04, 0x00, 0x00,
+
+    // B Flat Minor Sixth
+    2, 0x30, 0x02, 0x0d, 0x00, 0x00, 0x00,     5, 0x30, 0x08, 0x07, 0x00, 0x00, 0x00,
+
+    // B Flat Seventh
+    1, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,     3, 0x30, 0x0e, 0x01, 0x00, 0x00, 0x00,
+
+    // B Flat Major Seventh
+    1, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,     3, 0x20, 0x0e, 0x00, 0x11, 0x00, 0x00,
+
+    // B Flat Minor Seventh
+    1, 0x00, 0x35, 0x02, 0x08, 0x00, 0x00,     6, 0x00, 0x2f, 0x00, 0x10, 0x00, 0x00,
+
+    // B Flat Ninth
+    1, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00,     3, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00,
+
+///////////////////////////////////////////////////////////////////////////////
+// B
+///////////////////////////////////////////////////////////////////////////////
+
+    // B Major
+    2, 0x00, 0x31, 0x00, 0x0e, 0x00, 0x00,     4, 0x00, 0x0e, 0x00, 0x10, 0x21, 0x00,
+
+    // B Minor
+    2, 0x00, 0x31, 0x02, 0x0c, 0x00, 0x00,     7, 0x00, 0x27, 0x00, 0x18, 0x00, 0x00,
+
+    // B Sixth
+    1, 0x30, 0x0c, 0x01, 0x00, 0x00, 0x00,     4, 0x00, 0x0f, 0x00, 0x10, 0x20, 0x00,
+
+    // B Minor Sixth
+    1, 0x00, 0x04, 0x31, 0x00, 0x00, 0x00,     3, 0x30, 0x02, 0x0d, 0x00, 0x00, 0x00,
+
+    // B Seventh
+    1, 0x00, 0x08, 0x35, 0x00, 0x00, 0x00,     2, 0x00, 0x35, 0x00, 0x0a, 0x00, 0x00,
+
+    // B Major Seventh
+    2, 0x00, 0x31, 0x04, 0x0a, 0x00, 0x00,     4, 0x20, 0x0e, 0x00, 0x11, 0x00, 0x00,
+
+    // B Minor Seventh
+    2, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00,     2, 0x00, 0x35, 0x02, 0x08, 0x00, 0x00,
+
+    // B Ninth
+    1, 0x00, 0x08, 0x37, 0x00, 0x00, 0x00,     4, 0x20, 0x1e, 0x01, 0x00, 0x00, 0x00
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// Pack class.  A chord pack read into memory, and the tables the sketch
+// fetches a chord through.
+/////////////////////////////////////////////////////////////////////////////////
+class Pack
+{
+public:
+    bool Load(const char *pPath);
+
+    // ChordChartData::GetChord() and ChordView: find the voicing through the
+    // offsets, and decode its starting fret and shape.  Returns false if the
+    // key and type don't have the variation.
+    bool GetChord(unsigned key, unsigned type, unsigned variation, Chord &rChord) const
+    {
+        unsigned index = key * m_NumTypes + type;
+        if (variation >= ReadWord(m_Offsets, index + 1) - ReadWord(m_Offsets, index))
+        {
+            return false;
+        }
+        unsigned voicing = ReadWord(m_Offsets, index) + variation;
+
+        uint8_t frets = m_Bytes[m_Frets + voicing / 2];
+        rChord.m_Fret = (voicing & 1) ? (frets >> 4) : (frets & 0x0f);
+
+        const uint8_t *pShape = &m_Bytes[m_Shapes + m_Bytes[m_ShapeIds + voicing] *
+                                         PACK_SHAPE_SIZE];
+        uint32_t bits = (uint32_t)pShape[0] | ((uint32_t)pShape[1] << 8) |
+                        ((uint32_t)pShape[2] << 16);
+        memset(rChord.m_Chord, 0, sizeof(rChord.m_Chord));
+        rChord.m_Unplayed = 0;
+        for (unsigned string = 0; string < NUM_STRINGS; string++)
+        {
+            unsigned offset = bits & ((1 << BITS_PER_STRING) - 1);
+            if (offset == PACKED_UNPLAYED)
+            {
+                rChord.m_Unplayed |= 1 << string;
+            }
+            else if (offset > NUM_CHORD_FRETS)
+            {
+                return false;
+            }
+            else if (offset != 0)
+            {
+                rChord.m_Chord[offset - 1] |= 1 << string;
+            }
+            bits >>= BITS_PER_STRING;
+        }
+        return true;
+    }
+
+    unsigned GetNumVoicings() const { return m_NumVoicings; }
+
+protected:
+
+private:
+    unsigned ReadWord(size_t table, unsigned index) const
+    {
+        return m_Bytes[table + index * 2] | (m_Bytes[table + index * 2 + 1] << 8);
+    }
+
+    std::vector<uint8_t> m_Bytes;
+    unsigned             m_NumVoicings;
+    unsigned             m_NumTypes;
+    size_t               m_Shapes;          // Offsets of the tables in m_Bytes.
+    size_t               m_ShapeIds;
+    size_t               m_Frets;
+    size_t               m_Offsets;
+};
+
+
+// Read a pack and find its tables.  Returns false if it can't be read or
+// isn't a chord pack.
+bool Pack::Load(const char *pPath)
+{
+    FILE *pFile = fopen(pPath, "rb");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "Can't open %s\n", pPath);
+        return false;
+    }
+    uint8_t buffer[4096];
+    size_t  size;
+    m_Bytes.clear();
+    while ((size = fread(buffer, 1, sizeof(buffer), pFile)) != 0)
+    {
+        m_Bytes.insert(m_Bytes.end(), buffer, buffer + size);
+    }
+    fclose(pFile);
+
+    if ((m_Bytes.size() < PACK_HEADER_SIZE) || (memcmp(&m_Bytes[0], "GCCT", 4) != 0) ||
+        (m_Bytes[8] != NUM_KEYS) || (m_Bytes[9] < NUM_COMMON_TYPES) ||
+        (m_Bytes[13] != NUM_STRINGS))
+    {
+        fprintf(stderr, "%s isn't a chord pack for %u strings\n", pPath, NUM_STRINGS);
+        return false;
+    }
+    m_NumVoicings = m_Bytes[4] | (m_Bytes[5] << 8);
+    m_NumTypes    = m_Bytes[9];
+    m_Shapes      = PACK_HEADER_SIZE;
+    m_ShapeIds    = m_Shapes + (m_Bytes[6] | (m_Bytes[7] << 8)) * PACK_SHAPE_SIZE;
+    m_Frets       = m_ShapeIds + m_NumVoicings;
+    m_Offsets     = m_Frets + (m_NumVoicings + 1) / 2;
+    if (m_Bytes.size() < m_Offsets + (NUM_KEYS * m_NumTypes + 1) * 2)
+    {
+        fprintf(stderr, "%s is truncated\n", pPath);
+        return false;
+    }
+    return true;
+}
+
+
+// Check every chord of the original table against a pack.  Returns false if
+// any doesn't match.
+static bool Check(const char *pPath)
+{
+    Pack pack;
+    if (!pack.Load(pPath))
+    {
+        return false;
+    }
+
+    unsigned mismatches = 0;
+    const uint8_t *pOriginal = Keys;
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < NUM_COMMON_TYPES; type++)
+        {
+            for (unsigned variation = 0; variation < ORIGINAL_VARIATIONS; variation++)
+            {
+                Chord chord;
+                if (!pack.GetChord(key, type, variation, chord) ||
+                    (chord.m_Fret != pOriginal[0]) || (chord.m_Unplayed != pOriginal[1]) ||
+                    (memcmp(chord.m_Chord, &pOriginal[2], NUM_CHORD_FRETS) != 0))
+                {
+                    printf("%s: key %u, type %u, variation %u differs\n", pPath, key, type,
+                           variation);
+                    mismatches++;
+                }
+                pOriginal += ORIGINAL_CHORD_SIZE;
+            }
+        }
+    }
+
+    unsigned numChords = NUM_KEYS * NUM_COMMON_TYPES * ORIGINAL_VARIATIONS;
+    printf("%s: %u voicings, %u of %u original chords match\n", pPath,
+           pack.GetNumVoicings(), numChords - mismatches, numChords);
+    return mismatches == 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <pack.bin>...\n", argv[0]);
+        return 2;
+    }
+
+    bool same = true;
+    for (int arg = 1; arg < argc; arg++)
+    {
+        same = Check(argv[arg]) && same;
+    }
+    return same ? 0 : 1;
+}
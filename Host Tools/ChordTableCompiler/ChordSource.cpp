@@ -0,0 +1,414 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordSource.cpp
+//
+// Contains methods defined by the ChordSource class.  These methods read the
+// chord definition file, and check every entry so that errors are caught when
+// the table is generated rather than on the device.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ChordSource.h"
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+
+// Key names as used in the source file, starting with "C".
+static const char *KeyNames[NUM_KEYS] =
+{
+    "C", "C#", "D", "Eb", "E", "F", "F#", "G", "Ab", "A", "Bb", "B"
+};
+
+// Type names as used in the source file.  These are the short type strings
+// from Strings.cpp, in ChordType order.
+static const char *TypeNames[NUM_TYPES] =
+{
+    "M",     "m",     "6",     "m6",    "7",     "M7",    "m7",     "9",
+    "o",     "+",     "sus2",  "7sus2", "sus4",  "7sus4", "5",      "-5",
+    "7b5",   "m7b5",  "7#5",   "7b9",   "7#9",   "7b9#5", "7/6",    "9b5",
+    "9#5",   "M9",    "m9",    "9/6",   "m9/6",  "add9",  "11",     "m11",
+    "11+",   "13",    "13b9",  "13b9b5"
+};
+
+// Long type names, used for comments in the generated files.
+static const char *TypeLongNames[NUM_TYPES] =
+{
+    "Major",            "Minor",            "6th",              "Minor 6th",
+    "7th",              "Major 7th",        "Minor 7th",        "9th",
+    "Diminished",       "Augmented",        "Suspended 2nd",    "7th Susp. 2nd",
+    "Suspended 4th",    "7th Susp. 4th",    "5th",              "Diminished 5th",
+    "7th Dim. 5th",     "Mnr 7th Dim. 5th", "7th Aug. 5th",     "7th Minor 9th",
+    "7th Aug. 9th",     "7 Minor 9 Aug. 5", "Seven-Six",        "9th Dim. 5th",
+    "9th Aug. 5th",     "Major 9th",        "Minor 9th",        "Nine-Six",
+    "Minor Nine-Six",   "Added 9th",        "11th",             "Minor 11th",
+    "Augmented 11th",   "13th",             "13th Minor 9th",   "13 Minor 9 Dim 5"
+};
+
+
+// Return the starting fret of the chord.  Chords are normalized so that the
+// first displayed fret always contains a fingering position.
+unsigned ChordEntry::GetBaseFret() const
+{
+    unsigned baseFret = 0;
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        if ((m_Frets[string] > 0) &&
+            ((baseFret == 0) || ((unsigned)m_Frets[string] < baseFret)))
+        {
+            baseFret = m_Frets[string];
+        }
+    }
+    return baseFret;
+}
+
+// Return the packed value of a string: 0 for open, 1..NUM_CHORD_FRETS for
+// a fret offset from the base fret, or 7 for unplayed.
+unsigned ChordEntry::GetOffset(unsigned string) const
+{
+    if (m_Frets[string] == UNPLAYED)
+    {
+        return PACKED_UNPLAYED;
+    }
+    if (m_Frets[string] == 0)
+    {
+        return 0;
+    }
+    return m_Frets[string] - GetBaseFret() + 1;
+}
+
+// Return the packed shape of the chord: the offset of each string, high E
+// in the least significant bits.  Chords with the same shape differ only in
+// their starting fret.
+uint32_t ChordEntry::GetShape() const
+{
+    uint32_t shape = 0;
+    for (unsigned string = NUM_STRINGS; string-- != 0; )
+    {
+        shape = (shape << BITS_PER_STRING) | GetOffset(string);
+    }
+    return shape;
+}
+
+
+// Read and validate the specified chord definition file.  Returns true if
+// the file was read and every entry is valid.  Errors are reported on stderr.
+bool ChordSource::Load(const std::string &rPath)
+{
+    m_Path = rPath;
+    m_Entries.clear();
+    m_Errors = 0;
+
+    std::ifstream file(rPath.c_str());
+    if (!file)
+    {
+        fprintf(stderr, "%s: error: can't open file\n", rPath.c_str());
+        return false;
+    }
+
+    // Parse each line, continuing after errors so they are all reported.
+    std::string line;
+    unsigned lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        ParseLine(line, lineNumber);
+    }
+
+    // Put the entries in table order, then check the table as a whole.
+    std::stable_sort(m_Entries.begin(), m_Entries.end(),
+        [](const ChordEntry &rA, const ChordEntry &rB)
+        {
+            if (rA.m_Key != rB.m_Key)
+            {
+                return rA.m_Key < rB.m_Key;
+            }
+            if (rA.m_Type != rB.m_Type)
+            {
+                return rA.m_Type < rB.m_Type;
+            }
+            return rA.m_Variation < rB.m_Variation;
+        });
+    if (m_Errors == 0)
+    {
+        Validate();
+    }
+    return m_Errors == 0;
+}
+
+// Remove the supplemental chord types, leaving only the common types.  This
+// is used to build the reduced chord library.
+void ChordSource::RemoveSuppTypes()
+{
+    std::vector<ChordEntry> entries;
+    for (size_t i = 0; i < m_Entries.size(); i++)
+    {
+        if (m_Entries[i].m_Type < NUM_COMMON_TYPES)
+        {
+            entries.push_back(m_Entries[i]);
+        }
+    }
+    m_Entries.swap(entries);
+    m_NumSuppTypes  = 0;
+    m_MaxVariations = 0;
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < NUM_TYPES; type++)
+        {
+            if (type >= NUM_COMMON_TYPES)
+            {
+                m_NumVariations[key][type] = 0;
+            }
+            m_MaxVariations = std::max(m_MaxVariations, m_NumVariations[key][type]);
+        }
+    }
+}
+
+// Parse a single source line of the form:
+//     <key> <type> <variation> <low E fret> ... <high E fret>
+// Blank lines and comments are ignored.  A comment starts with a '#' at the
+// start of a word, so that names like "C#" and "7#9" can be used.  Frets are
+// absolute fret numbers, 0 for an open string, or 'x' for an unplayed string.
+bool ChordSource::ParseLine(const std::string &rLine, unsigned lineNumber)
+{
+    // Strip comments.
+    size_t comment = rLine.find('#');
+    while ((comment != std::string::npos) && (comment != 0) &&
+           !isspace((unsigned char)rLine[comment - 1]))
+    {
+        comment = rLine.find('#', comment + 1);
+    }
+    std::istringstream fields(rLine.substr(0, comment));
+    std::string keyName;
+    std::string typeName;
+    std::string variation;
+    if (!(fields >> keyName))
+    {
+        // Blank line.
+        return true;
+    }
+    if (!(fields >> typeName >> variation))
+    {
+        Error(lineNumber, "expected <key> <type> <variation> <frets>");
+        return false;
+    }
+
+    ChordEntry entry;
+    entry.m_Line = lineNumber;
+
+    int key = FindKey(keyName);
+    if (key < 0)
+    {
+        Error(lineNumber, "unknown key '%s'", keyName.c_str());
+        return false;
+    }
+    entry.m_Key = key;
+
+    int type = FindType(typeName);
+    if (type < 0)
+    {
+        Error(lineNumber, "unknown chord type '%s'", typeName.c_str());
+        return false;
+    }
+    entry.m_Type = type;
+
+    char *pEnd = NULL;
+    long value = strtol(variation.c_str(), &pEnd, 10);
+    if ((*pEnd != '\0') || (value < 1))
+    {
+        Error(lineNumber, "bad variation number '%s'", variation.c_str());
+        return false;
+    }
+    entry.m_Variation = value - 1;
+
+    // The frets are listed low E first, but are stored high E first to match
+    // the string bit order used by the firmware.
+    for (unsigned i = 0; i < NUM_STRINGS; i++)
+    {
+        std::string fret;
+        if (!(fields >> fret))
+        {
+            Error(lineNumber, "expected %u frets", NUM_STRINGS);
+            return false;
+        }
+        unsigned string = NUM_STRINGS - 1 - i;
+        if ((fret == "x") || (fret == "X"))
+        {
+            entry.m_Frets[string] = UNPLAYED;
+            continue;
+        }
+        value = strtol(fret.c_str(), &pEnd, 10);
+        if ((*pEnd != '\0') || (value < 0) ||
+            (value > (long)(MAX_BASE_FRET + NUM_PATTERN_FRETS - 1)))
+        {
+            Error(lineNumber, "bad fret '%s'", fret.c_str());
+            return false;
+        }
+        entry.m_Frets[string] = value;
+    }
+    std::string extra;
+    if (fields >> extra)
+    {
+        Error(lineNumber, "unexpected text '%s'", extra.c_str());
+        return false;
+    }
+
+    // Check that the chord can be displayed on the fingerboard.
+    unsigned baseFret = entry.GetBaseFret();
+    if (baseFret == 0)
+    {
+        Error(lineNumber, "chord has no fretted strings");
+        return false;
+    }
+    if (baseFret > MAX_BASE_FRET)
+    {
+        Error(lineNumber, "starting fret %u is above %u", baseFret, MAX_BASE_FRET);
+        return false;
+    }
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        if ((entry.m_Frets[string] > 0) &&
+            (entry.GetOffset(string) > NUM_PATTERN_FRETS))
+        {
+            Error(lineNumber, "chord spans more than %u frets", NUM_PATTERN_FRETS);
+            return false;
+        }
+    }
+
+    m_Entries.push_back(entry);
+    return true;
+}
+
+// Check the table as a whole.  Every key must define the same chord types,
+// the common types must all be present, and supplemental types must follow
+// without gaps.  Each key and type may have its own number of variations,
+// from 1 to MAX_VARIATIONS.
+bool ChordSource::Validate()
+{
+    // Count the variations of each key/type.
+    memset(m_NumVariations, 0, sizeof(m_NumVariations));
+    for (size_t i = 0; i < m_Entries.size(); i++)
+    {
+        const ChordEntry &rEntry = m_Entries[i];
+        unsigned &rCount = m_NumVariations[rEntry.m_Key][rEntry.m_Type];
+        if (rEntry.m_Variation != rCount)
+        {
+            Error(rEntry.m_Line, "%s %s variation %u is duplicated or out of sequence",
+                  KeyNames[rEntry.m_Key], TypeNames[rEntry.m_Type], rEntry.m_Variation + 1);
+        }
+        else if (rCount == MAX_VARIATIONS)
+        {
+            Error(rEntry.m_Line, "%s %s has more than %u variations",
+                  KeyNames[rEntry.m_Key], TypeNames[rEntry.m_Type], MAX_VARIATIONS);
+        }
+        rCount++;
+    }
+    if (m_Errors)
+    {
+        return false;
+    }
+
+    // The number of supplemental types is set by the first key.
+    m_NumSuppTypes = 0;
+    while ((NUM_COMMON_TYPES + m_NumSuppTypes < NUM_TYPES) &&
+           (m_NumVariations[0][NUM_COMMON_TYPES + m_NumSuppTypes] != 0))
+    {
+        m_NumSuppTypes++;
+    }
+
+    // Every key must define the same types.
+    m_MaxVariations = 0;
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < NUM_TYPES; type++)
+        {
+            bool     expected = (type < NUM_COMMON_TYPES + m_NumSuppTypes);
+            unsigned count    = m_NumVariations[key][type];
+            if (expected && (count == 0))
+            {
+                Error(0, "%s %s has no variations", KeyNames[key], TypeNames[type]);
+            }
+            else if (!expected && (count != 0))
+            {
+                Error(0, "%s %s is defined, but %s %s isn't", KeyNames[key], TypeNames[type],
+                      KeyNames[0], TypeNames[type]);
+            }
+            m_MaxVariations = std::max(m_MaxVariations, count);
+        }
+    }
+    if (m_MaxVariations == 0)
+    {
+        Error(0, "no chords defined");
+    }
+    return m_Errors == 0;
+}
+
+// Report an error in the source file.  A line of 0 refers to the whole file.
+void ChordSource::Error(unsigned line, const char *pFormat, ...)
+{
+    va_list args;
+    va_start(args, pFormat);
+    if (line)
+    {
+        fprintf(stderr, "%s:%u: error: ", m_Path.c_str(), line);
+    }
+    else
+    {
+        fprintf(stderr, "%s: error: ", m_Path.c_str());
+    }
+    vfprintf(stderr, pFormat, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    m_Errors++;
+}
+
+// Name lookups.
+const char *ChordSource::GetKeyName(unsigned key)       { return KeyNames[key]; }
+const char *ChordSource::GetTypeName(unsigned type)     { return TypeNames[type]; }
+const char *ChordSource::GetTypeLongName(unsigned type) { return TypeLongNames[type]; }
+
+int ChordSource::FindKey(const std::string &rName)
+{
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        if (rName == KeyNames[key])
+        {
+            return key;
+        }
+    }
+    return -1;
+}
+
+int ChordSource::FindType(const std::string &rName)
+{
+    for (unsigned type = 0; type < NUM_TYPES; type++)
+    {
+        if (rName == TypeNames[type])
+        {
+            return type;
+        }
+    }
+    return -1;
+}
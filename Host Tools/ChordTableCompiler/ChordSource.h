@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordSource.h
+//
+// Defines the classes used by the chord table compiler to read and validate
+// the human readable chord definition file (ChordTable.txt).
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined CHORDSOURCE_H
+#define CHORDSOURCE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+// These must match the firmware (ChordChartData.h and Strings.h).
+const unsigned NUM_STRINGS       = 6;    // Strings per chord.
+const unsigned NUM_CHORD_FRETS   = 5;    // Frets shown on the fingerboard.
+const unsigned NUM_PATTERN_FRETS = 4;    // Frets a chord may span.  The last
+                                         // fret is reserved for unplayed strings.
+const unsigned MAX_BASE_FRET     = 15;   // Largest packed starting fret.
+const unsigned NUM_KEYS          = 12;
+const unsigned NUM_TYPES         = 36;
+const unsigned NUM_COMMON_TYPES  = 8;
+const unsigned MAX_VARIATIONS    = 9;    // Variations per key and type.  The
+                                         // LCD shows a single digit.
+const int      UNPLAYED          = -1;   // Fret value of an unplayed string.
+const unsigned PACKED_UNPLAYED   = 7;    // Packed value of an unplayed string.
+const unsigned BITS_PER_STRING   = 3;    // Bits per string in a packed shape.
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordEntry structure.  Defines a single chord voicing read from the source.
+/////////////////////////////////////////////////////////////////////////////////
+struct ChordEntry
+{
+    unsigned m_Key;                     // Zero based key index (C = 0).
+    unsigned m_Type;                    // Zero based type index (Major = 0).
+    unsigned m_Variation;               // Zero based variation index.
+    int      m_Frets[NUM_STRINGS];      // Absolute fret of each string, high E
+                                        // first.  0 = open, UNPLAYED = unplayed.
+    unsigned m_Line;                    // Source line number for messages.
+
+    unsigned GetBaseFret() const;
+    unsigned GetOffset(unsigned string) const;
+    uint32_t GetShape() const;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordSource class.  Reads the chord definition file and validates it.
+/////////////////////////////////////////////////////////////////////////////////
+class ChordSource
+{
+public:
+    ChordSource() : m_NumSuppTypes(0), m_MaxVariations(0), m_Errors(0) { }
+
+    bool Load(const std::string &rPath);
+    void RemoveSuppTypes();
+
+    const std::vector<ChordEntry> &GetEntries() const { return m_Entries; }
+    unsigned GetNumSuppTypes() const        { return m_NumSuppTypes; }
+    unsigned GetMaxVariations() const       { return m_MaxVariations; }
+    unsigned GetNumVariations(unsigned key, unsigned type) const
+    {
+        return m_NumVariations[key][type];
+    }
+    const std::string &GetPath() const      { return m_Path; }
+
+    static const char *GetKeyName(unsigned key);
+    static const char *GetTypeName(unsigned type);
+    static const char *GetTypeLongName(unsigned type);
+
+protected:
+
+private:
+    bool ParseLine(const std::string &rLine, unsigned lineNumber);
+    bool Validate();
+    void Error(unsigned line, const char *pFormat, ...);
+
+    static int FindKey(const std::string &rName);
+    static int FindType(const std::string &rName);
+
+    std::string             m_Path;
+    std::vector<ChordEntry> m_Entries;
+    unsigned                m_NumSuppTypes;
+    unsigned                m_MaxVariations;
+    unsigned                m_NumVariations[NUM_KEYS][NUM_TYPES];
+    unsigned                m_Errors;
+};
+
+#endif // CHORDSOURCE_H
@@ -0,0 +1,246 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordTableCompiler.cpp
+//
+// Contains main() for the chord table compiler.  This host (Linux) program
+// reads the human readable chord definitions in ChordTable.txt, validates
+// them, and generates the ChordTable.h and ChordTable.cpp files used by the
+// GuitarChordChart sketch, and the ChordTableFull.bin and ChordTableReduced.bin
+// chord packs for its external chord store.  It can also make a single chord
+// pack from another chord source, to ship a new chord set without rebuilding
+// the sketch.
+//
+// Usage: ChordTableCompiler <ChordTable.txt> <sketch directory>
+//        ChordTableCompiler --pack {full|reduced} <chord source> <pack file>
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "ChordSource.h"
+#include "ShapeDictionary.h"
+#include "DifficultyIndex.h"
+#include "DeltaStream.h"
+#include "VoiceLeading.h"
+#include "ReverseIndex.h"
+#include "PostingLists.h"
+#include "TableWriter.h"
+#include "ImageWriter.h"
+
+
+// FLASH sizes of the supported boards, for the size report.
+static const unsigned ATMEGA328_FLASH  = 32 * 1024;
+static const unsigned ATMEGA2560_FLASH = 256 * 1024;
+
+
+// Report the size of one variant of the chord table.
+static void Report(const TableVariant &rVariant)
+{
+    const ChordSource &rSource = rVariant.GetSource();
+    unsigned numChords = rSource.GetEntries().size();
+    unsigned numShapes = rVariant.GetShapes().GetNumShapes();
+    unsigned total     = rVariant.GetTableSize() + rVariant.GetIndexSize();
+
+    printf("%s library: %u chords (%u common types, %u supplemental types, up to %u "
+           "variations each)\n",
+           rVariant.GetName(), numChords, NUM_COMMON_TYPES, rSource.GetNumSuppTypes(),
+           rSource.GetMaxVariations());
+    printf("    %u unique shapes (%.2f chords per shape), %u bytes (%u without the "
+           "shape dictionary, %.2fx)\n",
+           numShapes, (double)numChords / numShapes,
+           rVariant.GetTableSize(), rVariant.GetUndedupedSize(),
+           (double)rVariant.GetUndedupedSize() / rVariant.GetTableSize());
+    printf("    %u bytes of indexes, %u bytes in all (%.1f%% of ATmega328 FLASH, "
+           "%.1f%% of ATmega2560 FLASH)\n",
+           rVariant.GetIndexSize(), total,
+           100.0 * total / ATMEGA328_FLASH, 100.0 * total / ATMEGA2560_FLASH);
+    printf("    %u bytes of indexes in every build; optional indexes (ChordTableConfig.h): "
+           "reverse %u, transpose %u\n",
+           rVariant.GetBaseIndexSize(), rVariant.GetReverseIndexSize(),
+           rVariant.GetTransposeIndexSize());
+    printf("    %u bytes as a delta stream (%.2f per voicing), for CHORD_DELTA_STREAM\n",
+           rVariant.GetStream().GetSize(), (double)rVariant.GetStream().GetSize() / numChords);
+
+    const ReverseIndex &rReverse = rVariant.GetReverse();
+    printf("    reverse index: %u keys in %u slots, at most %u voicings per slot\n",
+           rReverse.GetNumKeys(), rReverse.GetNumSlots(), rReverse.GetLongestSlot());
+    const ReverseIndex &rTranspose = rVariant.GetTranspose();
+    printf("    transposition index: %u keys in %u slots, at most %u voicings per slot\n",
+           rTranspose.GetNumKeys(), rTranspose.GetNumSlots(), rTranspose.GetLongestSlot());
+    printf("    posting lists: %u lists of %u bytes\n", PostingLists::NUM_LISTS,
+           rVariant.GetPostings().GetListBytes());
+
+    const DifficultyIndex &rDifficulty = rVariant.GetDifficulty();
+    printf("    voicings per difficulty level:");
+    for (unsigned level = 1; level <= DifficultyIndex::NUM_LEVELS; level++)
+    {
+        printf(" %u", rDifficulty.GetLevelCount(level));
+    }
+    printf("\n");
+}
+
+
+// Make one chord pack from a chord source.  Returns main()'s exit status.
+// pLibrary - "full" for all the chord types, or "reduced" for the common types.
+static int MakePack(const char *pLibrary, const char *pSourcePath, const char *pPackPath)
+{
+    bool full = strcmp(pLibrary, "full") == 0;
+    if (!full && (strcmp(pLibrary, "reduced") != 0))
+    {
+        fprintf(stderr, "error: the library must be full or reduced\n");
+        return 2;
+    }
+
+    ChordSource source;
+    if (!source.Load(pSourcePath))
+    {
+        return 1;
+    }
+    if (!full)
+    {
+        source.RemoveSuppTypes();
+    }
+    ShapeDictionary shapes;
+    DeltaStream     stream;
+    DifficultyIndex difficulty;
+    if (!shapes.Build(source) || !stream.Build(source))
+    {
+        return 1;
+    }
+    difficulty.Build(source);
+    VoiceLeading voiceLeading;
+    voiceLeading.Build(source);
+    ReverseIndex reverse;
+    ReverseIndex transpose(true);
+    reverse.Build(source);
+    transpose.Build(source, reverse.GetSlotBits());
+    PostingLists postings;
+    postings.Build(source);
+
+    TableVariant variant(pLibrary, source, shapes, stream, difficulty, voiceLeading, reverse,
+                         transpose, postings);
+    ImageWriter image(variant);
+    if (!image.Write(pPackPath))
+    {
+        return 1;
+    }
+    Report(variant);
+    return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if ((argc == 5) && (strcmp(argv[1], "--pack") == 0))
+    {
+        return MakePack(argv[2], argv[3], argv[4]);
+    }
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <ChordTable.txt> <sketch directory>\n"
+                        "       %s --pack {full|reduced} <chord source> <pack file>\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Read and validate the chord definitions.  The reduced library has only
+    // the common chord types.
+    ChordSource full;
+    if (!full.Load(argv[1]))
+    {
+        return 1;
+    }
+    ChordSource reduced(full);
+    reduced.RemoveSuppTypes();
+
+    // Replace the voicings by a dictionary of unique movable shapes.
+    ShapeDictionary fullShapes;
+    ShapeDictionary reducedShapes;
+    if (!fullShapes.Build(full) || !reducedShapes.Build(reduced))
+    {
+        return 1;
+    }
+
+    // Or delta encode them, for CHORD_DELTA_STREAM.
+    DeltaStream fullStream;
+    DeltaStream reducedStream;
+    if (!fullStream.Build(full) || !reducedStream.Build(reduced))
+    {
+        return 1;
+    }
+
+    // Score and sort the voicings by difficulty.
+    DifficultyIndex fullDifficulty;
+    DifficultyIndex reducedDifficulty;
+    fullDifficulty.Build(full);
+    reducedDifficulty.Build(reduced);
+
+    // Find the nearest voicings of other chords to each voicing.
+    VoiceLeading fullVoiceLeading;
+    VoiceLeading reducedVoiceLeading;
+    fullVoiceLeading.Build(full);
+    reducedVoiceLeading.Build(reduced);
+
+    // Hash the voicings for the reverse chord finder, by starting fret and
+    // shape, and by shape alone for patterns with any base fret.
+    ReverseIndex fullReverse;
+    ReverseIndex reducedReverse;
+    ReverseIndex fullTranspose(true);
+    ReverseIndex reducedTranspose(true);
+    fullReverse.Build(full);
+    reducedReverse.Build(reduced);
+    fullTranspose.Build(full, fullReverse.GetSlotBits());
+    reducedTranspose.Build(reduced, reducedReverse.GetSlotBits());
+
+    // List the voicings under each LED, for counting the chords that fit a
+    // pattern as it is entered.
+    PostingLists fullPostings;
+    PostingLists reducedPostings;
+    fullPostings.Build(full);
+    reducedPostings.Build(reduced);
+
+    // Generate the table files.
+    TableVariant fullVariant("full", full, fullShapes, fullStream, fullDifficulty,
+                             fullVoiceLeading, fullReverse, fullTranspose, fullPostings);
+    TableVariant reducedVariant("reduced", reduced, reducedShapes, reducedStream,
+                                reducedDifficulty, reducedVoiceLeading, reducedReverse,
+                                reducedTranspose, reducedPostings);
+    TableWriter writer(fullVariant, reducedVariant);
+    ImageWriter fullImage(fullVariant);
+    ImageWriter reducedImage(reducedVariant);
+    std::string outputDir(argv[2]);
+    if (!writer.Write(outputDir) ||
+        !fullImage.Write(outputDir + "/ChordTableFull.bin") ||
+        !reducedImage.Write(outputDir + "/ChordTableReduced.bin"))
+    {
+        return 1;
+    }
+
+    // Report what was generated.
+    double millis = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start).count();
+    Report(fullVariant);
+    Report(reducedVariant);
+    printf("%.1f ms\n", millis);
+    return 0;
+}
@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////////
+// DeltaStream.cpp
+//
+// Implements the DeltaStream class used by the chord table compiler to delta
+// encode the voicings for CHORD_DELTA_STREAM.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "DeltaStream.h"
+#include <stdio.h>
+#include <algorithm>
+
+
+// Encode every entry of the chord source.  Returns false if the stream is
+// too big for the 16 bit keyframe offsets.
+bool DeltaStream::Build(const ChordSource &rSource)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    const uint32_t valueMask = (1 << BITS_PER_STRING) - 1;
+
+    m_Bytes.clear();
+    m_Keyframes.clear();
+    m_Bit = 0;
+
+    for (unsigned i = 0; i < rEntries.size(); i++)
+    {
+        uint32_t shape = rEntries[i].GetShape();
+        unsigned fret  = rEntries[i].GetBaseFret();
+
+        // Keyframes start on a byte, and hold every string and the fret.
+        if (i % KEYFRAME_INTERVAL == 0)
+        {
+            m_Bit = m_Bytes.size() * 8;
+            m_Keyframes.push_back(m_Bytes.size());
+            for (unsigned string = 0; string < NUM_STRINGS; string++)
+            {
+                WriteBits((shape >> (string * BITS_PER_STRING)) & valueMask, VALUE_BITS);
+            }
+            WriteBits(fret, FRET_BITS);
+            continue;
+        }
+
+        // Pick the reference that leaves the fewest changes to store.
+        unsigned numReferences = std::min(NUM_REFERENCES, i % KEYFRAME_INTERVAL);
+        unsigned bestReference = 0;
+        unsigned bestChanged   = 0;
+        unsigned bestBits      = ~0u;
+        for (unsigned reference = 0; reference < numReferences; reference++)
+        {
+            const ChordEntry &rOther = rEntries[i - 1 - reference];
+            uint32_t other = rOther.GetShape();
+            unsigned changed = 0;
+            unsigned bits = (rOther.GetBaseFret() != fret) ? FRET_BITS : 0;
+            for (unsigned string = 0; string < NUM_STRINGS; string++)
+            {
+                unsigned shift = string * BITS_PER_STRING;
+                if (((shape >> shift) & valueMask) != ((other >> shift) & valueMask))
+                {
+                    changed |= 1 << string;
+                    bits += VALUE_BITS;
+                }
+            }
+            if (bits < bestBits)
+            {
+                bestReference = reference;
+                bestChanged   = changed;
+                bestBits      = bits;
+            }
+        }
+
+        bool fretChanged = rEntries[i - 1 - bestReference].GetBaseFret() != fret;
+        WriteBits(bestReference, REFERENCE_BITS);
+        WriteBits(bestChanged, NUM_STRINGS);
+        WriteBits(fretChanged, 1);
+        if (fretChanged)
+        {
+            WriteBits(fret, FRET_BITS);
+        }
+        for (unsigned string = 0; string < NUM_STRINGS; string++)
+        {
+            if (bestChanged & (1 << string))
+            {
+                WriteBits((shape >> (string * BITS_PER_STRING)) & valueMask, VALUE_BITS);
+            }
+        }
+    }
+
+    if (!m_Keyframes.empty() && (m_Keyframes.back() > 0xffff))
+    {
+        fprintf(stderr, "%s: error: the delta stream is %u bytes, keyframes can only "
+                "be within the first 64 KB\n", rSource.GetPath().c_str(),
+                (unsigned)m_Bytes.size());
+        return false;
+    }
+    return true;
+}
+
+
+// Append bits to the stream, least significant first.
+void DeltaStream::WriteBits(unsigned value, unsigned count)
+{
+    for (unsigned bit = 0; bit < count; bit++, m_Bit++)
+    {
+        if (m_Bit % 8 == 0)
+        {
+            m_Bytes.push_back(0);
+        }
+        if (value & (1 << bit))
+        {
+            m_Bytes.back() |= 1 << (m_Bit % 8);
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////////
+// DeltaStream.h
+//
+// Defines the DeltaStream class used by the chord table compiler to delta
+// encode the voicings for CHORD_DELTA_STREAM.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined DELTASTREAM_H
+#define DELTASTREAM_H
+
+#include <stdint.h>
+#include <vector>
+#include "ChordSource.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// DeltaStream class.  Encodes the voicings as a bit stream in table order.
+// Every KEYFRAME_INTERVAL'th voicing is a keyframe stored whole, and every
+// other voicing is stored as its changes from whichever of the
+// NUM_REFERENCES voicings before it (in the same keyframe interval) costs the
+// fewest bits.  The format is described with ChordStreamCursor in the
+// sketch's ChordStream.h, and these constants must match it.
+/////////////////////////////////////////////////////////////////////////////////
+class DeltaStream
+{
+public:
+    DeltaStream() : m_Bit(0) { }
+
+    bool Build(const ChordSource &rSource);
+
+    const std::vector<uint8_t> &GetBytes() const { return m_Bytes; }
+    unsigned GetNumKeyframes() const        { return m_Keyframes.size(); }
+    unsigned GetKeyframe(unsigned index) const { return m_Keyframes[index]; }
+
+    // Bytes of FLASH used by the stream and its keyframe offsets.
+    unsigned GetSize() const
+    {
+        return m_Bytes.size() + m_Keyframes.size() * sizeof(uint16_t);
+    }
+
+    static const unsigned KEYFRAME_INTERVAL = 16;
+    static const unsigned NUM_REFERENCES    = 4;
+    static const unsigned REFERENCE_BITS    = 2;
+    static const unsigned VALUE_BITS        = 3;
+    static const unsigned FRET_BITS         = 4;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    DeltaStream(const DeltaStream &);
+    DeltaStream &operator=(const DeltaStream &);
+
+    void WriteBits(unsigned value, unsigned count);
+
+    std::vector<uint8_t>  m_Bytes;
+    unsigned              m_Bit;        // Bits written.
+    std::vector<unsigned> m_Keyframes;  // Byte offset of each keyframe.
+};
+
+#endif // DELTASTREAM_H
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////
+// DifficultyIndex.cpp
+//
+// Implements the DifficultyIndex class used by the chord table compiler to score
+// how hard each voicing is to play, and to order the voicings by difficulty.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "DifficultyIndex.h"
+#include <algorithm>
+
+
+// Score weights.  A wider stretch and a barre cost the most, and a muted
+// string inside the chord is harder to damp than one at the edge.
+static const unsigned SPAN_WEIGHT        = 3;   // Per fret of span.
+static const unsigned FINGER_WEIGHT      = 2;   // Per finger.
+static const unsigned BARRE_WEIGHT       = 5;
+static const unsigned MUTED_WEIGHT       = 1;   // Per unplayed string.
+static const unsigned INNER_MUTED_WEIGHT = 4;   // Per unplayed string between
+                                                // played strings.
+static const unsigned SCORE_PER_LEVEL    = 3;
+
+
+// Return the raw difficulty score of a voicing.  Higher is harder.
+unsigned DifficultyIndex::GetScore(const ChordEntry &rEntry)
+{
+    unsigned baseFret = rEntry.GetBaseFret();
+    unsigned fretted  = 0;
+    unsigned atBase   = 0;      // Strings held at the starting fret.
+    unsigned span     = 0;
+    unsigned muted    = 0;
+    unsigned inner    = 0;
+    int      lowest   = -1;     // Lowest and highest played strings.
+    int      highest  = -1;
+
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        int fret = rEntry.m_Frets[string];
+        if (fret == UNPLAYED)
+        {
+            muted++;
+            continue;
+        }
+        if (lowest < 0)
+        {
+            lowest = string;
+        }
+        highest = string;
+        if (fret > 0)
+        {
+            fretted++;
+            atBase += ((unsigned)fret == baseFret);
+            span    = std::max(span, fret - baseFret);
+        }
+    }
+    for (int string = lowest + 1; string < highest; string++)
+    {
+        inner += (rEntry.m_Frets[string] == UNPLAYED);
+    }
+
+    // More than four fretted strings, or three or more at the starting fret,
+    // are held with a barre, which takes one finger.
+    bool     barre   = (fretted > 4) || (atBase >= 3);
+    unsigned fingers = barre ? 1 + fretted - atBase : fretted;
+
+    return span * SPAN_WEIGHT + fingers * FINGER_WEIGHT + (barre ? BARRE_WEIGHT : 0) +
+           muted * MUTED_WEIGHT + inner * INNER_MUTED_WEIGHT;
+}
+
+
+// Score every entry of the chord source and sort the entries by level.
+void DifficultyIndex::Build(const ChordSource &rSource)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+
+    m_Levels.clear();
+    m_Order.clear();
+    for (unsigned i = 0; i < rEntries.size(); i++)
+    {
+        unsigned level = 1 + GetScore(rEntries[i]) / SCORE_PER_LEVEL;
+        if (level > NUM_LEVELS)
+        {
+            level = NUM_LEVELS;
+        }
+        m_Levels.push_back(level);
+        m_Order.push_back(i);
+    }
+
+    // Easiest first.  Entries of the same level stay in table order, so the
+    // sketch still steps through them by key and type.
+    std::stable_sort(m_Order.begin(), m_Order.end(),
+        [this](unsigned a, unsigned b) { return m_Levels[a] < m_Levels[b]; });
+
+    m_Starts.assign(NUM_LEVELS + 1, 0);
+    for (unsigned i = 0; i < rEntries.size(); i++)
+    {
+        m_Starts[m_Levels[i]]++;
+    }
+    for (unsigned level = 1; level <= NUM_LEVELS; level++)
+    {
+        m_Starts[level] += m_Starts[level - 1];
+    }
+}
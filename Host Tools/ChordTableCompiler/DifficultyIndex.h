@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////
+// DifficultyIndex.h
+//
+// Defines the DifficultyIndex class used by the chord table compiler to score
+// how hard each voicing is to play, and to order the voicings by difficulty.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined DIFFICULTYINDEX_H
+#define DIFFICULTYINDEX_H
+
+#include <stdint.h>
+#include <vector>
+#include "ChordSource.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// DifficultyIndex class.  Gives each voicing a difficulty level from 1
+// (easiest) to NUM_LEVELS, from its fret span, barre, finger count and muted
+// strings.  The voicings sorted by level (then by table order) form the
+// permutation the sketch browses in difficulty order, and the rank where each
+// level starts lets it stop at a maximum level without sorting anything.
+/////////////////////////////////////////////////////////////////////////////////
+class DifficultyIndex
+{
+public:
+    DifficultyIndex() { }
+
+    void Build(const ChordSource &rSource);
+
+    unsigned GetLevel(unsigned entry) const     { return m_Levels[entry]; }
+    unsigned GetOrder(unsigned rank) const      { return m_Order[rank]; }
+    unsigned GetLevelStart(unsigned level) const { return m_Starts[level - 1]; }
+    unsigned GetLevelCount(unsigned level) const
+    {
+        return m_Starts[level] - m_Starts[level - 1];
+    }
+
+    static unsigned GetScore(const ChordEntry &rEntry);
+
+    // Difficulty levels.  The sketch shows the level as a single digit.
+    static const unsigned NUM_LEVELS = 9;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    DifficultyIndex(const DifficultyIndex &);
+    DifficultyIndex &operator=(const DifficultyIndex &);
+
+    std::vector<unsigned> m_Levels;     // Level of each entry.
+    std::vector<unsigned> m_Order;      // Entries, easiest first.
+    std::vector<unsigned> m_Starts;     // Rank of the first entry of each level,
+                                        // then the number of entries.
+};
+
+#endif // DIFFICULTYINDEX_H
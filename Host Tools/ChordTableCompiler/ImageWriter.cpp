@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ImageWriter.cpp
+//
+// Contains methods defined by the ImageWriter class.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include "ImageWriter.h"
+
+
+// Append a little endian 16 bit word to the image.
+void ImageWriter::AddWord(unsigned value)
+{
+    AddByte(value & 0xff);
+    AddByte(value >> 8);
+}
+
+// Append the CRC-32 of the image so far, little endian.  This is the same CRC
+// as zlib's crc32().
+void ImageWriter::AddCrc()
+{
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < m_Image.size(); i++)
+    {
+        crc ^= m_Image[i];
+        for (unsigned bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+        }
+    }
+    crc = ~crc;
+    AddWord(crc & 0xffff);
+    AddWord(crc >> 16);
+}
+
+// Build the image and write it to the specified file.  Returns true if
+// successful.
+bool ImageWriter::Write(const std::string &rPath)
+{
+    const ChordSource &rSource = m_rVariant.GetSource();
+    const ShapeDictionary &rShapes = m_rVariant.GetShapes();
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+
+    // Header.
+    m_Image.clear();
+    AddByte('G');
+    AddByte('C');
+    AddByte('C');
+    AddByte('T');
+    AddWord(rEntries.size());
+    AddWord(rShapes.GetNumShapes());
+    AddByte(NUM_KEYS);
+    AddByte(NUM_COMMON_TYPES + rSource.GetNumSuppTypes());
+    AddByte(rSource.GetMaxVariations());
+    AddByte(DifficultyIndex::NUM_LEVELS);
+    AddByte(IMAGE_VERSION);
+    AddByte(NUM_STRINGS);
+    AddByte(VoiceLeading::NUM_NEIGHBORS);
+    AddByte(m_rVariant.GetReverse().GetSlotBits());
+    while (m_Image.size() < IMAGE_HEADER_SIZE)
+    {
+        AddByte(0);
+    }
+
+    // ChordShapes[].
+    for (unsigned id = 0; id < rShapes.GetNumShapes(); id++)
+    {
+        uint32_t shape = rShapes.GetShape(id);
+        for (unsigned i = 0; i < TableVariant::PACKED_SHAPE_SIZE; i++)
+        {
+            AddByte((shape >> (i * 8)) & 0xff);
+        }
+    }
+
+    // ChordShapeIds[].
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        AddByte(rShapes.GetShapeId(i));
+    }
+
+    // ChordFrets[], two voicings per byte, the even voicing in the low nibble.
+    for (size_t i = 0; i < rEntries.size(); i += 2)
+    {
+        unsigned odd = (i + 1 < rEntries.size()) ? rEntries[i + 1].GetBaseFret() : 0;
+        AddByte(rEntries[i].GetBaseFret() | (odd << 4));
+    }
+
+    // ChordVoicingOffsets[].
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        if (rEntries[i].m_Variation == 0)
+        {
+            AddWord(i);
+        }
+    }
+    AddWord(rEntries.size());
+
+    // ChordDifficulty[], ChordDifficultyOrder[] and ChordDifficultyStarts[].
+    const DifficultyIndex &rDifficulty = m_rVariant.GetDifficulty();
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        AddByte(rDifficulty.GetLevel(i));
+    }
+    for (size_t rank = 0; rank < rEntries.size(); rank++)
+    {
+        AddWord(rDifficulty.GetOrder(rank));
+    }
+    for (unsigned level = 1; level <= DifficultyIndex::NUM_LEVELS; level++)
+    {
+        AddWord(rDifficulty.GetLevelStart(level));
+    }
+    AddWord(rEntries.size());
+
+    // ChordNeighbors[].
+    const std::vector<uint8_t> &rNeighbors = m_rVariant.GetVoiceLeading().GetBytes();
+    for (size_t i = 0; i < rNeighbors.size(); i++)
+    {
+        AddByte(rNeighbors[i]);
+    }
+
+    // ChordReverseStarts[] and ChordReverseVoicings[].
+    const ReverseIndex &rReverse = m_rVariant.GetReverse();
+    for (unsigned slot = 0; slot <= rReverse.GetNumSlots(); slot++)
+    {
+        AddWord(rReverse.GetSlotStart(slot));
+    }
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        AddWord(rReverse.GetVoicing(i));
+    }
+
+    // ChordTransposeStarts[] and ChordTransposeVoicings[], with the same
+    // number of slots.
+    const ReverseIndex &rTranspose = m_rVariant.GetTranspose();
+    for (unsigned slot = 0; slot <= rTranspose.GetNumSlots(); slot++)
+    {
+        AddWord(rTranspose.GetSlotStart(slot));
+    }
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        AddWord(rTranspose.GetVoicing(i));
+    }
+
+    // ChordPostings[].
+    const std::vector<uint8_t> &rPostings = m_rVariant.GetPostings().GetBytes();
+    for (size_t i = 0; i < rPostings.size(); i++)
+    {
+        AddByte(rPostings[i]);
+    }
+
+    // The CRC of everything before it.
+    AddCrc();
+
+    FILE *pFile = fopen(rPath.c_str(), "wb");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "%s: error: can't create file\n", rPath.c_str());
+        return false;
+    }
+    bool ok = fwrite(&m_Image[0], 1, m_Image.size(), pFile) == m_Image.size();
+    return (fclose(pFile) == 0) && ok;
+}
@@ -0,0 +1,67 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ImageWriter.h
+//
+// Defines the ImageWriter class, which writes a chord table as a binary image
+// for the sketch's external chord store.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined IMAGEWRITER_H
+#define IMAGEWRITER_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "TableWriter.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ImageWriter class.  Writes one variant of the chord table as a chord pack,
+// in the layout described in ChordStore.h.  The pack is programmed into the
+// external SPI FLASH chip, and is read by the ChordCacheBench host tool.
+/////////////////////////////////////////////////////////////////////////////////
+class ImageWriter
+{
+public:
+    ImageWriter(const TableVariant &rVariant) : m_rVariant(rVariant) { }
+
+    bool Write(const std::string &rPath);
+
+    // These must match ChordStore.h.
+    static const unsigned IMAGE_HEADER_SIZE = 16;
+    static const uint8_t  IMAGE_VERSION     = 9;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    ImageWriter(const ImageWriter &);
+    ImageWriter &operator=(const ImageWriter &);
+
+    void AddByte(unsigned value)    { m_Image.push_back((uint8_t)value); }
+    void AddWord(unsigned value);
+    void AddCrc();
+
+    const TableVariant  &m_rVariant;
+    std::vector<uint8_t> m_Image;
+};
+
+#endif // IMAGEWRITER_H
@@ -0,0 +1,61 @@
+/////////////////////////////////////////////////////////////////////////////////
+// PostingLists.cpp
+//
+// Implements the PostingLists class used by the chord table compiler to list
+// the voicings with each string on each fret, for the reverse chord finder.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "PostingLists.h"
+
+
+// List every entry under the LEDs its pattern lights and the bits of its
+// starting fret.  Open strings light no LED, so they are in no list.
+void PostingLists::Build(const ChordSource &rSource)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    m_ListBytes = (rEntries.size() + 7) / 8;
+    m_Bytes.assign(NUM_LISTS * m_ListBytes, 0);
+
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        const ChordEntry &rEntry = rEntries[i];
+        for (unsigned string = 0; string < NUM_STRINGS; string++)
+        {
+            unsigned offset = rEntry.GetOffset(string);
+            if (offset == PACKED_UNPLAYED)
+            {
+                Add(GetStringList(NUM_PATTERN_FRETS, string), i);
+            }
+            else if (offset != 0)
+            {
+                Add(GetStringList(offset - 1, string), i);
+            }
+        }
+        for (unsigned bit = 0; bit < FRET_BITS; bit++)
+        {
+            if ((rEntry.GetBaseFret() & (1 << bit)) != 0)
+            {
+                Add(GetFretList(bit), i);
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////
+// PostingLists.h
+//
+// Defines the PostingLists class used by the chord table compiler to list the
+// voicings with each string on each fret, for the reverse chord finder.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined POSTINGLISTS_H
+#define POSTINGLISTS_H
+
+#include <stdint.h>
+#include <vector>
+#include "ChordSource.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// PostingLists class.  A bit set of voicings (bit n of byte n / 8 for voicing
+// n) for each LED of the fingerboard pattern: each string on each fret from
+// the starting fret, then each string unplayed.  Four more sets hold the
+// bits of each voicing's starting fret.  The reverse chord finder ANDs the
+// sets of the LEDs lit so far, and of the starting fret, to count the chords
+// that still fit the pattern being entered.
+/////////////////////////////////////////////////////////////////////////////////
+class PostingLists
+{
+public:
+    PostingLists() : m_ListBytes(0) { }
+
+    void Build(const ChordSource &rSource);
+
+    unsigned GetListBytes() const                   { return m_ListBytes; }
+    const std::vector<uint8_t> &GetBytes() const    { return m_Bytes; }
+
+    // Return the list of a string on a pattern row (NUM_PATTERN_FRETS for
+    // unplayed), or of a bit of the starting fret.
+    static unsigned GetStringList(unsigned row, unsigned string)
+    {
+        return row * NUM_STRINGS + string;
+    }
+    static unsigned GetFretList(unsigned bit)
+    {
+        return (NUM_PATTERN_FRETS + 1) * NUM_STRINGS + bit;
+    }
+
+    static const unsigned FRET_BITS = 4;    // Bits of MAX_BASE_FRET.
+    static const unsigned NUM_LISTS = (NUM_PATTERN_FRETS + 1) * NUM_STRINGS + FRET_BITS;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    PostingLists(const PostingLists &);
+    PostingLists &operator=(const PostingLists &);
+
+    void Add(unsigned list, unsigned voicing)
+    {
+        m_Bytes[list * m_ListBytes + voicing / 8] |= 1 << (voicing % 8);
+    }
+
+    unsigned             m_ListBytes;   // Bytes per list.
+    std::vector<uint8_t> m_Bytes;       // The lists, one after the other.
+};
+
+#endif // POSTINGLISTS_H
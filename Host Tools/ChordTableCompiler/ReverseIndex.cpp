@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ReverseIndex.cpp
+//
+// Implements the ReverseIndex class used by the chord table compiler to hash
+// the voicings for the reverse chord finder.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "ReverseIndex.h"
+#include <algorithm>
+#include <set>
+
+
+// Return the key of a voicing: the starting fret in bits 0-3, the unplayed
+// strings in bits 4-9 and the strings on the starting fret in bits 10-15,
+// high E first.  This must match ReverseChordFinderMode::GetIndexKey().
+uint16_t ReverseIndex::GetKey(const ChordEntry &rEntry)
+{
+    unsigned baseFret = rEntry.GetBaseFret();
+    uint16_t unplayed = 0;
+    uint16_t first    = 0;
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        if (rEntry.m_Frets[string] == UNPLAYED)
+        {
+            unplayed |= 1 << string;
+        }
+        else if ((unsigned)rEntry.m_Frets[string] == baseFret)
+        {
+            first |= 1 << string;
+        }
+    }
+    return baseFret | (unplayed << 4) | (first << 10);
+}
+
+// Return the slot of a key: the top bits of a multiplicative hash.  This must
+// match ReverseChordFinderMode::GetIndexSlot().
+unsigned ReverseIndex::GetSlot(uint16_t key, unsigned slotBits)
+{
+    return (uint16_t)(key * 0x9e37u) >> (16 - slotBits);
+}
+
+// Hash every entry.  Unless the number of slots is given, there is a slot
+// for every two distinct keys, rounded up to a power of two, which keeps the
+// table small while slots stay short.  The transposition index is given the
+// reverse index's slots, so the sketch needs only one slot count.
+void ReverseIndex::Build(const ChordSource &rSource, unsigned slotBits)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+
+    std::set<uint16_t> keys;
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        keys.insert(GetIndexKey(rEntries[i]));
+    }
+    m_NumKeys  = keys.size();
+    m_SlotBits = slotBits;
+    if (m_SlotBits == 0)
+    {
+        m_SlotBits = 1;
+        while ((2u << m_SlotBits) < m_NumKeys)
+        {
+            m_SlotBits++;
+        }
+    }
+
+    // Sort the entries by slot, keeping table order within each slot.
+    std::vector<unsigned> slots(rEntries.size());
+    m_Voicings.resize(rEntries.size());
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        slots[i]       = GetSlot(GetIndexKey(rEntries[i]), m_SlotBits);
+        m_Voicings[i]  = i;
+    }
+    std::stable_sort(m_Voicings.begin(), m_Voicings.end(),
+                     [&](unsigned a, unsigned b) { return slots[a] < slots[b]; });
+
+    m_Starts.assign(GetNumSlots() + 1, 0);
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        m_Starts[slots[i] + 1]++;
+    }
+    for (unsigned slot = 0; slot < GetNumSlots(); slot++)
+    {
+        m_Starts[slot + 1] += m_Starts[slot];
+    }
+}
+
+// Return the most voicings in any slot, the most a lookup reads.
+unsigned ReverseIndex::GetLongestSlot() const
+{
+    unsigned longest = 0;
+    for (unsigned slot = 0; slot < GetNumSlots(); slot++)
+    {
+        longest = std::max(longest, m_Starts[slot + 1] - m_Starts[slot]);
+    }
+    return longest;
+}
@@ -0,0 +1,88 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ReverseIndex.h
+//
+// Defines the ReverseIndex class used by the chord table compiler to hash the
+// voicings by how they look on the fingerboard, for the reverse chord finder.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined REVERSEINDEX_H
+#define REVERSEINDEX_H
+
+#include <stdint.h>
+#include <vector>
+#include "ChordSource.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ReverseIndex class.  A hash table of the voicings, keyed by what the
+// reverse chord finder always compares: the starting fret, the unplayed
+// strings and the strings on the first fret of the pattern.  The voicings are
+// sorted by slot (then by table order), and the index of the first voicing of
+// each slot lets the sketch find a slot's voicings with two reads, however
+// many voicings the table holds.  The transposition index leaves the
+// starting fret out of the key, so one slot holds every transposition of a
+// shape, for patterns entered with any base fret.
+/////////////////////////////////////////////////////////////////////////////////
+class ReverseIndex
+{
+public:
+    // anyFret - True for the transposition index.
+    explicit ReverseIndex(bool anyFret = false) :
+        m_AnyFret(anyFret), m_SlotBits(0), m_NumKeys(0) { }
+
+    // slotBits - The table has 2^slotBits slots, or 0 for a slot for every
+    //            two keys.
+    void Build(const ChordSource &rSource, unsigned slotBits = 0);
+
+    unsigned GetSlotBits() const                { return m_SlotBits; }
+    unsigned GetNumSlots() const                { return 1 << m_SlotBits; }
+    unsigned GetSlotStart(unsigned slot) const  { return m_Starts[slot]; }
+    unsigned GetVoicing(unsigned index) const   { return m_Voicings[index]; }
+    unsigned GetNumKeys() const                 { return m_NumKeys; }
+    unsigned GetLongestSlot() const;
+
+    static uint16_t GetKey(const ChordEntry &rEntry);
+    static unsigned GetSlot(uint16_t key, unsigned slotBits);
+
+    static const uint16_t FRET_MASK = 0xf;  // Key bits of the starting fret.
+
+protected:
+
+private:
+    // Unimplemented methods.
+    ReverseIndex(const ReverseIndex &);
+    ReverseIndex &operator=(const ReverseIndex &);
+
+    uint16_t GetIndexKey(const ChordEntry &rEntry) const
+    {
+        return m_AnyFret ? (GetKey(rEntry) & ~FRET_MASK) : GetKey(rEntry);
+    }
+
+    bool                  m_AnyFret;    // The key leaves out the starting fret.
+    unsigned              m_SlotBits;   // The table has 2^m_SlotBits slots.
+    unsigned              m_NumKeys;    // Distinct keys.
+    std::vector<unsigned> m_Starts;     // Index of the first voicing of each
+                                        // slot, then the number of voicings.
+    std::vector<unsigned> m_Voicings;   // Voicings sorted by slot.
+};
+
+#endif // REVERSEINDEX_H
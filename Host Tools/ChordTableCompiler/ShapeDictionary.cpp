@@ -0,0 +1,67 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ShapeDictionary.cpp
+//
+// Contains methods defined by the ShapeDictionary class.  These methods find
+// the unique movable shapes used by the chord voicings.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include "ShapeDictionary.h"
+
+
+// Assign a shape id to every entry of the chord source.  Shapes are numbered
+// in order of first use so the generated table reads in chord order.  Returns
+// false if there are more shapes than a shape id can select.
+bool ShapeDictionary::Build(const ChordSource &rSource)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+
+    m_Shapes.clear();
+    m_FirstUse.clear();
+    m_ShapeIds.clear();
+    m_Ids.clear();
+
+    for (unsigned i = 0; i < rEntries.size(); i++)
+    {
+        uint32_t shape = rEntries[i].GetShape();
+        std::map<uint32_t, unsigned>::const_iterator it = m_Ids.find(shape);
+        if (it != m_Ids.end())
+        {
+            m_ShapeIds.push_back(it->second);
+            continue;
+        }
+
+        unsigned id = m_Shapes.size();
+        m_Ids[shape] = id;
+        m_Shapes.push_back(shape);
+        m_FirstUse.push_back(i);
+        m_ShapeIds.push_back(id);
+    }
+
+    if (m_Shapes.size() > MAX_SHAPES)
+    {
+        fprintf(stderr, "%s: error: %u unique shapes, the table supports %u\n",
+                rSource.GetPath().c_str(), (unsigned)m_Shapes.size(), MAX_SHAPES);
+        return false;
+    }
+    return true;
+}
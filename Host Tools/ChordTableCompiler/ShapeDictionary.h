@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ShapeDictionary.h
+//
+// Defines the ShapeDictionary class used by the chord table compiler to
+// replace the chord voicings by a table of unique movable shapes.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined SHAPEDICTIONARY_H
+#define SHAPEDICTIONARY_H
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include "ChordSource.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ShapeDictionary class.  A chord voicing is its shape (the fret offset of
+// each string) moved to a starting fret.  The same shape is used by many
+// voicings, so the table stores each shape once, and each voicing as a shape
+// id and a starting fret.
+/////////////////////////////////////////////////////////////////////////////////
+class ShapeDictionary
+{
+public:
+    ShapeDictionary() { }
+
+    bool Build(const ChordSource &rSource);
+
+    unsigned GetNumShapes() const           { return m_Shapes.size(); }
+    uint32_t GetShape(unsigned id) const    { return m_Shapes[id]; }
+    unsigned GetFirstUse(unsigned id) const { return m_FirstUse[id]; }
+    unsigned GetShapeId(unsigned entry) const { return m_ShapeIds[entry]; }
+
+    // Largest number of shapes an 8 bit shape id can select.
+    static const unsigned MAX_SHAPES = 256;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    ShapeDictionary(const ShapeDictionary &);
+    ShapeDictionary &operator=(const ShapeDictionary &);
+
+    std::vector<uint32_t>        m_Shapes;      // Unique shapes, in order of first use.
+    std::vector<unsigned>        m_FirstUse;    // Entry that first used each shape.
+    std::vector<unsigned>        m_ShapeIds;    // Shape id of each entry.
+    std::map<uint32_t, unsigned> m_Ids;         // Shape id of each shape.
+};
+
+#endif // SHAPEDICTIONARY_H
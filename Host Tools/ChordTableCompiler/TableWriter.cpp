@@ -0,0 +1,691 @@
+/////////////////////////////////////////////////////////////////////////////////
+// TableWriter.cpp
+//
+// Contains methods defined by the TableWriter class.  These methods write the
+// validated chord source as the PROGMEM chord tables (shape dictionary, shape
+// ids, starting frets and offsets) and the header of counts used by
+// ChordChartData.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "TableWriter.h"
+
+
+// Write ChordTable.h and ChordTable.cpp to the specified directory.  Returns
+// true if successful.
+bool TableWriter::Write(const std::string &rOutputDir)
+{
+    return WriteHeader(rOutputDir + "/ChordTable.h") &&
+           WriteTable(rOutputDir + "/ChordTable.cpp");
+}
+
+// Return the size in bytes of the generated chord tables.
+unsigned TableVariant::GetTableSize() const
+{
+    unsigned numVoicings = m_rSource.GetEntries().size();
+    return m_rShapes.GetNumShapes() * PACKED_SHAPE_SIZE +   // ChordShapes[]
+           numVoicings +                                     // ChordShapeIds[]
+           (numVoicings + 1) / 2;                            // ChordFrets[]
+}
+
+// Return the size in bytes of the indexes every build has: the first voicing
+// of each key and type, the difficulty level and order of the voicings, the
+// voice leading graph and the posting lists.
+unsigned TableVariant::GetBaseIndexSize() const
+{
+    unsigned numTypes    = NUM_COMMON_TYPES + m_rSource.GetNumSuppTypes();
+    unsigned numVoicings = m_rSource.GetEntries().size();
+    return (NUM_KEYS * numTypes + 1) * sizeof(uint16_t) +   // ChordVoicingOffsets[]
+           numVoicings +                                     // ChordDifficulty[]
+           numVoicings * sizeof(uint16_t) +                  // ChordDifficultyOrder[]
+           (DifficultyIndex::NUM_LEVELS + 1) * sizeof(uint16_t) + // ChordDifficultyStarts[]
+           m_rVoiceLeading.GetBytes().size() +               // ChordNeighbors[]
+           m_rPostings.GetBytes().size();                    // ChordPostings[]
+}
+
+// Return the size in bytes of the reverse index (CHORD_REVERSE_INDEX).
+unsigned TableVariant::GetReverseIndexSize() const
+{
+    unsigned numVoicings = m_rSource.GetEntries().size();
+    return (m_rReverse.GetNumSlots() + 1) * sizeof(uint16_t) + // ChordReverseStarts[]
+           numVoicings * sizeof(uint16_t);                   // ChordReverseVoicings[]
+}
+
+// Return the size in bytes of the transposition index (CHORD_TRANSPOSE_INDEX).
+unsigned TableVariant::GetTransposeIndexSize() const
+{
+    unsigned numVoicings = m_rSource.GetEntries().size();
+    return (m_rTranspose.GetNumSlots() + 1) * sizeof(uint16_t) + // ChordTransposeStarts[]
+           numVoicings * sizeof(uint16_t);                   // ChordTransposeVoicings[]
+}
+
+// Return the size in bytes of all the generated indexes into the chord tables.
+unsigned TableVariant::GetIndexSize() const
+{
+    return GetBaseIndexSize() + GetReverseIndexSize() + GetTransposeIndexSize();
+}
+
+// Return the size in bytes the chord table would take without the shape
+// dictionary.
+unsigned TableVariant::GetUndedupedSize() const
+{
+    return m_rSource.GetEntries().size() * PACKED_CHORD_SIZE;
+}
+
+
+// Write the standard file banner.
+void TableWriter::WriteBanner(FILE *pFile, const char *pName, const char *pDescription)
+{
+    fprintf(pFile,
+        "/////////////////////////////////////////////////////////////////////////////////\n"
+        "// %s\n"
+        "//\n"
+        "// %s\n"
+        "//\n"
+        "// THIS FILE IS GENERATED by ChordTableCompiler from ChordTable.txt.  Do not\n"
+        "// edit it by hand.  Edit ChordTable.txt and re-run the compiler instead.\n"
+        "//\n"
+        "// Copyright (C) 2015-2016 Joseph M. Corbett\n"
+        "//\n"
+        "// This program is free software: you can redistribute it and/or modify it under\n"
+        "// the terms of the GNU General Public License as published by the Free Software\n"
+        "// Foundation, either version 3 of the License, or (at your option) any later\n"
+        "// version.\n"
+        "//\n"
+        "// This program is distributed in the hope that it will be useful, but\n"
+        "// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or\n"
+        "// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more\n"
+        "// details.\n"
+        "//\n"
+        "// You should have received a copy of the GNU General Public License along with\n"
+        "// this program. If not, see <http://www.gnu.org/licenses>.\n"
+        "//\n"
+        "/////////////////////////////////////////////////////////////////////////////////\n"
+        "\n",
+        pName, pDescription);
+}
+
+// Write the header of table counts.
+bool TableWriter::WriteHeader(const std::string &rPath)
+{
+    FILE *pFile = fopen(rPath.c_str(), "w");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "%s: error: can't create file\n", rPath.c_str());
+        return false;
+    }
+
+    WriteBanner(pFile, "ChordTable.h",
+                "Defines the sizes of the generated chord tables.");
+    fprintf(pFile,
+        "#if !defined CHORDTABLE_H\n"
+        "#define CHORDTABLE_H\n"
+        "\n"
+        "#include <avr/pgmspace.h>       // For uintXX_t.\n"
+        "#include \"ChordTableConfig.h\"    // For FULL_CHORD_LIBRARY and CHORD_PROGMEM.\n"
+        "\n"
+        "\n"
+        "#if FULL_CHORD_LIBRARY\n");
+    WriteConstants(pFile, m_rFull);
+    fprintf(pFile, "#else\n");
+    WriteConstants(pFile, m_rReduced);
+    fprintf(pFile,
+        "#endif\n"
+        "\n"
+        "// Bytes of FLASH used by the chord tables in this build.\n"
+        "const uint32_t CHORD_TABLE_BYTES           = CHORD_BASE_BYTES +\n"
+        "    (CHORD_REVERSE_INDEX ? CHORD_REVERSE_INDEX_BYTES : 0) +\n"
+        "    (CHORD_TRANSPOSE_INDEX ? CHORD_TRANSPOSE_INDEX_BYTES : 0);\n"
+        "\n"
+        "const unsigned CHORD_TABLE_STRINGS         = %u;   // Strings per voicing.\n"
+        "const unsigned CHORD_SHAPE_SIZE            = %u;   // Bytes per shape.\n"
+        "const unsigned CHORD_KEYFRAME_INTERVAL     = %u;  // Voicings per keyframe.\n"
+        "const unsigned NUM_DIFFICULTY_LEVELS       = %u;   // Easiest is 1.\n"
+        "const unsigned CHORD_NEIGHBORS             = %u;   // Neighbors per voicing.\n"
+        "const unsigned CHORD_FRET_BITS             = %u;   // Bits per starting fret.\n"
+        "\n"
+        "// The posting lists: one per string on each fret of a pattern, then one per\n"
+        "// string unplayed, then one per bit of the starting fret, each a bit per\n"
+        "// voicing.\n"
+        "const unsigned CHORD_POSTING_LISTS         = %u;\n"
+        "const unsigned CHORD_POSTING_BYTES         = (NUM_CHORD_VOICINGS + 7) / 8;\n"
+        "\n"
+        "// The tables are only in PROGMEM when they aren't read from the external\n"
+        "// store (see ChordStore.h).\n"
+        "#if !CHORD_EXTERNAL_STORE\n"
+        "\n"
+        "#if CHORD_DELTA_STREAM\n"
+        "// The voicings as a delta encoded stream (see ChordStream.h), and the byte\n"
+        "// offset of each keyframe in it.\n"
+        "extern const uint8_t  ChordStream[CHORD_STREAM_SIZE] CHORD_PROGMEM;\n"
+        "extern const uint16_t ChordStreamKeyframes[(NUM_CHORD_VOICINGS + CHORD_KEYFRAME_INTERVAL - 1) /\n"
+        "                                           CHORD_KEYFRAME_INTERVAL] CHORD_PROGMEM;\n"
+        "#else\n"
+        "// The packed shapes (see PackedShape in ChordChartData.h), the shape id of\n"
+        "// each voicing, and the starting fret of each voicing (two per byte).\n"
+        "extern const uint8_t ChordShapes[NUM_CHORD_SHAPES * CHORD_SHAPE_SIZE] CHORD_PROGMEM;\n"
+        "extern const uint8_t ChordShapeIds[NUM_CHORD_VOICINGS] CHORD_PROGMEM;\n"
+        "extern const uint8_t ChordFrets[(NUM_CHORD_VOICINGS + 1) / 2] CHORD_PROGMEM;\n"
+        "#endif\n"
+        "\n"
+        "// The index of the first voicing of each key and type, so finding a voicing\n"
+        "// is a single table read.  The extra last entry is NUM_CHORD_VOICINGS, so\n"
+        "// the difference of two adjacent entries is a variation count.\n"
+        "extern const uint16_t ChordVoicingOffsets[NUM_KEYS * NUM_CHORD_TYPES + 1] CHORD_PROGMEM;\n"
+        "\n"
+        "// The difficulty level of each voicing, the voicings sorted easiest first,\n"
+        "// and the rank in that order where each level starts (the extra last entry\n"
+        "// is NUM_CHORD_VOICINGS).\n"
+        "extern const uint8_t  ChordDifficulty[NUM_CHORD_VOICINGS] CHORD_PROGMEM;\n"
+        "extern const uint16_t ChordDifficultyOrder[NUM_CHORD_VOICINGS] CHORD_PROGMEM;\n"
+        "extern const uint16_t ChordDifficultyStarts[NUM_DIFFICULTY_LEVELS + 1] CHORD_PROGMEM;\n"
+        "\n"
+        "// The voice leading graph: the CHORD_NEIGHBORS voicings of other chords\n"
+        "// nearest each voicing, nearest first, as CHORD_NEIGHBOR_BITS bit voicing\n"
+        "// indexes packed least significant bit first.\n"
+        "extern const uint8_t  ChordNeighbors[CHORD_NEIGHBOR_BYTES] CHORD_PROGMEM;\n"
+        "\n"
+        "// The reverse index: the voicings sorted by the hash slot of their key (see\n"
+        "// ReverseChordFinderMode::GetIndexKey()), and the index of the first voicing\n"
+        "// of each slot (the extra last entry is NUM_CHORD_VOICINGS).\n"
+        "#if CHORD_REVERSE_INDEX\n"
+        "extern const uint16_t ChordReverseStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM;\n"
+        "extern const uint16_t ChordReverseVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM;\n"
+        "#endif\n"
+        "\n"
+        "// The transposition index: the same, with the starting fret left out of the\n"
+        "// key, so a slot holds every transposition of a shape.\n"
+        "#if CHORD_TRANSPOSE_INDEX\n"
+        "extern const uint16_t ChordTransposeStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM;\n"
+        "extern const uint16_t ChordTransposeVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM;\n"
+        "#endif\n"
+        "\n"
+        "// The posting lists, one after the other.  Bit n %% 8 of byte n / 8 of a list\n"
+        "// is voicing n.\n"
+        "extern const uint8_t  ChordPostings[CHORD_POSTING_LISTS * CHORD_POSTING_BYTES] CHORD_PROGMEM;\n"
+        "\n"
+        "#endif // !CHORD_EXTERNAL_STORE\n"
+        "\n"
+        "\n"
+        "#endif // CHORDTABLE_H\n",
+        NUM_STRINGS, TableVariant::PACKED_SHAPE_SIZE, DeltaStream::KEYFRAME_INTERVAL,
+        DifficultyIndex::NUM_LEVELS, VoiceLeading::NUM_NEIGHBORS, PostingLists::FRET_BITS,
+        PostingLists::NUM_LISTS);
+
+    return fclose(pFile) == 0;
+}
+
+// Write the counts of one variant of the chord table.
+void TableWriter::WriteConstants(FILE *pFile, const TableVariant &rVariant)
+{
+    const ChordSource &rSource = rVariant.GetSource();
+    unsigned numSuppTypes  = rSource.GetNumSuppTypes();
+
+    fprintf(pFile,
+        "\n"
+        "// The %s chord library.  Each key and type has its own number of\n"
+        "// variations (see ChordChartData::GetNumVariations()).\n"
+        "const unsigned NUM_COMMON_CHORDS           = %u;\n"
+        "const unsigned NUM_SUPP_CHORDS             = %u;\n"
+        "const unsigned NUM_KEYS                    = %u;\n"
+        "const unsigned NUM_CHORD_TYPES             = %u;\n"
+        "\n"
+        "// The most variations of any key and type, and voicings in the whole table.\n"
+        "const unsigned MAX_CHORD_VARIATIONS        = %u;\n"
+        "const unsigned NUM_CHORD_VOICINGS          = %u;\n"
+        "\n"
+        "// Unique shapes in the shape dictionary, and bytes in the delta stream.\n"
+        "const unsigned NUM_CHORD_SHAPES            = %u;\n"
+        "const unsigned CHORD_STREAM_SIZE           = %u;\n"
+        "\n"
+        "// Bits per voicing index in the voice leading graph, and its size.\n"
+        "const unsigned CHORD_NEIGHBOR_BITS         = %u;\n"
+        "const unsigned CHORD_NEIGHBOR_BYTES        = %u;\n"
+        "\n"
+        "// The reverse and transposition indexes have 2^CHORD_REVERSE_SLOT_BITS slots.\n"
+        "const unsigned CHORD_REVERSE_SLOT_BITS     = %u;\n"
+        "\n"
+        "// Bytes of FLASH used by the chord tables with the indexes every build has,\n"
+        "// and by each index ChordTableConfig.h can leave out.\n"
+        "#if CHORD_DELTA_STREAM\n"
+        "const uint32_t CHORD_BASE_BYTES            = %u;\n"
+        "#else\n"
+        "const uint32_t CHORD_BASE_BYTES            = %u;\n"
+        "#endif\n"
+        "const uint32_t CHORD_REVERSE_INDEX_BYTES   = %u;\n"
+        "const uint32_t CHORD_TRANSPOSE_INDEX_BYTES = %u;\n"
+        "\n",
+        rVariant.GetName(),
+        NUM_COMMON_TYPES, numSuppTypes, NUM_KEYS,
+        NUM_COMMON_TYPES + numSuppTypes,
+        rSource.GetMaxVariations(),
+        (unsigned)rSource.GetEntries().size(),
+        rVariant.GetShapes().GetNumShapes(),
+        (unsigned)rVariant.GetStream().GetBytes().size(),
+        rVariant.GetVoiceLeading().GetBits(),
+        (unsigned)rVariant.GetVoiceLeading().GetBytes().size(),
+        rVariant.GetReverse().GetSlotBits(),
+        rVariant.GetStream().GetSize() + rVariant.GetBaseIndexSize(),
+        rVariant.GetTableSize() + rVariant.GetBaseIndexSize(),
+        rVariant.GetReverseIndexSize(),
+        rVariant.GetTransposeIndexSize());
+}
+
+// Write a PACK_SHAPE() initializer.  Strings are listed low E first.
+void TableWriter::WriteShape(FILE *pFile, uint32_t shape)
+{
+    fprintf(pFile, "PACK_SHAPE(");
+    for (unsigned string = NUM_STRINGS; string-- != 0; )
+    {
+        unsigned offset = (shape >> (string * BITS_PER_STRING)) &
+                          ((1 << BITS_PER_STRING) - 1);
+        const char *pSeparator = string ? ", " : "";
+        if (offset == PACKED_UNPLAYED)
+        {
+            fprintf(pFile, "X%s", pSeparator);
+        }
+        else
+        {
+            fprintf(pFile, "%u%s", offset, pSeparator);
+        }
+    }
+    fprintf(pFile, ")");
+}
+
+// Write the PROGMEM chord tables of both variants.
+bool TableWriter::WriteTable(const std::string &rPath)
+{
+    FILE *pFile = fopen(rPath.c_str(), "w");
+    if (pFile == NULL)
+    {
+        fprintf(stderr, "%s: error: can't create file\n", rPath.c_str());
+        return false;
+    }
+
+    WriteBanner(pFile, "ChordTable.cpp",
+                "Contains the packed chord tables stored in FLASH.");
+    fprintf(pFile,
+        "#include \"ChordChartData.h\"     // For PACK_SHAPE() and PACK_FRETS().\n"
+        "\n"
+        "\n"
+        "// Each PACK_SHAPE() lists the fret offset of each string from low E to\n"
+        "// high E.  0 is an open string, and X is an unplayed string.  Each shape is\n"
+        "// commented with the first chord that uses it.\n"
+        "#define X PackedShape::PACKED_UNPLAYED\n"
+        "\n"
+        "#if !CHORD_EXTERNAL_STORE\n"
+        "#if FULL_CHORD_LIBRARY\n");
+    WriteArrays(pFile, m_rFull);
+    WriteDifficultyArrays(pFile, m_rFull);
+    WriteNeighborArray(pFile, m_rFull);
+    WriteReverseArrays(pFile, m_rFull);
+    WritePostingArray(pFile, m_rFull);
+    fprintf(pFile, "#else\n");
+    WriteArrays(pFile, m_rReduced);
+    WriteDifficultyArrays(pFile, m_rReduced);
+    WriteNeighborArray(pFile, m_rReduced);
+    WriteReverseArrays(pFile, m_rReduced);
+    WritePostingArray(pFile, m_rReduced);
+    fprintf(pFile,
+        "#endif\n"
+        "#endif // !CHORD_EXTERNAL_STORE\n"
+        "\n"
+        "#undef X\n");
+
+    return fclose(pFile) == 0;
+}
+
+// Write the PROGMEM chord tables of one variant.  The shape ids are written
+// one line of variations per chord type.
+void TableWriter::WriteArrays(FILE *pFile, const TableVariant &rVariant)
+{
+    const std::vector<ChordEntry> &rEntries = rVariant.GetSource().GetEntries();
+    const ShapeDictionary &rShapes = rVariant.GetShapes();
+
+    fprintf(pFile, "\n#if CHORD_DELTA_STREAM\n");
+    WriteStreamArrays(pFile, rVariant);
+    fprintf(pFile,
+        "#else\n"
+        "\n"
+        "// The shape dictionary of the %s chord library.\n"
+        "const uint8_t ChordShapes[NUM_CHORD_SHAPES * CHORD_SHAPE_SIZE] CHORD_PROGMEM =\n"
+        "{\n",
+        rVariant.GetName());
+
+    for (unsigned id = 0; id < rShapes.GetNumShapes(); id++)
+    {
+        const ChordEntry &rEntry = rEntries[rShapes.GetFirstUse(id)];
+        fprintf(pFile, "    ");
+        WriteShape(pFile, rShapes.GetShape(id));
+        fprintf(pFile, "%s   // %3u: %s %s %u\n",
+                (id + 1 == rShapes.GetNumShapes()) ? " " : ",", id,
+                ChordSource::GetKeyName(rEntry.m_Key),
+                ChordSource::GetTypeLongName(rEntry.m_Type),
+                rEntry.m_Variation + 1);
+    }
+
+    fprintf(pFile,
+        "};\n"
+        "\n"
+        "// The shape id of each voicing, in key, type, variation order.\n"
+        "const uint8_t ChordShapeIds[NUM_CHORD_VOICINGS] CHORD_PROGMEM =\n"
+        "{");
+
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        const ChordEntry &rEntry = rEntries[i];
+        bool last = (i + 1 == rEntries.size());
+
+        // Start each type on a new line.
+        if (rEntry.m_Variation == 0)
+        {
+            fprintf(pFile, "\n    ");
+        }
+        fprintf(pFile, "%3u%s", rShapes.GetShapeId(i), last ? " " : ", ");
+
+        // Name the type at the end of its line.
+        if (last || (rEntries[i + 1].m_Variation == 0))
+        {
+            fprintf(pFile, "   // %s %s", ChordSource::GetKeyName(rEntry.m_Key),
+                    ChordSource::GetTypeLongName(rEntry.m_Type));
+        }
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n"
+        "\n"
+        "// The starting fret of each voicing.  Each PACK_FRETS() holds two voicings,\n"
+        "// one key per line.\n"
+        "const uint8_t ChordFrets[(NUM_CHORD_VOICINGS + 1) / 2] CHORD_PROGMEM =\n"
+        "{");
+
+    for (size_t i = 0; i < rEntries.size(); i += 2)
+    {
+        unsigned odd = (i + 1 < rEntries.size()) ? rEntries[i + 1].GetBaseFret() : 0;
+
+        // Start each key on a new line, with at most 4 bytes per line.
+        if ((i == 0) || (rEntries[i].m_Key != rEntries[i - 2].m_Key))
+        {
+            fprintf(pFile, "%s\n    // %s\n    ", i ? "," : "",
+                    ChordSource::GetKeyName(rEntries[i].m_Key));
+        }
+        else
+        {
+            fprintf(pFile, (i % 8) ? ", " : ",\n    ");
+        }
+        fprintf(pFile, "PACK_FRETS(%u, %u)", rEntries[i].GetBaseFret(), odd);
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n"
+        "#endif\n"
+        "\n"
+        "// The index of the first voicing of each type, one key per line, then the\n"
+        "// end of the table.\n"
+        "const uint16_t ChordVoicingOffsets[NUM_KEYS * NUM_CHORD_TYPES + 1] CHORD_PROGMEM =\n"
+        "{");
+
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        const ChordEntry &rEntry = rEntries[i];
+        if (rEntry.m_Variation != 0)
+        {
+            continue;
+        }
+
+        // Start each key on a new line, with at most 12 types per line.
+        if (rEntry.m_Type == 0)
+        {
+            fprintf(pFile, "%s\n    // %s\n    ", i ? "," : "",
+                    ChordSource::GetKeyName(rEntry.m_Key));
+        }
+        else
+        {
+            fprintf(pFile, (rEntry.m_Type % 12) ? ", " : ",\n    ");
+        }
+        fprintf(pFile, "%3u", (unsigned)i);
+    }
+
+    fprintf(pFile,
+        ",\n"
+        "    // End\n"
+        "    %3u\n"
+        "};\n",
+        (unsigned)rEntries.size());
+}
+
+// Write the delta stream of one variant, 16 bytes per line, and the offset of
+// each keyframe, 12 per line.
+void TableWriter::WriteStreamArrays(FILE *pFile, const TableVariant &rVariant)
+{
+    const DeltaStream &rStream = rVariant.GetStream();
+    const std::vector<uint8_t> &rBytes = rStream.GetBytes();
+
+    fprintf(pFile,
+        "\n"
+        "// The delta encoded voicings of the %s chord library.\n"
+        "const uint8_t ChordStream[CHORD_STREAM_SIZE] CHORD_PROGMEM =\n"
+        "{",
+        rVariant.GetName());
+
+    for (size_t i = 0; i < rBytes.size(); i++)
+    {
+        fprintf(pFile, "%s0x%02x", i ? ((i % 16) ? ", " : ",\n    ") : "\n    ", rBytes[i]);
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n"
+        "\n"
+        "// The byte offset in ChordStream[] of every CHORD_KEYFRAME_INTERVAL'th voicing.\n"
+        "const uint16_t ChordStreamKeyframes[(NUM_CHORD_VOICINGS + CHORD_KEYFRAME_INTERVAL - 1) /\n"
+        "                                    CHORD_KEYFRAME_INTERVAL] CHORD_PROGMEM =\n"
+        "{");
+
+    for (unsigned i = 0; i < rStream.GetNumKeyframes(); i++)
+    {
+        fprintf(pFile, "%s%4u", i ? ((i % 12) ? ", " : ",\n    ") : "\n    ",
+                rStream.GetKeyframe(i));
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n"
+        "\n");
+}
+
+// Write the difficulty tables of one variant.  The levels are written one
+// key per line, and the sorted order 12 voicings per line.
+void TableWriter::WriteDifficultyArrays(FILE *pFile, const TableVariant &rVariant)
+{
+    const std::vector<ChordEntry> &rEntries = rVariant.GetSource().GetEntries();
+    const DifficultyIndex &rDifficulty = rVariant.GetDifficulty();
+
+    fprintf(pFile,
+        "\n"
+        "// The difficulty level of each voicing, one key per line.\n"
+        "const uint8_t ChordDifficulty[NUM_CHORD_VOICINGS] CHORD_PROGMEM =\n"
+        "{");
+
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        if ((i == 0) || (rEntries[i].m_Key != rEntries[i - 1].m_Key))
+        {
+            fprintf(pFile, "%s\n    // %s\n    ", i ? "," : "",
+                    ChordSource::GetKeyName(rEntries[i].m_Key));
+        }
+        else
+        {
+            fprintf(pFile, (i % 24) ? ", " : ",\n    ");
+        }
+        fprintf(pFile, "%u", rDifficulty.GetLevel(i));
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n"
+        "\n"
+        "// The voicings sorted by difficulty, easiest first.\n"
+        "const uint16_t ChordDifficultyOrder[NUM_CHORD_VOICINGS] CHORD_PROGMEM =\n"
+        "{");
+
+    for (size_t rank = 0; rank < rEntries.size(); rank++)
+    {
+        fprintf(pFile, "%s%3u", rank ? ((rank % 12) ? ", " : ",\n    ") : "\n    ",
+                rDifficulty.GetOrder(rank));
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n"
+        "\n"
+        "// The rank in ChordDifficultyOrder[] of the first voicing of each level.\n"
+        "const uint16_t ChordDifficultyStarts[NUM_DIFFICULTY_LEVELS + 1] CHORD_PROGMEM =\n"
+        "{\n"
+        "    ");
+
+    for (unsigned level = 1; level <= DifficultyIndex::NUM_LEVELS; level++)
+    {
+        fprintf(pFile, "%u, ", rDifficulty.GetLevelStart(level));
+    }
+
+    fprintf(pFile,
+        "%u\n"
+        "};\n",
+        (unsigned)rEntries.size());
+}
+
+// Write the voice leading graph of one variant, 16 bytes per line.
+void TableWriter::WriteNeighborArray(FILE *pFile, const TableVariant &rVariant)
+{
+    const std::vector<uint8_t> &rBytes = rVariant.GetVoiceLeading().GetBytes();
+
+    fprintf(pFile,
+        "\n"
+        "// The voice leading graph, CHORD_NEIGHBORS voicings of other chords per voicing.\n"
+        "const uint8_t ChordNeighbors[CHORD_NEIGHBOR_BYTES] CHORD_PROGMEM =\n"
+        "{");
+
+    for (size_t i = 0; i < rBytes.size(); i++)
+    {
+        fprintf(pFile, "%s0x%02x", i ? ((i % 16) ? ", " : ",\n    ") : "\n    ", rBytes[i]);
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n");
+}
+
+// Write the reverse and transposition indexes of one variant.
+void TableWriter::WriteReverseArrays(FILE *pFile, const TableVariant &rVariant)
+{
+    unsigned numVoicings = rVariant.GetSource().GetEntries().size();
+    fprintf(pFile, "\n#if CHORD_REVERSE_INDEX");
+    WriteIndexArrays(pFile, rVariant.GetReverse(), numVoicings, "Reverse", "their key");
+    fprintf(pFile, "#endif\n");
+    fprintf(pFile, "\n#if CHORD_TRANSPOSE_INDEX");
+    WriteIndexArrays(pFile, rVariant.GetTranspose(), numVoicings, "Transpose",
+                     "their key without the starting fret");
+    fprintf(pFile, "#endif\n");
+}
+
+// Write one reverse index, 12 entries per line.
+// pName - Name of the arrays, between "Chord" and "Starts" or "Voicings".
+// pKey  - What the voicings are hashed by, for the comment.
+void TableWriter::WriteIndexArrays(FILE *pFile, const ReverseIndex &rIndex, unsigned numVoicings,
+                                   const char *pName, const char *pKey)
+{
+    fprintf(pFile,
+        "\n"
+        "// The index in Chord%sVoicings[] of the first voicing of each slot.\n"
+        "const uint16_t Chord%sStarts[(1 << CHORD_REVERSE_SLOT_BITS) + 1] CHORD_PROGMEM =\n"
+        "{", pName, pName);
+
+    for (unsigned slot = 0; slot <= rIndex.GetNumSlots(); slot++)
+    {
+        fprintf(pFile, "%s%3u", slot ? ((slot % 12) ? ", " : ",\n    ") : "\n    ",
+                rIndex.GetSlotStart(slot));
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n"
+        "\n"
+        "// The voicings sorted by the slot of %s.\n"
+        "const uint16_t Chord%sVoicings[NUM_CHORD_VOICINGS] CHORD_PROGMEM =\n"
+        "{", pKey, pName);
+
+    for (unsigned i = 0; i < numVoicings; i++)
+    {
+        fprintf(pFile, "%s%3u", i ? ((i % 12) ? ", " : ",\n    ") : "\n    ",
+                rIndex.GetVoicing(i));
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n");
+}
+
+// Write the posting lists of one variant, one list per line (wrapped at 16
+// bytes), each named by its string and fret.
+void TableWriter::WritePostingArray(FILE *pFile, const TableVariant &rVariant)
+{
+    const PostingLists &rPostings = rVariant.GetPostings();
+    const std::vector<uint8_t> &rBytes = rPostings.GetBytes();
+    unsigned listBytes = rPostings.GetListBytes();
+
+    fprintf(pFile,
+        "\n"
+        "// The posting lists.  Strings are numbered high E first.\n"
+        "const uint8_t ChordPostings[CHORD_POSTING_LISTS * CHORD_POSTING_BYTES] CHORD_PROGMEM =\n"
+        "{");
+
+    for (unsigned list = 0; list < PostingLists::NUM_LISTS; list++)
+    {
+        unsigned row    = list / NUM_STRINGS;
+        unsigned string = list % NUM_STRINGS;
+        if (list >= PostingLists::GetFretList(0))
+        {
+            fprintf(pFile, "%s\n    // Starting fret bit %u\n    ", list ? "," : "",
+                    list - PostingLists::GetFretList(0));
+        }
+        else if (row == NUM_PATTERN_FRETS)
+        {
+            fprintf(pFile, "%s\n    // String %u unplayed\n    ", list ? "," : "", string);
+        }
+        else
+        {
+            fprintf(pFile, "%s\n    // String %u on fret %u\n    ", list ? "," : "", string,
+                    row + 1);
+        }
+        for (unsigned i = 0; i < listBytes; i++)
+        {
+            fprintf(pFile, "%s0x%02x", i ? ((i % 16) ? ", " : ",\n    ") : "",
+                    rBytes[list * listBytes + i]);
+        }
+    }
+
+    fprintf(pFile,
+        "\n"
+        "};\n");
+}
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////
+// TableWriter.h
+//
+// Defines the class used by the chord table compiler to write the generated
+// chord table files (ChordTable.h and ChordTable.cpp) used by the firmware.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined TABLEWRITER_H
+#define TABLEWRITER_H
+
+#include <stdio.h>
+#include <string>
+#include "ChordSource.h"
+#include "ShapeDictionary.h"
+#include "DifficultyIndex.h"
+#include "DeltaStream.h"
+#include "VoiceLeading.h"
+#include "ReverseIndex.h"
+#include "PostingLists.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// TableVariant class.  One build variant of the chord table: the chords it
+// holds, their shape dictionary, their delta stream, their difficulty index,
+// their voice leading graph, their reverse and transposition indexes and
+// their posting lists.
+/////////////////////////////////////////////////////////////////////////////////
+class TableVariant
+{
+public:
+    TableVariant(const char *pName, const ChordSource &rSource, const ShapeDictionary &rShapes,
+                 const DeltaStream &rStream, const DifficultyIndex &rDifficulty,
+                 const VoiceLeading &rVoiceLeading, const ReverseIndex &rReverse,
+                 const ReverseIndex &rTranspose, const PostingLists &rPostings) :
+        m_pName(pName), m_rSource(rSource), m_rShapes(rShapes), m_rStream(rStream),
+        m_rDifficulty(rDifficulty), m_rVoiceLeading(rVoiceLeading), m_rReverse(rReverse),
+        m_rTranspose(rTranspose), m_rPostings(rPostings) { }
+
+    const char            *GetName() const       { return m_pName; }
+    const ChordSource     &GetSource() const     { return m_rSource; }
+    const ShapeDictionary &GetShapes() const     { return m_rShapes; }
+    const DeltaStream     &GetStream() const     { return m_rStream; }
+    const DifficultyIndex &GetDifficulty() const { return m_rDifficulty; }
+    const VoiceLeading    &GetVoiceLeading() const { return m_rVoiceLeading; }
+    const ReverseIndex    &GetReverse() const    { return m_rReverse; }
+    const ReverseIndex    &GetTranspose() const  { return m_rTranspose; }
+    const PostingLists    &GetPostings() const   { return m_rPostings; }
+
+    unsigned GetTableSize() const;
+    unsigned GetBaseIndexSize() const;
+    unsigned GetReverseIndexSize() const;
+    unsigned GetTransposeIndexSize() const;
+    unsigned GetIndexSize() const;
+    unsigned GetUndedupedSize() const;
+
+    // Bytes per packed shape (see PackedShape in ChordChartData.h).
+    static const unsigned PACKED_SHAPE_SIZE = 3;
+
+    // Bytes per voicing when each voicing stores its own packed shape and
+    // starting fret.  Used to report the savings of the shape dictionary.
+    static const unsigned PACKED_CHORD_SIZE = 3;
+
+protected:
+
+private:
+    const char            *m_pName;
+    const ChordSource     &m_rSource;
+    const ShapeDictionary &m_rShapes;
+    const DeltaStream     &m_rStream;
+    const DifficultyIndex &m_rDifficulty;
+    const VoiceLeading    &m_rVoiceLeading;
+    const ReverseIndex    &m_rReverse;
+    const ReverseIndex    &m_rTranspose;
+    const PostingLists    &m_rPostings;
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// TableWriter class.  Writes the full and the reduced chord library into the
+// same files.  ChordTableConfig.h selects between them with
+// FULL_CHORD_LIBRARY.
+/////////////////////////////////////////////////////////////////////////////////
+class TableWriter
+{
+public:
+    TableWriter(const TableVariant &rFull, const TableVariant &rReduced) :
+        m_rFull(rFull), m_rReduced(rReduced) { }
+
+    bool Write(const std::string &rOutputDir);
+
+protected:
+
+private:
+    // Unimplemented methods.
+    TableWriter(const TableWriter &);
+    TableWriter &operator=(const TableWriter &);
+
+    bool WriteHeader(const std::string &rPath);
+    bool WriteTable(const std::string &rPath);
+    void WriteBanner(FILE *pFile, const char *pName, const char *pDescription);
+    void WriteConstants(FILE *pFile, const TableVariant &rVariant);
+    void WriteArrays(FILE *pFile, const TableVariant &rVariant);
+    void WriteStreamArrays(FILE *pFile, const TableVariant &rVariant);
+    void WriteDifficultyArrays(FILE *pFile, const TableVariant &rVariant);
+    void WriteNeighborArray(FILE *pFile, const TableVariant &rVariant);
+    void WriteReverseArrays(FILE *pFile, const TableVariant &rVariant);
+    void WriteIndexArrays(FILE *pFile, const ReverseIndex &rIndex, unsigned numVoicings,
+                          const char *pName, const char *pKey);
+    void WritePostingArray(FILE *pFile, const TableVariant &rVariant);
+    void WriteShape(FILE *pFile, uint32_t shape);
+
+    const TableVariant &m_rFull;
+    const TableVariant &m_rReduced;
+};
+
+#endif // TABLEWRITER_H
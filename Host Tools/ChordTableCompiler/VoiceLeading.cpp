@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////
+// VoiceLeading.cpp
+//
+// Implements the VoiceLeading class used by the chord table compiler to find
+// the voicings of other chords nearest each voicing.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "VoiceLeading.h"
+#include <stdlib.h>
+#include <algorithm>
+
+
+// Return how far the hand moves from one voicing to another: the frets each
+// fretted string moves, plus one for each finger placed or lifted and each
+// string that starts or stops being played.
+unsigned VoiceLeading::GetCost(const ChordEntry &rFrom, const ChordEntry &rTo)
+{
+    unsigned cost = 0;
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        int from = rFrom.m_Frets[string];
+        int to   = rTo.m_Frets[string];
+        if ((from > 0) && (to > 0))
+        {
+            cost += abs(from - to);
+        }
+        else if (from != to)
+        {
+            cost++;
+        }
+    }
+    return cost;
+}
+
+
+// Find the neighbors of every entry and pack them.  A neighbor is the nearest
+// voicing of another key or type.  Voicings that are fingered the same (such
+// as C6 and Am7) are the same hand position, so they aren't neighbors.  Ties
+// go to the earlier voicing in the table.
+void VoiceLeading::Build(const ChordSource &rSource)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    unsigned numEntries = rEntries.size();
+
+    m_Neighbors.clear();
+    m_Bytes.clear();
+    m_Bits = 1;
+    while ((1u << m_Bits) < numEntries)
+    {
+        m_Bits++;
+    }
+
+    std::vector<unsigned> nearest(NUM_KEYS * NUM_TYPES);
+    std::vector<unsigned> costs(NUM_KEYS * NUM_TYPES);
+    for (unsigned i = 0; i < numEntries; i++)
+    {
+        const ChordEntry &rFrom = rEntries[i];
+
+        // The nearest voicing of each other chord.
+        std::fill(costs.begin(), costs.end(), ~0u);
+        for (unsigned j = 0; j < numEntries; j++)
+        {
+            const ChordEntry &rTo = rEntries[j];
+            unsigned chord = rTo.m_Key * NUM_TYPES + rTo.m_Type;
+            unsigned cost = GetCost(rFrom, rTo);
+            if ((cost != 0) && (cost < costs[chord]) &&
+                ((rTo.m_Key != rFrom.m_Key) || (rTo.m_Type != rFrom.m_Type)))
+            {
+                costs[chord]   = cost;
+                nearest[chord] = j;
+            }
+        }
+
+        // The nearest chords, then table order.
+        std::vector<unsigned> chords;
+        for (unsigned chord = 0; chord < costs.size(); chord++)
+        {
+            if (costs[chord] != ~0u)
+            {
+                chords.push_back(chord);
+            }
+        }
+        std::stable_sort(chords.begin(), chords.end(),
+                         [&](unsigned a, unsigned b)
+                         {
+                             return (costs[a] != costs[b]) ? (costs[a] < costs[b]) :
+                                                             (nearest[a] < nearest[b]);
+                         });
+
+        // A library too small to have enough other chords repeats the last
+        // neighbor, or the voicing itself if it has none.
+        for (unsigned rank = 0; rank < NUM_NEIGHBORS; rank++)
+        {
+            unsigned neighbor = chords.empty() ? i :
+                                nearest[chords[std::min(rank, (unsigned)chords.size() - 1)]];
+            m_Neighbors.push_back(neighbor);
+        }
+    }
+
+    // Pack the neighbors, least significant bit first.
+    unsigned bit = 0;
+    for (size_t i = 0; i < m_Neighbors.size(); i++)
+    {
+        for (unsigned n = 0; n < m_Bits; n++, bit++)
+        {
+            if (bit % 8 == 0)
+            {
+                m_Bytes.push_back(0);
+            }
+            if (m_Neighbors[i] & (1 << n))
+            {
+                m_Bytes.back() |= 1 << (bit % 8);
+            }
+        }
+    }
+}
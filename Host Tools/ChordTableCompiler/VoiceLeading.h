@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////
+// VoiceLeading.h
+//
+// Defines the VoiceLeading class used by the chord table compiler to find the
+// voicings of other chords nearest each voicing.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#if !defined VOICELEADING_H
+#define VOICELEADING_H
+
+#include <stdint.h>
+#include <vector>
+#include "ChordSource.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// VoiceLeading class.  The voice leading graph: for each voicing, the
+// NUM_NEIGHBORS voicings of other chords the hand moves least to reach, one
+// per chord, nearest first.  The sketch steps through them to move to a new
+// chord with the least finger movement.  Each neighbor is stored as a voicing
+// index of GetBits() bits, packed least significant first, so a neighbor is
+// found with one multiplication.
+/////////////////////////////////////////////////////////////////////////////////
+class VoiceLeading
+{
+public:
+    VoiceLeading() : m_Bits(0) { }
+
+    void Build(const ChordSource &rSource);
+
+    unsigned GetNeighbor(unsigned entry, unsigned rank) const
+    {
+        return m_Neighbors[entry * NUM_NEIGHBORS + rank];
+    }
+    unsigned GetBits() const                { return m_Bits; }
+    const std::vector<uint8_t> &GetBytes() const { return m_Bytes; }
+
+    static unsigned GetCost(const ChordEntry &rFrom, const ChordEntry &rTo);
+
+    // Neighbors of each voicing.  This must match ChordStore.h.
+    static const unsigned NUM_NEIGHBORS = 4;
+
+protected:
+
+private:
+    // Unimplemented methods.
+    VoiceLeading(const VoiceLeading &);
+    VoiceLeading &operator=(const VoiceLeading &);
+
+    std::vector<unsigned> m_Neighbors;  // NUM_NEIGHBORS per entry.
+    unsigned              m_Bits;       // Bits per packed neighbor.
+    std::vector<uint8_t>  m_Bytes;      // The packed neighbors.
+};
+
+#endif // VOICELEADING_H
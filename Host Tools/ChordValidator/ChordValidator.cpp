@@ -0,0 +1,295 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordValidator.cpp
+//
+// Contains main() for the chord validator.  This host (Linux) program reads
+// ChordTable.txt, finds the notes of every voicing in standard tuning, and
+// checks them against the sketch's interval formula for the voicing's chord
+// type.  It reports voicings without their root, voicings with notes outside
+// the formula or missing a required interval, and duplicate voicings of the
+// same chord.  The voicings are split across all the cores.
+//
+// Usage: ChordValidator [-j <threads>] <ChordTable.txt>
+//     -j  Worker threads (default: one per core).
+//
+// The exit status is 0 if every voicing is valid, 1 if any problem was found
+// and 2 for a usage or file error.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ChordFormulas.h"          // From the sketch.
+#include "ChordSource.h"            // From ChordTableCompiler.
+
+
+static const char *IntervalNames[12] =
+{
+    "R", "b9", "9", "m3", "3", "11", "b5", "5", "#5", "6", "b7", "7"
+};
+
+// Marks a voicing that doesn't repeat an earlier one.
+static const unsigned NOT_DUPLICATE = (unsigned)-1;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// VoicingCheck structure.  The result of checking one voicing.  Each worker
+// thread writes only the checks of its own voicings, so no locking is needed.
+/////////////////////////////////////////////////////////////////////////////////
+struct VoicingCheck
+{
+    uint16_t m_Intervals;               // Intervals played, bit 0 the root.
+    uint16_t m_Extra;                   // Intervals outside the formula.
+    uint16_t m_Missing;                 // Required intervals not played (not
+                                        // the root).
+    unsigned m_Duplicate;               // Index of an earlier identical
+                                        // voicing of the chord, or NOT_DUPLICATE.
+
+    bool HasRoot() const    { return (m_Intervals & 1) != 0; }
+    bool IsValid() const
+    {
+        return HasRoot() && (m_Extra == 0) && (m_Missing == 0) &&
+               (m_Duplicate == NOT_DUPLICATE);
+    }
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// ChordValidator class.  Checks the voicings of a chord source.
+/////////////////////////////////////////////////////////////////////////////////
+class ChordValidator
+{
+public:
+    ChordValidator(const ChordSource &rSource);
+
+    void Run(unsigned numThreads);
+    unsigned Report() const;
+
+protected:
+
+private:
+    void Check(size_t first, size_t last);
+    void CheckVoicing(size_t index);
+
+    static std::string FormatIntervals(uint16_t intervals);
+
+    const ChordSource                   &m_rSource;
+    std::vector<VoicingCheck>            m_Checks;
+    std::vector<std::vector<unsigned> >  m_Chords;  // Voicing indexes of each
+                                                    // key and type.
+};
+
+
+ChordValidator::ChordValidator(const ChordSource &rSource) :
+    m_rSource(rSource),
+    m_Checks(rSource.GetEntries().size()),
+    m_Chords(NUM_KEYS * NUM_TYPES)
+{
+    // Group the voicings by chord, so duplicates are only looked for among
+    // the few variations of the same chord.
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    for (size_t i = 0; i < rEntries.size(); i++)
+    {
+        m_Chords[rEntries[i].m_Key * NUM_TYPES + rEntries[i].m_Type].push_back(i);
+    }
+}
+
+
+// Check every voicing, split into one contiguous range per thread.
+void ChordValidator::Run(unsigned numThreads)
+{
+    size_t numVoicings = m_Checks.size();
+    size_t perThread = (numVoicings + numThreads - 1) / numThreads;
+    std::vector<std::thread> threads;
+
+    for (size_t first = 0; first < numVoicings; first += perThread)
+    {
+        size_t last = std::min(first + perThread, numVoicings);
+        threads.push_back(std::thread(&ChordValidator::Check, this, first, last));
+    }
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+}
+
+
+// Check the voicings from first up to (not including) last.
+void ChordValidator::Check(size_t first, size_t last)
+{
+    for (size_t i = first; i < last; i++)
+    {
+        CheckVoicing(i);
+    }
+}
+
+
+void ChordValidator::CheckVoicing(size_t index)
+{
+    const ChordEntry &rEntry = m_rSource.GetEntries()[index];
+    VoicingCheck &rCheck = m_Checks[index];
+
+    // Collect the pitch classes played, then rotate them down by the key so
+    // they are intervals above the root, in the same form as the formulas.
+    uint16_t pitches = 0;
+    for (unsigned string = 0; string < NUM_STRINGS; string++)
+    {
+        if (rEntry.m_Frets[string] != UNPLAYED)
+        {
+            uint8_t note = ChordFormulas::GetOpenNote(TuningStandard, string) +
+                           rEntry.m_Frets[string];
+            pitches |= 1 << ChordFormulas::GetPitchClass(note);
+        }
+    }
+    rCheck.m_Intervals = ((pitches >> rEntry.m_Key) | (pitches << (12 - rEntry.m_Key))) & 0xfff;
+    rCheck.m_Extra     = rCheck.m_Intervals & ~ChordFormulas::GetAllowed(rEntry.m_Type);
+    rCheck.m_Missing   = ChordFormulas::GetRequired(rEntry.m_Type) & ~rCheck.m_Intervals & ~1;
+
+    // Look for an earlier variation of the chord with the same frets.
+    rCheck.m_Duplicate = NOT_DUPLICATE;
+    const std::vector<unsigned> &rChord = m_Chords[rEntry.m_Key * NUM_TYPES + rEntry.m_Type];
+    for (size_t i = 0; (i < rChord.size()) && (rChord[i] < index); i++)
+    {
+        const ChordEntry &rOther = m_rSource.GetEntries()[rChord[i]];
+        if (memcmp(rOther.m_Frets, rEntry.m_Frets, sizeof(rEntry.m_Frets)) == 0)
+        {
+            rCheck.m_Duplicate = rChord[i];
+            break;
+        }
+    }
+}
+
+
+// Report each invalid voicing, in source order.  Returns the number reported.
+unsigned ChordValidator::Report() const
+{
+    const std::vector<ChordEntry> &rEntries = m_rSource.GetEntries();
+    unsigned numInvalid = 0;
+
+    for (size_t i = 0; i < m_Checks.size(); i++)
+    {
+        const VoicingCheck &rCheck = m_Checks[i];
+        if (rCheck.IsValid())
+        {
+            continue;
+        }
+
+        const ChordEntry &rEntry = rEntries[i];
+        printf("%s:%u: %s%s variation %u (plays %s):", m_rSource.GetPath().c_str(),
+               rEntry.m_Line, ChordSource::GetKeyName(rEntry.m_Key),
+               ChordSource::GetTypeName(rEntry.m_Type), rEntry.m_Variation + 1,
+               FormatIntervals(rCheck.m_Intervals).c_str());
+        if (!rCheck.HasRoot())
+        {
+            printf(" no root;");
+        }
+        if (rCheck.m_Extra != 0)
+        {
+            printf(" %s not in the chord;", FormatIntervals(rCheck.m_Extra).c_str());
+        }
+        if (rCheck.m_Missing != 0)
+        {
+            printf(" missing %s;", FormatIntervals(rCheck.m_Missing).c_str());
+        }
+        if (rCheck.m_Duplicate != NOT_DUPLICATE)
+        {
+            printf(" same as variation %u (line %u);",
+                   rEntries[rCheck.m_Duplicate].m_Variation + 1,
+                   rEntries[rCheck.m_Duplicate].m_Line);
+        }
+        printf("\n");
+        numInvalid++;
+    }
+    return numInvalid;
+}
+
+
+// Return the names of a set of intervals, root first, separated by spaces.
+std::string ChordValidator::FormatIntervals(uint16_t intervals)
+{
+    std::string names;
+    for (unsigned interval = 0; interval < 12; interval++)
+    {
+        if ((intervals & (1 << interval)) != 0)
+        {
+            if (!names.empty())
+            {
+                names += ' ';
+            }
+            names += IntervalNames[interval];
+        }
+    }
+    return names.empty() ? "nothing" : names;
+}
+
+
+int main(int argc, char *argv[])
+{
+    unsigned numThreads = std::thread::hardware_concurrency();
+    bool     usage      = false;
+    int      option;
+
+    while ((option = getopt(argc, argv, "j:")) != -1)
+    {
+        switch (option)
+        {
+        case 'j':
+            numThreads = atoi(optarg);
+            break;
+
+        default:
+            usage = true;
+            break;
+        }
+    }
+    if (usage || (optind != argc - 1))
+    {
+        fprintf(stderr, "Usage: %s [-j <threads>] <ChordTable.txt>\n", argv[0]);
+        return 2;
+    }
+    if (numThreads == 0)
+    {
+        numThreads = 1;
+    }
+
+    ChordSource source;
+    if (!source.Load(argv[optind]))
+    {
+        return 2;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ChordValidator validator(source);
+    validator.Run(numThreads);
+    double millis = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start).count();
+
+    unsigned numInvalid = validator.Report();
+    printf("%zu voicings checked, %u invalid, %.2f ms on %u threads\n",
+           source.GetEntries().size(), numInvalid, millis, numThreads);
+    return (numInvalid == 0) ? 0 : 1;
+}
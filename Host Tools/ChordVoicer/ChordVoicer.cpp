@@ -0,0 +1,223 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ChordVoicer.cpp
+//
+// Contains main() for the chord voicer.  This host (Linux) program runs the
+// sketch's VoicingEnumerator for every key and chord type, ranks the voicings
+// of each chord, and reports how many were found and how long it took.  It can
+// also write the best voicings of each chord in ChordTable.txt format, as a
+// starting point for more variations in the chord table.
+//
+// Usage: ChordVoicer [-t <tuning>] [-a] [-n <count>]
+//     -t  Tuning: standard (default), dropd, dadgad or openg.
+//     -a  Allow any chord tone in the bass, not just the root.
+//     -n  Write the best <count> voicings of each chord to stdout.
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "ChordFormulas.h"          // From the sketch.
+#include "VoicingEnumerator.h"      // From the sketch.
+#include "ChordSource.h"            // From ChordTableCompiler, for the names.
+
+
+// Full enumerations timed for the benchmark.
+static const unsigned ITERATIONS = 10;
+
+static const char *TuningNames[NUM_TUNINGS] = { "standard", "dropd", "dadgad", "openg" };
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// VoicingList class.  Collects the voicings of one chord.
+/////////////////////////////////////////////////////////////////////////////////
+class VoicingList : public VoicingEnumerator::Visitor
+{
+public:
+    virtual void Visit(const VoicingEnumerator::Voicing &rVoicing)
+    {
+        m_Voicings.push_back(rVoicing);
+    }
+
+    // Best first, then nearest the nut.
+    void Rank()
+    {
+        std::sort(m_Voicings.begin(), m_Voicings.end(),
+                  [](const VoicingEnumerator::Voicing &rA, const VoicingEnumerator::Voicing &rB)
+                  {
+                      return (rA.m_Score != rB.m_Score) ? (rA.m_Score < rB.m_Score) :
+                                                          (rA.m_Fret < rB.m_Fret);
+                  });
+    }
+
+    std::vector<VoicingEnumerator::Voicing> m_Voicings;
+};
+
+
+// Enumerate and rank every voicing of every chord.
+static void EnumerateAll(VoicingEnumerator &rEnumerator, unsigned tuning,
+                         std::vector<VoicingList> &rLists)
+{
+    uint8_t pitches[ChordFormulas::NUM_STRINGS];
+    for (unsigned string = 0; string < ChordFormulas::NUM_STRINGS; string++)
+    {
+        pitches[string] = ChordFormulas::GetOpenPitch(tuning, string);
+    }
+
+    rLists.assign(NUM_KEYS * ChordFormulas::NUM_TYPES, VoicingList());
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < ChordFormulas::NUM_TYPES; type++)
+        {
+            VoicingList &rList = rLists[key * ChordFormulas::NUM_TYPES + type];
+            rEnumerator.SetChord(pitches, key, ChordFormulas::GetRequired(type),
+                                 ChordFormulas::GetAllowed(type));
+            for (unsigned fret = 1; fret <= VoicingEnumerator::MAX_BASE_FRET; fret++)
+            {
+                rEnumerator.Enumerate(fret, &rList);
+            }
+            rList.Rank();
+        }
+    }
+}
+
+
+// Write one voicing as a ChordTable.txt line.
+static void WriteVoicing(unsigned key, unsigned type, unsigned variation,
+                         const VoicingEnumerator::Voicing &rVoicing)
+{
+    printf("%-3s %-6s %u  ", ChordSource::GetKeyName(key), ChordSource::GetTypeName(type),
+           variation + 1);
+    for (unsigned string = ChordFormulas::NUM_STRINGS; string-- != 0; )
+    {
+        unsigned value = (rVoicing.m_Shape >> (string * VoicingEnumerator::BITS_PER_STRING)) &
+                         ((1 << VoicingEnumerator::BITS_PER_STRING) - 1);
+        if (value == VoicingEnumerator::VALUE_UNPLAYED)
+        {
+            printf("  x");
+        }
+        else
+        {
+            printf("%3u", (value == VoicingEnumerator::VALUE_OPEN) ? 0 :
+                          rVoicing.m_Fret + value - 1);
+        }
+    }
+    printf("\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    unsigned tuning     = TuningStandard;
+    unsigned count      = 0;
+    bool     rootInBass = true;
+    int      option;
+
+    while ((option = getopt(argc, argv, "t:an:")) != -1)
+    {
+        switch (option)
+        {
+        case 't':
+            for (tuning = 0; tuning < NUM_TUNINGS; tuning++)
+            {
+                if (strcmp(optarg, TuningNames[tuning]) == 0)
+                {
+                    break;
+                }
+            }
+            if (tuning == NUM_TUNINGS)
+            {
+                fprintf(stderr, "error: unknown tuning '%s'\n", optarg);
+                return 2;
+            }
+            break;
+
+        case 'a':
+            rootInBass = false;
+            break;
+
+        case 'n':
+            count = atoi(optarg);
+            break;
+
+        default:
+            fprintf(stderr, "Usage: %s [-t <tuning>] [-a] [-n <count>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    VoicingEnumerator enumerator;
+    enumerator.SetLimits(4, VoicingEnumerator::NUM_ROWS - 1, 3, rootInBass);
+
+    // Time complete enumerations of all the chords.
+    std::vector<VoicingList> lists;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < ITERATIONS; i++)
+    {
+        EnumerateAll(enumerator, tuning, lists);
+    }
+    double millis = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+
+    // Write the best voicings of each chord, grouped by key like ChordTable.txt.
+    if (count != 0)
+    {
+        printf("# Key Type Var  E  A  D  G  B  e\n");
+        for (unsigned key = 0; key < NUM_KEYS; key++)
+        {
+            printf("\n# %s\n", ChordSource::GetKeyName(key));
+            for (unsigned type = 0; type < ChordFormulas::NUM_TYPES; type++)
+            {
+                const VoicingList &rList = lists[key * ChordFormulas::NUM_TYPES + type];
+                for (unsigned i = 0; (i < count) && (i < rList.m_Voicings.size()); i++)
+                {
+                    WriteVoicing(key, type, i, rList.m_Voicings[i]);
+                }
+            }
+        }
+    }
+
+    // Report what was found.  The report goes to stderr when voicings are
+    // written, so they can be redirected to a file.
+    FILE *pReport = (count != 0) ? stderr : stdout;
+    size_t total = 0;
+    size_t fewest = (size_t)-1;
+    size_t most = 0;
+    unsigned unplayable = 0;
+    for (size_t i = 0; i < lists.size(); i++)
+    {
+        size_t found = lists[i].m_Voicings.size();
+        total  += found;
+        fewest  = std::min(fewest, found);
+        most    = std::max(most, found);
+        unplayable += (found == 0);
+    }
+    fprintf(pReport, "%s tuning, %s bass: %zu voicings of %zu chords (%zu to %zu per chord, "
+            "%u unplayable)\n", TuningNames[tuning], rootInBass ? "root" : "any",
+            total, lists.size(), fewest, most, unplayable);
+    fprintf(pReport, "%.2f ms to enumerate and rank every chord (average of %u runs)\n",
+            millis, ITERATIONS);
+    return 0;
+}
@@ -0,0 +1,248 @@
+/////////////////////////////////////////////////////////////////////////////////
+// ReverseIndexBench.cpp
+//
+// Contains main() for the reverse index benchmark.  This host (Linux) program
+// builds the chord table compiler's reverse index (see ReverseIndex.h) for the
+// chord libraries in ChordTable.txt and for synthetic libraries of up to 9
+// variations of every chord, then looks up the key of every voicing with the
+// index and with a linear scan, as ReverseChordFinderMode::Search() did.  It
+// reports the voicings each lookup compares and the time each takes, to show
+// that an index lookup costs the same however large the library is.
+//
+// Usage: ReverseIndexBench <ChordTable.txt>
+//
+// History:
+// - agent 17-Oct-2026 Original creation.
+//
+// Copyright (C) 2026 agent
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program. If not, see <http://www.gnu.org/licenses>.
+//
+/////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "ChordSource.h"            // From ChordTableCompiler.
+#include "ReverseIndex.h"           // From ChordTableCompiler.
+
+
+// Times each lookup is repeated, so the time is long enough to measure.
+static const unsigned REPEATS = 20;
+
+
+/////////////////////////////////////////////////////////////////////////////////
+// LookupCost structure.  The average cost of looking up a voicing's key.
+/////////////////////////////////////////////////////////////////////////////////
+struct LookupCost
+{
+    double m_Compared;                  // Voicings compared per lookup.
+    double m_Nanos;                     // Time per lookup.
+};
+
+
+// Return true if two entries look the same on the fingerboard.
+static bool IsSame(const ChordEntry &rA, const ChordEntry &rB)
+{
+    return memcmp(rA.m_Frets, rB.m_Frets, sizeof(rA.m_Frets)) == 0;
+}
+
+// Find the first voicing that looks like each voicing with a scan from the
+// start of the table.
+static LookupCost Scan(const ChordSource &rSource)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    unsigned long compared = 0;
+    unsigned long found    = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned repeat = 0; repeat < REPEATS; repeat++)
+    {
+        for (size_t query = 0; query < rEntries.size(); query++)
+        {
+            for (size_t i = 0; i < rEntries.size(); i++)
+            {
+                compared++;
+                if (IsSame(rEntries[i], rEntries[query]))
+                {
+                    found += i;
+                    break;
+                }
+            }
+        }
+    }
+    double nanos = std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - start).count();
+
+    // Use the result, so the loops aren't optimized away.
+    if (found == (unsigned long)-1)
+    {
+        printf("\n");
+    }
+    double lookups = (double)REPEATS * rEntries.size();
+    LookupCost cost = { compared / lookups, nanos / lookups };
+    return cost;
+}
+
+// Find the first voicing that looks like each voicing in its reverse index
+// slot.
+static LookupCost Lookup(const ChordSource &rSource, const ReverseIndex &rIndex)
+{
+    const std::vector<ChordEntry> &rEntries = rSource.GetEntries();
+    unsigned long compared = 0;
+    unsigned long found    = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned repeat = 0; repeat < REPEATS; repeat++)
+    {
+        for (size_t query = 0; query < rEntries.size(); query++)
+        {
+            unsigned slot = ReverseIndex::GetSlot(ReverseIndex::GetKey(rEntries[query]),
+                                                  rIndex.GetSlotBits());
+            for (unsigned i = rIndex.GetSlotStart(slot); i < rIndex.GetSlotStart(slot + 1); i++)
+            {
+                compared++;
+                if (IsSame(rEntries[rIndex.GetVoicing(i)], rEntries[query]))
+                {
+                    found += i;
+                    break;
+                }
+            }
+        }
+    }
+    double nanos = std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - start).count();
+
+    if (found == (unsigned long)-1)
+    {
+        printf("\n");
+    }
+    double lookups = (double)REPEATS * rEntries.size();
+    LookupCost cost = { compared / lookups, nanos / lookups };
+    return cost;
+}
+
+// Report the cost of both kinds of lookup in one library.
+static void Measure(const char *pName, const ChordSource &rSource)
+{
+    ReverseIndex index;
+    index.Build(rSource);
+    LookupCost scan   = Scan(rSource);
+    LookupCost lookup = Lookup(rSource, index);
+
+    printf("%-16s %8u %6u %8.1f %9.1f %9.1f %9.1f\n", pName,
+           (unsigned)rSource.GetEntries().size(), index.GetNumSlots(),
+           scan.m_Compared, scan.m_Nanos, lookup.m_Compared, lookup.m_Nanos);
+}
+
+// Write a synthetic chord source with the specified number of random
+// variations of every key and type, and load it.  Returns false if it can't
+// be made.
+static bool Generate(unsigned variations, ChordSource &rSource)
+{
+    char path[] = "/tmp/ReverseIndexBenchXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0)
+    {
+        fprintf(stderr, "error: can't create a temporary file\n");
+        return false;
+    }
+    FILE *pFile = fdopen(fd, "w");
+
+    for (unsigned key = 0; key < NUM_KEYS; key++)
+    {
+        for (unsigned type = 0; type < NUM_TYPES; type++)
+        {
+            for (unsigned variation = 0; variation < variations; variation++)
+            {
+                // Each string is unplayed, open, or on one of the frets the
+                // chord spans.  One string is on the base fret.
+                unsigned baseFret = 1 + rand() % MAX_BASE_FRET;
+                unsigned first    = rand() % NUM_STRINGS;
+                fprintf(pFile, "%s %s %u", ChordSource::GetKeyName(key),
+                        ChordSource::GetTypeName(type), variation + 1);
+                for (unsigned string = 0; string < NUM_STRINGS; string++)
+                {
+                    unsigned value = rand() % (NUM_PATTERN_FRETS + 2);
+                    if (string == first)
+                    {
+                        fprintf(pFile, " %u", baseFret);
+                    }
+                    else if (value == NUM_PATTERN_FRETS)
+                    {
+                        fprintf(pFile, " x");
+                    }
+                    else if (value == NUM_PATTERN_FRETS + 1)
+                    {
+                        fprintf(pFile, " 0");
+                    }
+                    else
+                    {
+                        fprintf(pFile, " %u", baseFret + value);
+                    }
+                }
+                fprintf(pFile, "\n");
+            }
+        }
+    }
+    fclose(pFile);
+
+    bool ok = rSource.Load(path);
+    unlink(path);
+    return ok;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <ChordTable.txt>\n", argv[0]);
+        return 2;
+    }
+
+    ChordSource full;
+    if (!full.Load(argv[1]))
+    {
+        return 1;
+    }
+    ChordSource reduced(full);
+    reduced.RemoveSuppTypes();
+
+    // Warm up the caches.
+    Scan(full);
+
+    printf("                          Linear scan         Reverse index\n");
+    printf("Library          Voicings  Slots Compared   ns/find  Compared   ns/find\n");
+    Measure("reduced", reduced);
+    Measure("full", full);
+
+    srand(1);
+    for (unsigned variations = 1; variations <= MAX_VARIATIONS; variations *= 3)
+    {
+        ChordSource synthetic;
+        if (!Generate(variations, synthetic))
+        {
+            return 1;
+        }
+        char name[32];
+        snprintf(name, sizeof(name), "synthetic x%u", variations);
+        Measure(name, synthetic);
+    }
+    return 0;
+}